@@ -0,0 +1,19 @@
+# FindGLIB
+# Try to find libglib-2.0
+#
+# Once found, will define:
+#
+#    GLIB_FOUND
+#    GLIB_INCLUDE_DIRS
+#    GLIB_LIBRARIES
+#
+
+INCLUDE(TritiumPackageHelper)
+
+TPH_FIND_PACKAGE(GLIB glib-2.0 glib.h glib-2.0)
+
+INCLUDE(TritiumFindPackageHandleStandardArgs)
+
+FIND_PACKAGE_HANDLE_STANDARD_ARGS(GLIB DEFAULT_MSG GLIB_LIBRARIES GLIB_INCLUDE_DIRS)
+
+MARK_AS_ADVANCED(GLIB_INCLUDE_DIRS GLIB_LIBRARIES)
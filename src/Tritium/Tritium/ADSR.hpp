@@ -50,6 +50,23 @@ public:
 	float get_value( float step );
 	float release();
 
+	/**
+	 * Fill env[0..nFrames-1] with the next values of the
+	 * envelope, advancing 'step' ticks per frame.  The same as
+	 * calling get_value() nFrames times, but much cheaper.
+	 *
+	 * Returns true if the values are all the same (e.g. while
+	 * sustaining), so that the caller can apply env[0] as a gain
+	 * instead.
+	 */
+	bool get_values( float step, float* env, unsigned nFrames );
+
+	/// The last value returned by get_value().  Does not advance
+	/// the envelope.
+	float get_current_value() const {
+		return __value;
+	}
+
 private:
 	enum ADSRState {
 		ATTACK,
@@ -60,9 +77,24 @@ private:
 	};
 
 	ADSRState __state;
-	float __ticks;
+	float __ticks;		///< Ticks into the current segment
 	float __value;
 	float __release_value;
+
+	// The current segment is  y = a + b * k^(ticks / length),  so
+	// that it goes exactly from its start to its target value.
+	// Each frame is  y = y * r + c  (see enter() and set_step()).
+	bool __begun;		///< The ATTACK segment was entered
+	float __length;		///< Segment length (ticks)
+	double __a, __b, __k;
+	double __y;		///< Value of the next frame
+	double __r, __c;
+	float __step;		///< Step that __r and __c are for
+
+	void enter( ADSRState state, double y0 );
+	void next_segment();
+	void set_step( float step );
+	unsigned frames_left( float step ) const;
 };
 
 } // namespace Tritium
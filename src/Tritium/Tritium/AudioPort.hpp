@@ -106,6 +106,21 @@ namespace Tritium
 	 */
 	virtual void write_zeros(uint32_t nframes = -1) = 0;
 
+	/**
+	 * Use someone else's buffers (e.g. a JACK port's) as the
+	 * port's buffers.
+	 *
+	 * Until the next call, get_buffer() returns 'left' and
+	 * 'right' and size() returns 'size'.  Whatever is written to
+	 * the port goes straight to them, so nothing needs to be
+	 * copied out.  A null 'left' goes back to the port's own
+	 * buffers.  'right' is ignored for MONO ports.
+	 *
+	 * Drivers may hand out new buffers every cycle, so this is
+	 * typically called at the start of each one.  Realtime safe.
+	 */
+	virtual void set_buffers(Float* left, Float* right, uint32_t size) = 0;
+
     };
 
 } // namespace Tritium
@@ -47,10 +47,13 @@ namespace Tritium
     class Drumkit;
     class Effects;
     class EventQueue;
+    struct ExportSettings;
+    struct ExportStatus;
     class MidiInput;
     class MidiMap;
     class Playlist;
     class Preferences;
+    struct ProcessProfile;
     class Sampler;
     class Mixer;
     class Transport;
@@ -234,11 +237,21 @@ namespace Tritium
         void restartDrivers();
 
         void startExportSong( const QString& filename );
+        void startExportSong( const ExportSettings& settings );
+        /// Returns false if no export was started.
+        bool getExportStatus( ExportStatus& status );
         void stopExportSong();
 
         float getProcessTime();
         float getMaxProcessTime();
 
+        /// Per-stage timing of the audio thread.  Can be called
+        /// from any thread; it never blocks the audio thread.
+        void get_process_profile( ProcessProfile& profile );
+        void reset_process_profile();
+        /// Also time the voices of each instrument (costs a little).
+        void set_instrument_profiling( bool enabled );
+
 #ifdef JACK_SUPPORT
         void renameJackPorts();
 #endif
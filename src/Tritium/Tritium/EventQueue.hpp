@@ -22,6 +22,8 @@
 #ifndef TRITIUM_EVENT_QUEUE_HPP
 #define TRITIUM_EVENT_QUEUE_HPP
 
+#include <stdint.h>
+
 #define MAX_EVENTS 1024
 
 namespace Tritium
@@ -41,7 +43,8 @@ enum EventType {
 	EVENT_METRONOME,
 	EVENT_PROGRESS,
 	EVENT_TRANSPORT,
-	EVENT_JACK_TIME_MASTER
+	EVENT_JACK_TIME_MASTER,
+	EVENT_COUNT ///< Number of event types (not an event)
 };
 
 
@@ -49,25 +52,55 @@ class Event
 {
 public:
 	EventType type;
-	int value;
+	int value;          ///< State, error code, percent, etc.
+	float fvalue;       ///< Level, tempo, etc.
+	int instrument;     ///< Instrument index, or -1
+	uint64_t time;      ///< When it was pushed (monotonic, ns)
+	unsigned count;     ///< Number of events coalesced into this one
+
+	Event( EventType t = EVENT_NONE, int v = 0 ) :
+		type( t ),
+		value( v ),
+		fvalue( 0.0f ),
+		instrument( -1 ),
+		time( 0 ),
+		count( 1 )
+		{}
 };
 
+class EventQueuePrivate;
+
 ///
 /// Event queue: is the way the engine talks to the GUI
 ///
+/// Any number of threads (the audio thread, the MIDI driver, the
+/// GUI) may push events, and one thread pops them.  Pushing never
+/// locks or allocates.  When the queue is full, the new event is
+/// dropped and counted (the unread events are kept).
+///
+/// High-rate events that only signal activity (EVENT_MIDI_ACTIVITY,
+/// EVENT_XRUN) are coalesced: while one is waiting in the queue,
+/// more of the same type only increase its 'count'.
+///
 class EventQueue
 {
 public:
-	EventQueue();
+	EventQueue( unsigned capacity = MAX_EVENTS );
 	~EventQueue();
 
-	void push_event( EventType type, int nValue );
+	/// Returns false if the event was dropped.
+	bool push_event( EventType type, int nValue );
+	bool push_event( const Event& ev );
+	/// Returns an EVENT_NONE event if the queue is empty.
 	Event pop_event();
 
+	unsigned get_capacity();
+	/// Events dropped because the queue was full.
+	unsigned get_dropped();
+	unsigned get_dropped( EventType type );
+
 private:
-	int __read_index;
-	int __write_index;
-	Event __events_buffer[ MAX_EVENTS ];
+	EventQueuePrivate *d;
 };
 
 } // namespace Tritium
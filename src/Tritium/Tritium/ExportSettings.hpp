@@ -0,0 +1,76 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+#ifndef TRITIUM_EXPORTSETTINGS_HPP
+#define TRITIUM_EXPORTSETTINGS_HPP
+
+#include <QString>
+#include <stdint.h>
+
+namespace Tritium
+{
+    /**
+     * \brief How Engine::startExportSong() renders a song to a file.
+     */
+    struct ExportSettings
+    {
+	typedef enum {
+	    WAV = 0,
+	    FLAC
+	} format_t;
+
+	typedef enum {
+	    PCM_16 = 0,
+	    PCM_24,
+	    FLOAT       ///< 32-bit float (WAV only)
+	} sample_format_t;
+
+	QString filename;
+	format_t format;
+	sample_format_t sample_format;
+	unsigned sample_rate;    ///< 0 = the rate of the audio driver
+	unsigned block_size;     ///< Frames per process() cycle (max. MAX_BUFFER_SIZE)
+	int render_threads;      ///< Sampler render threads, -1 = one per extra CPU
+	float tail_seconds;      ///< Render up to this long after the last bar, until silent
+
+	/**
+	 * Defaults: 16-bit at the driver's rate, 4096 frame blocks,
+	 * up to 10 seconds of tail.  The format is FLAC if the file
+	 * name ends in ".flac", else WAV.
+	 */
+	ExportSettings(const QString& filename = QString());
+    };
+
+    /**
+     * \brief Where an export is at (see Engine::getExportStatus()).
+     */
+    struct ExportStatus
+    {
+	bool finished;          ///< The file is closed
+	bool failed;            ///< The file could not be written
+	uint32_t frames;        ///< Frames written
+	uint32_t song_frames;   ///< Frames up to the end of the last bar
+	float peak_L;           ///< Highest absolute sample written
+	float peak_R;
+    };
+
+} // namespace Tritium
+
+#endif // TRITIUM_EXPORTSETTINGS_HPP
@@ -56,6 +56,7 @@ public:
 	void deactivate();
 	unsigned getBufferSize();
 	unsigned getSampleRate();
+	static unsigned getXRuns();
 	int getNumTracks();
 
 	void setPortName( int nPort, bool bLeftChannel, const QString& sName );
@@ -103,7 +103,8 @@ public:
 
 	// Process callback hooks.  Specifically added for JACK MIDI,
 	// but could be used by others.  The default implementation
-	// does nothing.
+	// does nothing.  They are called from the JACK process
+	// callback, so they must be realtime safe.
 	virtual int processAudio(uint32_t nframes);    // Assumes processing in same thread as audio
 	virtual int processNonAudio(uint32_t nframes); // Assumes processing in other thread.
 
@@ -24,6 +24,7 @@
 #define TRITIUM_INSTRUMENT_HPP
 
 #include <Tritium/memory.hpp>
+#include <stdint.h>
 
 class QString;
 
@@ -64,6 +65,10 @@ namespace Tritium
 	    T<Instrument>::shared_ptr placeholder,
 	    bool is_live = true
 	    );
+	ADSR* swap_from_placeholder(
+	    T<Instrument>::shared_ptr placeholder,
+	    InstrumentLayer* layers[]
+	    );
 	void load_from_name(
 	    Engine* engine,
 	    const QString& drumkit_name,
@@ -71,8 +76,16 @@ namespace Tritium
 	    bool is_live = true
 	    );
 
+	/// The layer slots are atomic: the audio thread may read
+	/// them while another thread replaces a layer.  A replaced
+	/// layer may still be playing, so free it with
+	/// Reaper::defer().
 	InstrumentLayer* get_layer( int index );
 	void set_layer( InstrumentLayer* layer, unsigned index );
+	/// Like set_layer(), but returns the old layer.
+	InstrumentLayer* swap_layer( InstrumentLayer* layer, unsigned index );
+	/// Bytes of sample data in all of the layers.
+	size_t get_sample_bytes();
 
 	void set_name( const QString& name );
 	const QString& get_name();
@@ -80,7 +93,12 @@ namespace Tritium
 	void set_id( const QString& id );
 	const QString& get_id();
 
+	/// Deletes the old ADSR right away, so the instrument must
+	/// not be playing.  See swap_adsr().
 	void set_adsr( ADSR* adsr );
+	/// Replace the ADSR and return the old one.  The audio thread
+	/// copies it on note-on, so free it with Reaper::defer().
+	ADSR* swap_adsr( ADSR* adsr );
 	ADSR* get_adsr();
 
 	void set_mute_group( int group );
@@ -124,9 +142,19 @@ namespace Tritium
 
 	bool is_soloed();
 	void set_soloed( bool soloed );
+	/// The Sampler counts the voices that play the instrument.
+	/// They refer to it by plain pointer, so an instrument that
+	/// is taken out of the sampler is not freed while it is
+	/// queued.  See Reaper::defer().
 	void enqueue();
 	void dequeue();
 	int is_queued();
+	/// is_queued() as a Reaper::busy_t.
+	static bool is_busy( void* instr );
+
+	/// A number that names this instrument in a SeqEvent.  It is
+	/// never 0, and no two instruments have the same one.
+	uint32_t get_handle();
 
 	bool is_stop_notes();
 	void set_stop_note( bool stopnotes );
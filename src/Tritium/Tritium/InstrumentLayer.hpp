@@ -25,6 +25,7 @@
 #include <Tritium/globals.hpp>
 #include <Tritium/memory.hpp>
 #include <utility> // std::pair
+#include <cstddef>
 
 namespace Tritium
 {
@@ -58,8 +59,16 @@ namespace Tritium
 	void set_gain( float gain );
 	float get_gain();
 
+	/// Not for a layer that may be playing.  Put a new layer in
+	/// its place and free the old one with Reaper::defer().
 	void set_sample( T<Sample>::shared_ptr sample );
 	T<Sample>::shared_ptr get_sample();
+	/// The sample without taking a reference (for the audio
+	/// thread).  Whoever replaces it frees the old one with
+	/// Reaper::defer().
+	Sample* get_sample_ptr();
+	/// Bytes of sample data (0 if there is no sample).
+	size_t get_sample_bytes();
 
     private:
 	velocity_range_t m_velocity_range; // Range: [min, max]
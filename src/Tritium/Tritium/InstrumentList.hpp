@@ -42,7 +42,7 @@ namespace Tritium
     public:
 	typedef T<Instrument>::shared_ptr instrument_t;
 	typedef std::deque<instrument_t> sequence_t;
-	typedef std::map<instrument_t, unsigned> map_t;
+	typedef std::map<Instrument*, unsigned> map_t;
 
 	InstrumentList();
 	~InstrumentList();
@@ -50,16 +50,24 @@ namespace Tritium
 	void add( T<Instrument>::shared_ptr pInstrument );
 	T<Instrument>::shared_ptr get( unsigned int pos );
 	int get_pos( T<Instrument>::shared_ptr inst );
+	/// get_pos() without taking a reference (for the audio
+	/// thread, which refers to playing instruments by pointer).
+	int get_pos( Instrument* inst );
 	unsigned get_size();
 
 	void del( int pos );
 	void clear();
 
 	void replace( T<Instrument>::shared_ptr pNewInstr, unsigned nPos );
+	/// Move the instrument at 'from' to 'to'.  The ones in
+	/// between shift by one.
+	void move( unsigned from, unsigned to );
 
     private:
 	sequence_t m_list;
 	map_t m_posmap;
+
+	void reindex();
     };
 
 } // namespace Tritium
@@ -39,6 +39,54 @@ namespace Tritium
 
 class LoggerPrivate;
 
+/**
+ * \brief A log message that can be built in a real-time thread.
+ *
+ * It keeps a pointer to the format (which must be a string
+ * literal) and copies up to MAX_ARGS arguments.  Strings are
+ * truncated to MAX_STRING - 1 Latin-1 characters.  Nothing is
+ * allocated.  The logger's thread replaces %1, %2, ... in the
+ * format like QString::arg() does.
+ *
+ *     RT_WARNINGLOG( RtLogMessage("Bad layer %1 of %2") << n << name );
+ */
+class RtLogMessage
+{
+public:
+    enum { MAX_ARGS = 4, MAX_STRING = 40 };
+
+    typedef enum {
+	Int,
+	UInt,
+	Double,
+	String
+    } arg_type_t;
+
+    struct Arg
+    {
+	arg_type_t type;
+	union {
+	    int i;
+	    unsigned u;
+	    double d;
+	};
+	char s[MAX_STRING];
+    };
+
+    const char* format;
+    unsigned nargs;
+    Arg args[MAX_ARGS];
+
+    explicit RtLogMessage( const char* fmt = "" ) : format( fmt ), nargs( 0 ) {}
+
+    // Arguments after MAX_ARGS are ignored.
+    RtLogMessage& operator<<( int v );
+    RtLogMessage& operator<<( unsigned v );
+    RtLogMessage& operator<<( double v );
+    RtLogMessage& operator<<( const char* v );
+    RtLogMessage& operator<<( const QString& v );
+};
+
 /**
  * Class for writing logs to the console
  */
@@ -81,6 +129,20 @@ public:
 	      unsigned line,
 	      const QString& msg );
 
+    /**
+     * Log from a real-time thread.  Never locks or allocates.
+     * Each format is limited to a few messages per second.
+     */
+    void rt_log( unsigned lev,
+		 const char* funcname,
+		 const char* file,
+		 unsigned line,
+		 const RtLogMessage& msg );
+    /// Real-time messages dropped because the queue was full.
+    unsigned get_rt_dropped();
+    /// Real-time messages not logged because of the rate limit.
+    unsigned get_rt_suppressed();
+
 private:
     static Logger *__instance;
     LoggerPrivate* d;
@@ -110,9 +172,28 @@ private:
 	}								\
     }
 
+/* The same for RtLogMessage's.  Use these in the audio thread.
+ */
+#define __RT_LOG_WRAPPER(lev, funct, file, line, msg) {			\
+	if( Tritium::Logger::get_log_level() & (lev) ){			\
+	    Tritium::Logger::get_instance()->rt_log(			\
+		(lev),							\
+		(funct),						\
+		(file),							\
+		(line),							\
+		(msg)							\
+		);							\
+	}								\
+    }
+
 #define DEBUGLOG(x) __LOG_WRAPPER( Tritium::Logger::Debug, __FUNCTION__, __FILE__, __LINE__, (x) );
 #define INFOLOG(x) __LOG_WRAPPER( Tritium::Logger::Info, __FUNCTION__, __FILE__, __LINE__, (x) );
 #define WARNINGLOG(x) __LOG_WRAPPER( Tritium::Logger::Warning, __FUNCTION__, __FILE__, __LINE__, (x) );
 #define ERRORLOG(x) __LOG_WRAPPER( Tritium::Logger::Error, __FUNCTION__, __FILE__, __LINE__, (x) );
 
+#define RT_DEBUGLOG(x) __RT_LOG_WRAPPER( Tritium::Logger::Debug, __FUNCTION__, __FILE__, __LINE__, (x) );
+#define RT_INFOLOG(x) __RT_LOG_WRAPPER( Tritium::Logger::Info, __FUNCTION__, __FILE__, __LINE__, (x) );
+#define RT_WARNINGLOG(x) __RT_LOG_WRAPPER( Tritium::Logger::Warning, __FUNCTION__, __FILE__, __LINE__, (x) );
+#define RT_ERRORLOG(x) __RT_LOG_WRAPPER( Tritium::Logger::Error, __FUNCTION__, __FILE__, __LINE__, (x) );
+
 #endif // TRITIUM_OBJECT_HPP
@@ -29,6 +29,7 @@
 namespace Tritium
 {
     class ChannelPrivate;
+    class MixerImplPrivate;
 
     /**
      * \brief Abstract "public" interface for a mixer device
@@ -81,6 +82,7 @@ namespace Tritium
 	    void match_props(const Channel& other);
 
 	private:
+	    friend class MixerImplPrivate;
 	    ChannelPrivate *d; // Declared in MixerImplPrivate.hpp
 	};
 
@@ -73,7 +73,9 @@ namespace Tritium
 	/**
 	 * Process all send/return channels.
 	 *
-	 * i.e. Sends to effects.
+	 * i.e. Sends to effects.  An effect that gets nothing is
+	 * skipped once its tail has died out (see TailDetector), and
+	 * mix_down() leaves it out.
 	 */
 	void mix_send_return(uint32_t nframes);
 
@@ -113,6 +115,18 @@ namespace Tritium
 	void mix_down(uint32_t nframes, float* left, float* right,
 		      float* peak_left = 0, float* peak_right = 0);
 
+	/**
+	 * Make the ports with external buffers post-fader outputs.
+	 *
+	 * A port can render straight into an output's buffers (see
+	 * AudioPort::set_buffers()), which makes it a pre-fader
+	 * output.  If this is set, mix_down() then applies the
+	 * channel's gain and pan to those buffers in place, after
+	 * the channel is mixed.  Default: false.
+	 */
+	void post_fader_outs(bool post_fader);
+	bool post_fader_outs();
+
     private:
 	MixerImplPrivate *d;
     };
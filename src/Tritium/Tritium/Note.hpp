@@ -78,20 +78,9 @@ class Note
 {
 public:
 
-	// These are used exclusively by the Sampler
-	uint32_t m_nSilenceOffset; ///< Used when scheduling note start in process() cycle
-	uint32_t m_nReleaseOffset; ///< Used when scheduling not lengths.
-	float m_fSamplePosition; ///< Place marker for overlapping process() cycles
+	// The Sampler keeps the playback state (envelope, position,
+	// ...) of a note in its voice, so a Note is cheap to copy.
 	NoteKey m_noteKey;
-	ADSR m_adsr;
-	// Low pass resonant filter
-	float m_fCutoff;		///< Filter cutoff (0..1)
-	float m_fResonance;	///< Filter resonant frequency (0..1)
-	float m_fBandPassFilterBuffer_L;		///< Band pass filter buffer
-	float m_fBandPassFilterBuffer_R;		///< Band pass filter buffer
-	float m_fLowPassFilterBuffer_L;		///< Low pass filter buffer
-	float m_fLowPassFilterBuffer_R;		///< Low pass filter buffer
-	//~ filter
 
 	// This is used exclusively by the Sequencer (Engine)
 	int m_nHumanizeDelay;	///< Used in "humanize" function
@@ -25,6 +25,7 @@
 #include <Tritium/globals.hpp>
 #include <Tritium/memory.hpp>
 #include <vector>
+#include <stdint.h>
 
 namespace Tritium
 {
@@ -42,6 +43,14 @@ public:
 	typedef std::multimap <int, Note*> note_map_t;
 	note_map_t note_map;
 
+	/// An entry of the compiled event table.
+	struct Event
+	{
+		uint32_t tick;
+		Note* note;
+	};
+	typedef std::vector<Event> event_table_t;
+
 	Pattern( const QString& name, const QString& category, unsigned length = MAX_NOTES );
 	~Pattern();
 
@@ -56,6 +65,23 @@ public:
 	*/
 	bool references_instrument( T<Instrument>::shared_ptr I );
 
+	/**
+	  Rebuild the event table from note_map.  This must be called
+	  after every insert or erase on note_map.  If the pattern is in
+	  the song, hold the engine lock until this returns: the
+	  sequencer reads the table (and its Note pointers) in the audio
+	  thread.
+	*/
+	void compile_events();
+
+	/**
+	  The notes in note_map, sorted by tick (notes on the same tick
+	  stay in note_map order).  Negative ticks are left out.
+	*/
+	const event_table_t& get_events() const {
+		return __events;
+	}
+
 	static T<Pattern>::shared_ptr get_empty_pattern();
 	T<Pattern>::shared_ptr copy();
 
@@ -86,6 +112,7 @@ private:
 	unsigned __length;
 	QString __name;
 	QString __category;
+	event_table_t __events;
 };
 
 
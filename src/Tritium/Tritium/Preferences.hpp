@@ -177,6 +177,12 @@ public:
 	bool m_bUseMetronome;		///< Use metronome?
 	float m_fMetronomeVolume;	///< Metronome volume FIXME: remove this volume!!
 	unsigned m_nMaxNotes;		///< max notes
+	unsigned m_nSamplePreloadFrames;	///< Frames of each sample kept in memory, the rest is streamed (0 = load whole samples)
+	bool m_bSampleDiskCache;		///< Decode samples once into the data directory and share them between processes (see SampleRateCache)
+	unsigned m_nPresetCacheMegabytes;	///< Memory for drumkits the LV2 plugin keeps loaded for program changes
+	unsigned m_nRenderThreads;		///< Extra threads that render voices in parallel (0 = render in the audio thread)
+	int m_nRenderThreadPriority;		///< SCHED_FIFO priority of the render threads (0 = not realtime)
+	bool m_bRenderThreadAffinity;		///< Pin each render thread to a CPU
 	unsigned m_nBufferSize;		///< Audio buffer size
 	unsigned m_nSampleRate;		///< Audio sample rate
 
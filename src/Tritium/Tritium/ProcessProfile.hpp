@@ -0,0 +1,102 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+#ifndef TRITIUM_PROCESSPROFILE_HPP
+#define TRITIUM_PROCESSPROFILE_HPP
+
+#include <vector>
+#include <stdint.h>
+
+namespace Tritium
+{
+    /**
+     * \brief A snapshot of how long the audio engine takes.
+     *
+     * See Engine::get_process_profile().  Each process() cycle is
+     * timed in stages with a monotonic clock.  Besides the last
+     * cycle, every stage has a histogram of the recent cycles (the
+     * "window", between WINDOW_CYCLES and 2 * WINDOW_CYCLES
+     * cycles), so that the rare slow cycles that cause dropouts
+     * show up in the percentiles even when the mean is low.
+     *
+     * All times are in milliseconds.
+     */
+    struct ProcessProfile
+    {
+	typedef enum {
+	    INPUT = 0,   ///< GUI and MIDI input
+	    SEQUENCER,   ///< Song and pattern sequencer
+	    SAMPLER,     ///< Rendering the voices
+	    FX,          ///< Effect sends and returns
+	    MIXDOWN,     ///< Mixing to the outputs
+	    TOTAL,       ///< The whole cycle
+	    STAGE_COUNT
+	} stage_t;
+
+	/**
+	 * Histogram bins are a quarter of an octave wide.  Bin 0 is
+	 * everything under 1 us, and bin k ends at 2^(k/4) us.  The
+	 * last bin also has everything longer.  The percentiles are
+	 * the upper edge of their bin (or 'max', if it is less).
+	 */
+	enum { HISTOGRAM_BINS = 72 };
+	enum { WINDOW_CYCLES = 4096 };
+
+	struct Stage
+	{
+	    float last;    ///< Last cycle
+	    float mean;    ///< Mean over the window
+	    float max;     ///< Longest in the window
+	    float p50;     ///< Median
+	    float p99;     ///< 99th percentile
+	    float p999;    ///< 99.9th percentile
+	    uint32_t histogram[HISTOGRAM_BINS];
+	};
+
+	struct Instrument
+	{
+	    unsigned voices; ///< Voices playing in the last cycle
+	    float render;    ///< Render time in the last cycle
+	    float max;       ///< Longest render time in the window
+	};
+
+	Stage stages[STAGE_COUNT];
+
+	/// By position in the instrument list.  Empty unless
+	/// Engine::set_instrument_profiling() is on.
+	std::vector<Instrument> instruments;
+
+	uint64_t cycles;     ///< Cycles since the last reset
+	uint32_t window;     ///< Cycles in the histograms
+	uint32_t overruns;   ///< Cycles that took longer than 'period'
+	uint32_t xruns;      ///< Xruns reported by the audio driver
+	float period;        ///< Length of the last cycle (the time budget)
+	unsigned voices;     ///< Voices playing in the last cycle
+
+	/// The upper edge of histogram bin 'bin' (ms).
+	static float bin_end(unsigned bin);
+
+	/// Name of a stage, for displays.
+	static const char* stage_name(stage_t stage);
+    };
+
+} // namespace Tritium
+
+#endif // TRITIUM_PROCESSPROFILE_HPP
@@ -0,0 +1,116 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+#ifndef TRITIUM_REAPER_HPP
+#define TRITIUM_REAPER_HPP
+
+#include <Tritium/memory.hpp>
+#include <cstddef>
+#include <stdint.h>
+
+namespace Tritium
+{
+    class RtReader;
+    struct ReaperPrivate;
+
+    /**
+     * \brief Frees objects for the audio thread, in another thread.
+     *
+     * Freeing is not RT-safe: a large sample can take milliseconds
+     * to free, and the allocator may take a lock.  So the audio
+     * thread never drops the last reference to anything.  It hands
+     * the object to retire(), which only copies a pointer into a
+     * lock-free ring.
+     *
+     * Other threads that replace something that the audio thread
+     * may still be using (a sample, a layer, an instrument) hand
+     * the old one to defer().  It is kept until the reader (see
+     * RtReader) has passed the point where it was deferred and,
+     * for a shared_ptr, until the reaper holds the last reference.
+     * So a voice that is still playing a removed instrument never
+     * ends up freeing it.  Objects that the audio thread uses by
+     * plain pointer (an instrument, while it has voices) are
+     * deferred with a 'busy' test, and are kept while it is true.
+     *
+     * collect() does the actual freeing.  It is called by a non-RT
+     * worker thread (the Sampler's), and keeps count of what was
+     * freed.  The sizes in bytes are whatever the callers passed.
+     */
+    class Reaper
+    {
+    public:
+	Reaper(T<RtReader>::shared_ptr reader, unsigned capacity = 1024);
+	/// Frees everything.  The reader must be done.
+	~Reaper();
+
+	// Audio thread.  Never blocks, allocates or frees.  Returns
+	// false if the ring is full and the object was not taken.
+	// The caller can only leak it then; overflows() counts them.
+	// The Sampler's voices don't hold references, so it never
+	// needs to retire anything.
+	bool retire(T<void>::shared_ptr ref, size_t bytes = 0);
+	template <typename X>
+	bool retire(X* ptr, size_t bytes = 0) {
+	    return retire_raw(ptr, &destroy<X>, bytes);
+	}
+
+	// Other threads.  Not RT-safe.
+	typedef bool (*busy_t)(void*);
+	void defer(T<void>::shared_ptr ref, size_t bytes = 0, busy_t busy = 0);
+	template <typename X>
+	void defer(X* ptr, size_t bytes = 0) {
+	    defer_raw(ptr, &destroy<X>, bytes);
+	}
+
+	// Worker thread
+	/// True if collect() would free something.
+	bool ready();
+	/// Free what is ready (everything, if 'all').  Returns the
+	/// number of objects freed.
+	unsigned collect(bool all = false);
+
+	// Accounting
+	unsigned pending();         ///< Deferred objects not freed yet
+	size_t pending_bytes();
+	uint64_t freed();           ///< Objects freed so far
+	uint64_t freed_bytes();
+	unsigned overflows();       ///< retire()'s that found the ring full
+
+    private:
+	typedef void (*destroy_t)(void*);
+
+	template <typename X>
+	static void destroy(void* ptr) {
+	    delete static_cast<X*>(ptr);
+	}
+
+	bool retire_raw(void* ptr, destroy_t fn, size_t bytes);
+	void defer_raw(void* ptr, destroy_t fn, size_t bytes);
+
+	// Not copyable
+	Reaper(const Reaper&);
+	Reaper& operator=(const Reaper&);
+
+	ReaperPrivate *d;
+    };
+
+} // namespace Tritium
+
+#endif // TRITIUM_REAPER_HPP
@@ -29,6 +29,8 @@
 namespace Tritium
 {
 
+class MappedFile;
+
 /**
 \ingroup H2CORE
 */
@@ -43,6 +45,18 @@ public:
 		float* data_R = NULL
 		);
 
+	/// A sample whose data is in a mapped file (see
+	/// SampleRateCache).  The data is read-only and is not
+	/// deleted; the sample keeps the mapping instead.
+	Sample(
+		unsigned frames,
+		const QString& filename,
+		unsigned sample_rate,
+		T<MappedFile>::shared_ptr mapping,
+		float* data_L,
+		float* data_R
+		);
+
 	~Sample();
 
 	float* get_data_l() {
@@ -66,20 +80,43 @@ public:
 		return __n_frames * sizeof( float ) * 2;
 	}
 
-	/// Loads a sample from disk
-	static T<Sample>::shared_ptr load( const QString& filename );
+	/// Loads a sample from disk.  If preload_frames is not 0 and
+	/// the file is longer than that, only the first
+	/// preload_frames are loaded and the rest is streamed from
+	/// disk while playing (see is_streaming()).
+	static T<Sample>::shared_ptr load( const QString& filename, unsigned preload_frames = 0 );
 
+	/// Number of frames in get_data_l() and get_data_r().
 	unsigned get_n_frames() {
 		return __n_frames;
 	}
 
+	/// Length of the whole sample, including the part that is
+	/// not in memory.  Same as get_n_frames() unless streaming.
+	unsigned get_total_frames() {
+		return __total_frames;
+	}
+
+	/// True if only the head of the sample is in memory.
+	bool is_streaming() {
+		return __total_frames > __n_frames;
+	}
+
+	/// True if the data is in a file that is shared with other
+	/// samples and processes (see SampleRateCache).
+	bool is_mapped() {
+		return __mapping.get() != 0;
+	}
+
 private:
 	float *__data_l;	///< Left channel data
 	float *__data_r;	///< Right channel data
 
 	unsigned __sample_rate;		///< samplerate for this sample
 	QString __filename;		///< filename associated with this sample
-	unsigned __n_frames;		///< Total number of frames in this sample.
+	unsigned __n_frames;		///< Number of frames in memory.
+	unsigned __total_frames;	///< Total number of frames in this sample.
+	T<MappedFile>::shared_ptr __mapping;	///< Owner of the data, if it is mapped.
 
 	//static int __total_used_bytes;
 
@@ -88,6 +125,9 @@ private:
 
 	/// loads a FLAC file
 	static T<Sample>::shared_ptr load_flac( const QString& filename );
+
+	/// loads the first preload_frames of a file for streaming
+	static T<Sample>::shared_ptr load_head( const QString& filename, unsigned preload_frames );
 };
 
 };
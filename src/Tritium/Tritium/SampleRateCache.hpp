@@ -0,0 +1,93 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+#ifndef TRITIUM_SAMPLERATECACHE_HPP
+#define TRITIUM_SAMPLERATECACHE_HPP
+
+#include <Tritium/memory.hpp>
+#include <QString>
+
+namespace Tritium
+{
+    class Sample;
+    struct SampleRateCachePrivate;
+
+    /**
+     * \brief Loads samples converted to the engine's sample rate.
+     *
+     * The Sampler plays a sample without interpolation when it is
+     * at the engine's rate and not pitched.  Otherwise every voice
+     * resamples it with linear interpolation, which costs CPU and
+     * aliases.  load() converts each sample once, with a
+     * band-limited (windowed sinc) filter, so that kits recorded at
+     * another rate still take the fast path.
+     *
+     * Loaded samples are remembered (by file name) while they are
+     * in use, so that loading the same file again returns the same
+     * sample.  Changing the sample rate forgets them.
+     *
+     * If a disk cache directory is set, each sample is decoded
+     * (and converted) once into a float file there, keyed by the
+     * path, size, time and rate of the source.  The samples are
+     * mapped from these files (see MappedFile), so every process
+     * and plugin instance that loads the same kit shares one copy
+     * in memory, and later loads don't decode at all.  Mapped
+     * samples are read-only.
+     *
+     * Samples that are streamed from disk (see
+     * Sample::is_streaming()) are neither converted nor cached,
+     * because the streamer reads the rest of the file as it is.
+     *
+     * All of the functions are thread-safe, but none are RT-safe.
+     */
+    class SampleRateCache
+    {
+    public:
+	SampleRateCache();
+	~SampleRateCache();
+
+	/// 0 means "don't convert" (the default).
+	void set_sample_rate(unsigned rate);
+	unsigned get_sample_rate();
+
+	/// The directory of the decoded sample files.  An empty
+	/// string turns off the disk cache (the default).
+	void set_disk_cache(const QString& dir);
+	QString get_disk_cache();
+
+	/// True if 'sample' doesn't need to be converted.
+	bool matches(T<Sample>::shared_ptr sample);
+
+	/// Like Sample::load(), but converted to get_sample_rate().
+	T<Sample>::shared_ptr load(const QString& filename, unsigned preload_frames = 0);
+
+	/// Forget the loaded samples (not the disk cache).
+	void clear();
+
+	/// Band-limited conversion of 'sample' to 'rate'.
+	static T<Sample>::shared_ptr resample(T<Sample>::shared_ptr sample, unsigned rate);
+
+    private:
+	SampleRateCachePrivate *d;
+    };
+
+} // namespace Tritium
+
+#endif // TRITIUM_SAMPLERATECACHE_HPP
@@ -36,6 +36,8 @@ namespace Tritium
 
 class Note;
 class Sample;
+class SampleRateCache;
+class Reaper;
 class Instrument;
 class InstrumentList;
 class AudioOutput;
@@ -51,6 +53,16 @@ struct TransportPosition;
     class Sampler
     {
     public:
+	/**
+	 * Which voice to cut when a note starts and max_notes are
+	 * already playing.
+	 */
+	typedef enum {
+	    STEAL_OLDEST = 0,      ///< The voice that started first.
+	    STEAL_QUIETEST,        ///< The voice with the lowest level.
+	    STEAL_SAME_INSTRUMENT  ///< The oldest voice of the same instrument, else the oldest.
+	} steal_policy_t;
+
 	Sampler(T<AudioPortManager>::shared_ptr apm);
 	~Sampler();
 
@@ -69,8 +81,15 @@ struct TransportPosition;
 
 	void add_instrument( T<Instrument>::shared_ptr instr );
 	void remove_instrument( T<Instrument>::shared_ptr instr );
-	void clear();
+	void move_instrument( unsigned from, unsigned to );
+	void clear( bool keep_ports = false );
 	T<InstrumentList>::shared_ptr get_instrument_list();
+	/// Instrument::get_handle() of the instrument at 'pos' as
+	/// process() sees it, or 0.  RT-safe, but only for the thread
+	/// that calls process() (between calls).
+	uint32_t get_instrument_handle( unsigned pos );
+	T<InstrumentList>::shared_ptr swap_instrument_list( T<InstrumentList>::shared_ptr list );
+	void reserve_instrument_ports( size_t count );
 
 	// CONFIGURATION
 	// -------------
@@ -78,11 +97,45 @@ struct TransportPosition;
 	void set_max_note_limit(int max = -1);
 	int get_max_note_limit();
 
+	void set_voice_steal_policy(steal_policy_t policy);
+	steal_policy_t get_voice_steal_policy();
+
+	unsigned get_stream_underruns();
+
+	/// Converts samples to the engine's rate when they are loaded.
+	T<SampleRateCache>::shared_ptr get_sample_rate_cache();
+
+	/// Frees what the audio thread lets go of (see Reaper).
+	T<Reaper>::shared_ptr get_reaper();
+
+	void set_profiling(bool enabled);
+	bool get_profiling();
+	unsigned get_profiled_instruments();
+	void get_instrument_profile(unsigned index, unsigned& voices, uint64_t& ns);
+
+	void set_render_threads(unsigned threads, int rt_priority = 0, bool pin = false);
+	unsigned get_render_threads();
+
+	/**
+	 * Per-instrument outputs.  Each instrument's port renders
+	 * straight into the buffers given with set_instrument_out()
+	 * (e.g. JACK track ports), so there is no copy.  They are
+	 * pre-fader; the mixer applies the fader if they should be
+	 * post-fader (see MixerImpl::post_fader_outs()).
+	 */
 	void set_per_instrument_outs(bool enabled = false);
 	bool get_per_instrument_outs();
 	void set_per_instrument_outs_prefader(bool enabled = false);
 	bool get_per_instrument_outs_prefader();
 
+	/**
+	 * The output buffers of instrument n for the next process().
+	 * They must hold that cycle's nFrames.  Instruments that are
+	 * not given any use their own buffers.  Call from the audio
+	 * thread before each process().
+	 */
+	void set_instrument_out(unsigned n, float* left, float* right);
+
     private:
 	SamplerPrivate *d;
     }; // class Sampler
@@ -27,7 +27,14 @@
 namespace Tritium
 {
     /**
-     * A container that maps a frame and a note object.
+     * A container that maps a frame and a note.
+     *
+     * SeqEvent's are copied by the audio thread (SeqScript, the
+     * Sampler's command queue), so a SeqEvent is plain data: it
+     * holds no references.  The instrument is named by its handle
+     * (Instrument::get_handle()), which the Sampler looks up in its
+     * instrument list.  An event for an instrument that the
+     * Sampler doesn't have is dropped.
      */
     struct SeqEvent
     {
@@ -43,8 +50,15 @@ namespace Tritium
 	    PATCH_CHANGE
 	} type;
 
-	Note note; // Valid for all NOTE_* events
-	bool quantize; // Valid for all NOTE_* events
+	// Valid for all NOTE_* events.  For ALL_OFF, an
+	// instrument of 0 means all of them.
+	uint32_t instrument; // Instrument::get_handle()
+	float velocity;
+	float pan_l;
+	float pan_r;
+	float pitch;         // Key plus pitch of the note, in semitones
+	bool quantize;
+
 	float fdata; // Valid for all VOL_* events
 	uint32_t idata; // Valid for PATCH_CHANGE
 
@@ -55,10 +69,20 @@ namespace Tritium
 	SeqEvent() :
 	    frame(0),
 	    type(UNDEFINED),
-	    note(),
-	    quantize(false)
+	    instrument(0),
+	    velocity(1.0f),
+	    pan_l(1.0f),
+	    pan_r(1.0f),
+	    pitch(0.0f),
+	    quantize(false),
+	    fdata(0.0f),
+	    idata(0)
 	    {}
 
+	/// Copy the instrument, velocity, pan and pitch of 'note'.
+	/// Not for the audio thread (Note holds a reference).
+	void set_note(const Note& note);
+
 	bool operator==(const SeqEvent& o) const;
 	bool operator!=(const SeqEvent& o) const;
 	bool operator<(const SeqEvent& o) const;
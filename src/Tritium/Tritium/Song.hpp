@@ -41,6 +41,7 @@ class Pattern;
 class Song;
 class PatternList;
 class Engine;
+class SongTimeline;
 
 /**
  *\brief Song (sequence) class.
@@ -99,6 +100,9 @@ public:
 
     void set_modified(bool m);
     bool get_modified();
+    /// Changes every time the song is modified (see set_modified())
+    /// or its timeline changes (see invalidate_timeline()).
+    unsigned get_revision();
 
     void set_name(const QString& name_p);
     const QString& get_name();
@@ -149,6 +153,10 @@ public:
     uint32_t bar_for_absolute_tick(uint32_t abs_tick);
     uint32_t bar_start_tick(uint32_t bar);
     uint32_t ticks_in_bar(uint32_t bar);
+    double frame_for_tick(double abs_tick, uint32_t frame_rate);
+    double tick_for_frame(double frame, uint32_t frame_rate);
+    void invalidate_timeline();
+    T<SongTimeline>::shared_ptr get_timeline();
 
     // PATTERN MODE METHODS
     // ====================
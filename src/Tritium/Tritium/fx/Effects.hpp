@@ -35,6 +35,8 @@ namespace Tritium
 {
 
 class Engine;
+class RtReader;
+template <typename X> class RtSnapshot;
 
 /**
  *
@@ -42,24 +44,61 @@ class Engine;
 class Effects
 {
 public:
+	/**
+	 * The FX slots as the audio thread sees them.  setLadspaFX()
+	 * publishes a new Rack and the old one (with an effect that
+	 * was taken out) is freed later, outside of the audio thread.
+	 */
+	struct Rack
+	{
+		T<LadspaFX>::shared_ptr fx[ MAX_FX ];
+		unsigned count;   ///< Slots to process (no more than the plugins found)
+	};
+
 	Effects(Engine* parent);
 	~Effects();
 
 	T<LadspaFX>::shared_ptr getLadspaFX( int nFX );
 	void  setLadspaFX( T<LadspaFX>::shared_ptr pFX, int nFX );
 
-	std::vector<LadspaFXInfo*> getPluginList();
+	/// Audio thread: the Rack can be used until releaseRack().
+	const Rack& acquireRack();
+	void releaseRack();
+
+	/// Take the FX away from the audio thread (e.g. to activate
+	/// them) until resumeFX().  Returns when it stopped using them.
+	void suspendFX();
+	void resumeFX();
+
+	/**
+	 * The usable plugins.  They come from the plugin index (see
+	 * LadspaIndex), which is checked against the LADSPA paths in
+	 * the background.  If it changed, the new list is used from
+	 * the next call, unless the FX group was already built.
+	 */
+	const std::vector<LadspaFXInfo*>& getPluginList();
 	LadspaFXGroup* getLadspaFXGroup();
 
 private:
+	class Rescan;
+
 	Engine* m_engine;
 	std::vector<LadspaFXInfo*> m_pluginList;
+	std::vector<LadspaFXInfo*> m_oldPlugins;	///< Replaced by a rescan, but may be in use
 	LadspaFXGroup* m_pRootGroup;
 	LadspaFXGroup* m_pRecentGroup;
+	QString m_sIndexFile;
+	Rescan* m_pRescan;
 	
 	void updateRecentGroup();
+	void publishRack();
+	void scanPlugins();
+	void takeRescan();
 
 	T<LadspaFX>::shared_ptr m_FXList[ MAX_FX ];
+	bool m_bSuspended;
+	RtReader* m_pRackReader;
+	RtSnapshot<Rack>* m_pRack;
 
 	void RDFDescend( const QString& sBase, LadspaFXGroup *pGroup, std::vector<LadspaFXInfo*> pluginList );
 	void getRDF( LadspaFXGroup *pGroup, std::vector<LadspaFXInfo*> pluginList );
@@ -29,6 +29,7 @@
 #include <list>
 #include "ladspa.h"
 #include <Tritium/memory.hpp>
+#include <Tritium/fx/TailDetector.hpp>
 
 namespace Tritium
 {
@@ -164,6 +165,12 @@ public:
 		return m_fVolume;
 	}
 
+	/// Whether the mixer is skipping it for silence (see
+	/// MixerImpl::mix_send_return()).
+	TailDetector& getTailDetector() {
+		return m_tail;
+	}
+
 
 private:
 	bool m_pluginType;
@@ -178,6 +185,7 @@ private:
 	const LADSPA_Descriptor * m_d;
 	LADSPA_Handle m_handle;
 	float m_fVolume;
+	TailDetector m_tail;
 
 	unsigned m_nICPorts;	///< input control port
 	unsigned m_nOCPorts;	///< output control port
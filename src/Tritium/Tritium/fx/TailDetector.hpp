@@ -0,0 +1,124 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+#ifndef TRITIUM_TAILDETECTOR_HPP
+#define TRITIUM_TAILDETECTOR_HPP
+
+#include <stdint.h>
+
+namespace Tritium
+{
+
+/**
+ * \brief Decides when an effect can stop running.
+ *
+ * An effect still makes sound for a while after its input goes
+ * silent (a reverb's decay, a delay's echoes).  Once that tail has
+ * died out, running it only produces silence, so it can be skipped
+ * until there is input again.
+ *
+ * Each cycle the owner calls wantProcess() with whether the effect
+ * got any input.  If it returns true, the effect is run and its
+ * output peak is passed to processed().
+ *
+ * States:
+ *
+ *   RUNNING - It has input.
+ *   TAIL    - No input, but the output hasn't been below the
+ *             threshold for hold() frames yet.
+ *   IDLE    - Skipped.  Input makes it RUNNING again.
+ *
+ * LADSPA plugins can't tell how long their tail is, so it is
+ * measured.  A silent gap in the tail that is followed by sound
+ * (e.g. a delay's echo) makes hold() at least twice that gap.  It
+ * is never shorter than setMinHold().
+ *
+ * Only the audio thread may change it.  The getters are for
+ * monitoring.
+ */
+class TailDetector
+{
+public:
+	typedef enum {
+		RUNNING = 0,
+		TAIL,
+		IDLE
+	} state_t;
+
+	/// 'fThreshold' is the peak below which output is silent.
+	TailDetector( float fThreshold = 1.0e-5f, uint32_t nMinHold = 0 );
+
+	/// Back to RUNNING (e.g. the effect was reset).  Keeps the
+	/// measurements.
+	void reset();
+
+	/// Call once per cycle.  Returns false if the effect should
+	/// be skipped.
+	bool wantProcess( bool bInput );
+
+	/// The output peak of a cycle that was processed.
+	void processed( float fPeak, uint32_t nFrames );
+
+	state_t getState() const {
+		return m_state;
+	}
+	/// Silent frames needed to go IDLE.
+	uint32_t getHold() const;
+	/// Longest tail measured so far (frames from the end of the
+	/// input to the last audible output).
+	uint32_t getLongestTail() const {
+		return m_nLongestTail;
+	}
+	/// Times it went IDLE.
+	unsigned getIdleCount() const {
+		return m_nIdleCount;
+	}
+
+	float getThreshold() const {
+		return m_fThreshold;
+	}
+	void setThreshold( float fThreshold ) {
+		m_fThreshold = fThreshold;
+	}
+	uint32_t getMinHold() const {
+		return m_nMinHold;
+	}
+	void setMinHold( uint32_t nFrames ) {
+		m_nMinHold = nFrames;
+	}
+
+	/// Largest absolute value in 'buf'.
+	static float peak( const float* buf, uint32_t nFrames );
+
+private:
+	state_t m_state;
+	float m_fThreshold;
+	uint32_t m_nMinHold;
+	uint32_t m_nTail;		///< Frames since the input ended
+	uint32_t m_nLastAudible;	///< m_nTail at the last audible output
+	uint32_t m_nSilent;		///< Silent frames in a row
+	uint32_t m_nLongestGap;
+	uint32_t m_nLongestTail;
+	unsigned m_nIdleCount;
+};
+
+};
+
+#endif // TRITIUM_TAILDETECTOR_HPP
@@ -24,6 +24,8 @@
 #define MAX_INSTRUMENTS		1000
 #define MAX_NOTES		192
 
+#define MAX_VOICES		512	// Sampler voice pool (upper bound of max_notes)
+
 #define MAX_FX			4
 
 #define MAX_LAYERS		16
@@ -20,17 +20,23 @@
  */
 
 #include <Tritium/ADSR.hpp>
-#include "table/getTableValue.hpp"
-#include "table/TableExponential.hpp"
+#include <cmath>
 
 namespace Tritium
 {
 
-inline static float linear_interpolation( float fVal_A, float fVal_B, double fVal )
+namespace
 {
-	return fVal_A * ( 1 - fVal ) + fVal_B * fVal;
-//	return fVal_A + fVal * ( fVal_B - fVal_A );
-//	return fVal_A + ((fVal_B - fVal_A) * fVal);
+	// Where an exponential segment would be after its length if
+	// it didn't stop at the target (as a fraction of the distance).
+	// The attack rises fast at first, decay and release fall fast
+	// at first.  They are close to the x^(1/e) and x^e curves
+	// that the envelope used before.
+	const double ATTACK_SHAPE = 0.01;
+	const double FALL_SHAPE = 0.044;
+
+	const float MIN_RELEASE = 256;	///< ticks
+	const unsigned FOREVER = unsigned( -1 );
 }
 
 
@@ -47,6 +53,16 @@ ADSR::ADSR(
 		, __state( ATTACK )
 		, __ticks( 0.0 )
 		, __value( 0.0 )
+		, __release_value( 0.0 )
+		, __begun( false )
+		, __length( 0.0 )
+		, __a( 0.0 )
+		, __b( 0.0 )
+		, __k( 1.0 )
+		, __y( 0.0 )
+		, __r( 1.0 )
+		, __c( 0.0 )
+		, __step( 0.0 )
 {
 	//DEBUGLOG( "INIT" );
 }
@@ -61,6 +77,16 @@ ADSR::ADSR( const ADSR& orig )
 		, __state( orig.__state )
 		, __ticks( orig.__ticks )
 		, __value( orig.__value )
+		, __release_value( orig.__release_value )
+		, __begun( orig.__begun )
+		, __length( orig.__length )
+		, __a( orig.__a )
+		, __b( orig.__b )
+		, __k( orig.__k )
+		, __y( orig.__y )
+		, __r( orig.__r )
+		, __c( orig.__c )
+		, __step( orig.__step )
 {
 	//DEBUGLOG( "INIT - copy ctr" );
 }
@@ -73,60 +99,172 @@ ADSR::~ADSR()
 }
 
 
-float ADSR::get_value( float step )
+/// Start segment 'state' at the value y0.  The parameters are read
+/// here, so they may be changed until the segment starts.
+void ADSR::enter( ADSRState state, double y0 )
 {
-	switch ( __state ) {
-	case ATTACK:
-		if ( __attack == 0 ) {
-			__value = 1.0;
-		} else {
-			__value = getTableValue ( linear_interpolation( 0.0, 1.0, ( __ticks * 1.0 / __attack ) ), tableExponentConvex, tableExponentConvexSize );
-		}
+	double target = 0.0;
 
-		__ticks += step;
-		if ( __ticks > __attack ) {
-			__state = DECAY;
-			__ticks = 0;
-		}
+	__state = state;
+	__ticks = 0;
+	__step = 0;
+	__r = 1.0;
+	__c = 0.0;
+	__k = FALL_SHAPE;
+	switch ( state ) {
+	case ATTACK:
+		__length = __attack;
+		__k = ATTACK_SHAPE;
+		target = 1.0;
 		break;
-
 	case DECAY:
-		if ( __decay == 0 ) {
-			__value = __sustain;
-		} else {
-			__value = getTableValue ( linear_interpolation( 1.0, __sustain, ( __ticks * 1.0 / __decay ) ), tableExponentConcave, tableExponentConcaveSize );
-		}
-
-		__ticks += step;
-		if ( __ticks > __decay ) {
-			__state = SUSTAIN;
-			__ticks = 0;
-		}
+		__length = __decay;
+		target = __sustain;
+		break;
+	case RELEASE:
+		__length = ( __release < MIN_RELEASE ) ? MIN_RELEASE : __release;
+		target = 0.0;
 		break;
-
 	case SUSTAIN:
-		__value = __sustain;
+		__length = 0;
+		y0 = target = __sustain;
 		break;
+	case IDLE:
+	default:
+		__length = 0;
+		y0 = target = 0.0;
+	}
+
+	if ( __length > 0 ) {
+		__b = ( y0 - target ) / ( 1.0 - __k );
+		__a = y0 - __b;
+		__y = y0;
+	} else {
+		// Straight to the target (for one frame, if it is a
+		// zero-length segment).
+		__a = target;
+		__b = 0.0;
+		__y = target;
+	}
+}
+
 
+
+void ADSR::next_segment()
+{
+	switch ( __state ) {
+	case ATTACK:
+		enter( DECAY, 1.0 );
+		break;
+	case DECAY:
+		enter( SUSTAIN, __sustain );
+		break;
 	case RELEASE:
-		if ( __release < 256 ) {
-			__release = 256;
+		enter( IDLE, 0.0 );
+		break;
+	default:
+		break;
+	}
+}
+
+
+
+void ADSR::set_step( float step )
+{
+	if ( step == __step ) {
+		return;
+	}
+	__step = step;
+	if ( __length > 0 && __b != 0.0 ) {
+		__r = pow( __k, double( step ) / __length );
+		__c = __a * ( 1.0 - __r );
+	} else {
+		__r = 1.0;
+		__c = 0.0;
+	}
+}
+
+
+
+/// Frames until the segment ends.  A segment has a frame for each
+/// tick position from 0 up to and including its length.
+unsigned ADSR::frames_left( float step ) const
+{
+	if ( __state == SUSTAIN || __state == IDLE || step <= 0 ) {
+		return FOREVER;
+	}
+	if ( __ticks > __length ) {
+		return 0;
+	}
+	double n = floor( ( __length - __ticks ) / step ) + 1.0;
+	return ( n < FOREVER ) ? unsigned( n ) : FOREVER;
+}
+
+
+
+bool ADSR::get_values( float step, float* env, unsigned nFrames )
+{
+	unsigned n = 0, run, left, k;
+	bool constant = true;
+
+	if ( !__begun ) {
+		__begun = true;
+		enter( ATTACK, 0.0 );
+	}
+
+	while ( n < nFrames ) {
+		left = frames_left( step );
+		if ( left == 0 ) {
+			next_segment();
+			continue;
 		}
-		__value = getTableValue ( linear_interpolation( __release_value, 0.0, ( __ticks * 1.0 / __release ) ), tableExponentConcave, tableExponentConcaveSize );
+		set_step( step );
 
-		__ticks += step;
-		if ( __ticks > __release ) {
-			__state = IDLE;
-			__ticks = 0;
+		run = nFrames - n;
+		if ( run > left ) {
+			run = left;
 		}
-		break;
+		if ( __r == 1.0 && __c == 0.0 ) {
+			float value = __y;
+			for ( k = 0; k < run; ++k ) {
+				env[ n + k ] = value;
+			}
+			if ( value != env[ 0 ] ) {
+				constant = false;
+			}
+		} else {
+			double y = __y;
+			double r = __r;
+			double c = __c;
+			for ( k = 0; k < run; ++k ) {
+				env[ n + k ] = y;
+				y = y * r + c;
+			}
+			__y = y;
+			constant = false;
+		}
+		n += run;
 
-	case IDLE:
-	default:
-		__value = 0;
-	};
+		if ( run == left ) {
+			next_segment();
+		} else if ( left != FOREVER ) {
+			__ticks += run * step;
+		}
+	}
+
+	if ( nFrames ) {
+		__value = env[ nFrames - 1 ];
+	}
+	return constant;
+}
 
-	return __value;
+
+
+float ADSR::get_value( float step )
+{
+	float value;
+	get_values( step, &value, 1 );
+	return value;
 }
 
 
@@ -140,9 +278,9 @@ float ADSR::release()
 	}
 
 	if ( __state != RELEASE ) {
+		__begun = true;
 		__release_value = __value;
-		__state = RELEASE;
-		__ticks = 0;
+		enter( RELEASE, __value );
 		return __release_value;
 	}
 
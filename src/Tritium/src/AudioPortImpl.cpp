@@ -30,6 +30,9 @@ AudioPortImpl::AudioPortImpl(
     ) :
     _left(max_size),
     _right(0),
+    _ext_left(0),
+    _ext_right(0),
+    _ext_size(0),
     _zero(true)
 {
     if( type == AudioPort::STEREO ) {
@@ -55,9 +58,9 @@ AudioPort::Float* AudioPortImpl::get_buffer(unsigned chan)
 {
     set_zero_flag(false);
     if(chan == 0) {
-	return &_left.front();
+	return (_ext_left) ? _ext_left : &_left.front();
     } else if (chan == 1 && _right.size()) {
-	return &_right.front();
+	return (_ext_left) ? _ext_right : &_right.front();
     } else {
 	return 0;
     }
@@ -65,7 +68,7 @@ AudioPort::Float* AudioPortImpl::get_buffer(unsigned chan)
 
 uint32_t AudioPortImpl::size()
 {
-    return _left.size();
+    return (_ext_left) ? _ext_size : _left.size();
 }
 
 AudioPort::type_t AudioPortImpl::type()
@@ -89,6 +92,14 @@ void AudioPortImpl::set_zero_flag(bool zero_is_true)
 
 void AudioPortImpl::write_zeros(uint32_t nframes)
 {
+    if(_ext_left) {
+	if(nframes > _ext_size) nframes = _ext_size;
+	std::fill(_ext_left, _ext_left + nframes, 0.0f);
+	if(!_right.empty()) {
+	    std::fill(_ext_right, _ext_right + nframes, 0.0f);
+	}
+	return;
+    }
     if(nframes == -1 || nframes > _left.size()) {
 	std::fill(_left.begin(), _left.end(), 0.0f);
 	std::fill(_right.begin(), _right.end(), 0.0f);
@@ -99,3 +110,13 @@ void AudioPortImpl::write_zeros(uint32_t nframes)
 	}
     }
 }
+
+void AudioPortImpl::set_buffers(Float* left, Float* right, uint32_t size)
+{
+    if(left && !_right.empty() && !right) {
+	left = 0; // A stereo port needs both.
+    }
+    _ext_left = left;
+    _ext_right = (left) ? right : 0;
+    _ext_size = (left) ? size : 0;
+}
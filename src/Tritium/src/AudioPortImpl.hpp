@@ -50,10 +50,17 @@ namespace Tritium
 	virtual bool zero_flag();
 	virtual void set_zero_flag(bool zero_is_true);
 	virtual void write_zeros(uint32_t nframes);
+	virtual void set_buffers(Float* left, Float* right, uint32_t size);
+
+	/// True if set_buffers() gave it external buffers.
+	bool external() const { return _ext_left != 0; }
 
     private:
 	std::vector<Float> _left;
 	std::vector<Float> _right;
+	Float* _ext_left;
+	Float* _ext_right;
+	uint32_t _ext_size;
 	bool _zero;
 	QString _name;
     };
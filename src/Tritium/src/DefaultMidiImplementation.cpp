@@ -21,8 +21,6 @@
 
 #include <Tritium/DefaultMidiImplementation.hpp>
 #include <Tritium/SeqEvent.hpp>
-#include <Tritium/Instrument.hpp>
-#include <Tritium/InstrumentList.hpp>
 #include <Tritium/Sampler.hpp>
 
 #include <cassert>
@@ -62,17 +60,13 @@ namespace Tritium
 
 	T<Sampler>::shared_ptr samp = _sampler;
 	if( !samp ) return false;
-	T<InstrumentList>::shared_ptr i_list = samp->get_instrument_list();
-	T<Instrument>::shared_ptr inst;
-	if( note_no < i_list->get_size() ) {
-	    inst = i_list->get(note_no);
-	}
+	uint32_t inst = samp->get_instrument_handle(note_no);
 
 	bool rv = false;
 	if(inst) {
 	    dest.type = SeqEvent::NOTE_OFF;
-	    dest.note.set_velocity(0.0f);
-	    dest.note.set_instrument(inst);
+	    dest.velocity = 0.0f;
+	    dest.instrument = inst;
 	    rv = true;
 	}
 	return rv;
@@ -104,18 +98,13 @@ namespace Tritium
 
 	T<Sampler>::shared_ptr samp = _sampler;
 	if( !samp ) return false;
-	T<InstrumentList>::shared_ptr i_list = samp->get_instrument_list();
-	T<Instrument>::shared_ptr inst;
-	if( note_no < i_list->get_size() ) {
-	    inst = i_list->get(note_no);
-	}
+	uint32_t inst = samp->get_instrument_handle(note_no);
 
 	bool rv = false;
 	if(inst) {
 	    dest.type = SeqEvent::NOTE_ON;
-	    dest.note.set_velocity(velocity);
-	    dest.note.set_instrument(inst);
-	    dest.note.set_length(-1);
+	    dest.velocity = velocity;
+	    dest.instrument = inst;
 	    rv = true;
 	}
 	return rv;	    
@@ -0,0 +1,213 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "DrumkitLoader.hpp"
+#include <Tritium/Engine.hpp>
+#include <Tritium/EventQueue.hpp>
+#include <Tritium/Instrument.hpp>
+#include <Tritium/InstrumentLayer.hpp>
+#include <Tritium/LocalFileMng.hpp>
+#include <Tritium/Preferences.hpp>
+#include <Tritium/Sample.hpp>
+#include <Tritium/SampleRateCache.hpp>
+#include <Tritium/Sampler.hpp>
+#include <Tritium/Logger.hpp>
+#include <QThread>
+#include <QFileInfo>
+#include <cassert>
+
+using namespace Tritium;
+
+class DrumkitLoader::Worker : public QThread
+{
+public:
+    Worker(DrumkitLoader* parent) : _parent(parent) {}
+
+    void run() {
+	while( _parent->run_one() ) {}
+    }
+
+private:
+    DrumkitLoader* _parent;
+};
+
+DrumkitLoader::DrumkitLoader(Engine* engine, unsigned threads) :
+    _engine(engine),
+    _cache(engine->get_sampler()->get_sample_rate_cache()),
+    _threads(threads),
+    _preload_frames(engine->get_preferences()->m_nSamplePreloadFrames),
+    _next(0),
+    _done(0),
+    _last_percent(-1),
+    _errors(0)
+{
+    if( _threads == 0 ) {
+	int ideal = QThread::idealThreadCount();
+	_threads = (ideal > 0) ? ideal : 1;
+    }
+}
+
+DrumkitLoader::~DrumkitLoader()
+{
+}
+
+size_t DrumkitLoader::add(T<Instrument>::shared_ptr placeholder)
+{
+    size_t index = _placeholders.size();
+    _placeholders.push_back(placeholder);
+
+    LocalFileMng mgr(_engine);
+    QString path =
+	mgr.getDrumkitDirectory( placeholder->get_drumkit_name() )
+	+ placeholder->get_drumkit_name()
+	+ "/";
+
+    for( unsigned nLayer = 0 ; nLayer < MAX_LAYERS ; ++nLayer ) {
+	InstrumentLayer *pLayer = placeholder->get_layer( nLayer );
+	if( pLayer == 0 || ! pLayer->get_sample() ) continue;
+	T<Sample>::shared_ptr pSample = pLayer->get_sample();
+
+	Job job;
+	job.instrument = index;
+	job.layer = nLayer;
+	if( pSample->get_n_frames() > 0 && pSample->get_data_l()
+	    && _cache->matches(pSample) ) {
+	    // Drumkits from the Serializer already have their
+	    // samples decoded.  Share them instead of decoding again.
+	    job.filename = pSample->get_filename();
+	    job.sample = pSample;
+	} else if( pSample->get_n_frames() > 0 && pSample->get_data_l() ) {
+	    // Decoded at another rate.  Load it again from the file
+	    // rather than convert the converted data.
+	    job.filename = pSample->get_filename();
+	} else {
+	    // A 'placeholder' sample only has the file name.
+	    QFileInfo samp_file( pSample->get_filename() );
+	    if( !samp_file.exists() ) {
+		samp_file.setFile( path + pSample->get_filename() );
+	    }
+	    job.filename = samp_file.absoluteFilePath();
+	}
+	_jobs.push_back(job);
+    }
+    return index;
+}
+
+/**
+ * Decode the next job.  Returns false when there are none left.
+ * Each job is only touched by the thread that takes it.
+ */
+bool DrumkitLoader::run_one()
+{
+    int k = _next.fetchAndAddOrdered(1);
+    if( k >= int(_jobs.size()) ) {
+	return false;
+    }
+    Job& job = _jobs[k];
+    if( ! job.sample ) {
+	job.sample = _cache->load( job.filename, _preload_frames );
+    }
+    _done.fetchAndAddOrdered(1);
+    return true;
+}
+
+void DrumkitLoader::report_progress()
+{
+    int done = _done.fetchAndAddAcquire(0);
+    int percent = _jobs.empty() ? 100 : (100 * done / int(_jobs.size()));
+    if( percent != _last_percent ) {
+	_engine->get_event_queue()->push_event( EVENT_PROGRESS, percent );
+	_last_percent = percent;
+    }
+}
+
+unsigned DrumkitLoader::pending()
+{
+    unsigned count = 0;
+    for( size_t k = 0 ; k < _jobs.size() ; ++k ) {
+	if( ! _jobs[k].sample ) ++count;
+    }
+    return count;
+}
+
+void DrumkitLoader::load()
+{
+    std::vector<Worker*> workers;
+    unsigned k;
+
+    _next = 0;
+    _done = 0;
+    _last_percent = -1;
+    report_progress();
+
+    // The calling thread is one of the workers.
+    unsigned n_threads = _threads;
+    if( n_threads > _jobs.size() ) n_threads = _jobs.size();
+    for( k = 1 ; k < n_threads ; ++k ) {
+	Worker* w = new Worker(this);
+	w->start();
+	workers.push_back(w);
+    }
+
+    while( run_one() ) {
+	report_progress();
+    }
+
+    for( k = 0 ; k < workers.size() ; ++k ) {
+	while( ! workers[k]->wait(50) ) {
+	    report_progress();
+	}
+	delete workers[k];
+    }
+    report_progress();
+
+    _errors = 0;
+    for( k = 0 ; k < _jobs.size() ; ++k ) {
+	if( ! _jobs[k].sample ) {
+	    ERRORLOG( QString("Error loading sample %1").arg(_jobs[k].filename) );
+	    ++_errors;
+	}
+    }
+}
+
+void DrumkitLoader::take_layers(size_t index, InstrumentLayer* layers[MAX_LAYERS])
+{
+    assert( index < _placeholders.size() );
+    T<Instrument>::shared_ptr placeholder = _placeholders[index];
+    unsigned k;
+
+    for( k = 0 ; k < MAX_LAYERS ; ++k ) {
+	layers[k] = 0;
+    }
+
+    for( k = 0 ; k < _jobs.size() ; ++k ) {
+	Job& job = _jobs[k];
+	if( job.instrument != index || ! job.sample ) continue;
+
+	InstrumentLayer *pOld = placeholder->get_layer( job.layer );
+	InstrumentLayer *pLayer = new InstrumentLayer( job.sample );
+	pLayer->set_velocity_range( pOld->get_velocity_range() );
+	pLayer->set_gain( pOld->get_gain() );
+	pLayer->set_pitch( pOld->get_pitch() );
+	layers[job.layer] = pLayer;
+	job.sample.reset();
+    }
+}
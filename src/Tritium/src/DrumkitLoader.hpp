@@ -0,0 +1,112 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+#ifndef TRITIUM_DRUMKITLOADER_HPP
+#define TRITIUM_DRUMKITLOADER_HPP
+
+#include <Tritium/globals.hpp>
+#include <Tritium/memory.hpp>
+#include <QString>
+#include <QAtomicInt>
+#include <vector>
+
+namespace Tritium
+{
+    class Engine;
+    class Instrument;
+    class InstrumentLayer;
+    class Sample;
+    class SampleRateCache;
+
+    /**
+     * \brief Decodes the samples of several instruments in parallel.
+     *
+     * add() the placeholder instruments (as returned by
+     * LocalFileMng::loadDrumkit()), then call load().  load()
+     * decodes every layer of every instrument on a pool of threads
+     * (one per CPU) and returns when they are all done.  Samples
+     * are converted to the Sampler's rate (see SampleRateCache).
+     * Samples that are already decoded at that rate are shared, not
+     * loaded again.  The
+     * calling thread also decodes, and it pushes EVENT_PROGRESS
+     * (0-100) to the engine's EventQueue as the layers finish.
+     *
+     * Nothing in the engine is touched while loading.  Afterwards,
+     * take_layers() hands over the new layers so that the caller
+     * can swap them in under a single engine lock (see
+     * Instrument::swap_from_placeholder()).
+     */
+    class DrumkitLoader
+    {
+    public:
+	/// threads == 0 means one thread per CPU.
+	DrumkitLoader(Engine* engine, unsigned threads = 0);
+	~DrumkitLoader();
+
+	/// Queue the layers of 'placeholder'.  Returns its index.
+	size_t add(T<Instrument>::shared_ptr placeholder);
+
+	/// Number of samples that load() will decode (the others
+	/// are shared).
+	unsigned pending();
+
+	/// Decode everything that was add()'ed.
+	void load();
+
+	/**
+	 * Move the loaded layers of instrument 'index' into 'layers'.
+	 * Empty layers and samples that failed to load are NULL.
+	 * The caller owns the layers after this.
+	 */
+	void take_layers(size_t index, InstrumentLayer* layers[MAX_LAYERS]);
+
+	/// Number of samples that could not be loaded.
+	unsigned errors() { return _errors; }
+
+    private:
+	class Worker;
+	friend class Worker;
+
+	struct Job
+	{
+	    size_t instrument;
+	    unsigned layer;
+	    QString filename;
+	    T<Sample>::shared_ptr sample;
+	};
+
+	bool run_one();
+	void report_progress();
+
+	Engine* _engine;
+	T<SampleRateCache>::shared_ptr _cache;
+	unsigned _threads;
+	unsigned _preload_frames;
+	std::vector< T<Instrument>::shared_ptr > _placeholders;
+	std::vector<Job> _jobs;
+	QAtomicInt _next;       // Next job to start
+	QAtomicInt _done;       // Jobs finished
+	int _last_percent;      // Last EVENT_PROGRESS sent
+	unsigned _errors;
+    };
+
+} // namespace Tritium
+
+#endif // TRITIUM_DRUMKITLOADER_HPP
@@ -62,12 +62,13 @@
 #include <deque>
 #include <queue>
 #include <list>
+#include <vector>
 #include <iostream>
 #include <ctime>
 #include <cmath>
 
 #include <QtCore/QMutex>
-#include <QtCore/QMutexLocker>
+#include <QtCore/QThread>
 
 #include <Tritium/Logger.hpp>
 #include <Tritium/LocalFileMng.hpp>
@@ -89,9 +90,13 @@
 #include <Tritium/IO/JackOutput.hpp>
 #include <Tritium/IO/NullDriver.hpp>
 #include <Tritium/IO/MidiInput.hpp>
+#include <Tritium/ExportSettings.hpp>
 #include <Tritium/Preferences.hpp>
 #include <Tritium/DataPath.hpp>
 #include <Tritium/Sampler.hpp>
+#include <Tritium/Reaper.hpp>
+#include <Tritium/SampleRateCache.hpp>
+#include <Tritium/ProcessProfile.hpp>
 #include <Tritium/MidiMap.hpp>
 #include <Tritium/Playlist.hpp>
 
@@ -103,9 +108,10 @@
 #include "transport/H2Transport.hpp"
 #include "BeatCounter.hpp"
 #include "SongSequencer.hpp"
+#include "DrumkitLoader.hpp"
 
 #include "IO/FakeDriver.hpp"
-#include "IO/DiskWriterDriver.hpp"
+#include "IO/ExportDriver.hpp"
 #include "IO/JackMidiDriver.hpp"
 #include "IO/JackClient.hpp"
 
@@ -118,14 +124,6 @@ namespace Tritium
 
 
 // PROTOTYPES
-    inline timeval currentTime2()
-    {
-        struct timeval now;
-        gettimeofday( &now, NULL );
-        return now;
-    }
-
-
 
     inline float getGaussian( float z )
     {
@@ -146,6 +144,34 @@ namespace Tritium
         return static_cast<EnginePrivate*>(arg)->audioEngine_process(frames);
     }
 
+    /**
+     * Publishes the song for the audio thread when it was modified
+     * without a following Engine::unlock() (e.g. the editors that
+     * call Song::set_modified() after unlocking).
+     */
+    class SongPublisher : public WorkerThreadClient
+    {
+    public:
+        SongPublisher(EnginePrivate* d) : d(d) {}
+
+        bool events_waiting() {
+            return d->m_SongSequencer.stale();
+        }
+
+        int process() {
+            // The patterns are only read under the lock.
+            // unlock() publishes them.
+            d->m_engine->lock( RIGHT_HERE );
+            d->m_engine->unlock();
+            return 0;
+        }
+
+        void shutdown() {}
+
+    private:
+        EnginePrivate* d;
+    };
+
 
     void EnginePrivate::audioEngine_raiseError( unsigned nErrorCode )
     {
@@ -205,6 +231,14 @@ namespace Tritium
 	m_mixer.reset( new MixerImpl(MAX_BUFFER_SIZE, m_effects, 4) );
         m_sampler.reset( new Sampler(boost::dynamic_pointer_cast<AudioPortManager>(m_mixer)) );
 	m_sampler->set_max_note_limit( m_engine->get_preferences()->m_nMaxNotes );
+	if( m_engine->get_preferences()->m_bSampleDiskCache ) {
+	    m_sampler->get_sample_rate_cache()->set_disk_cache(
+		m_engine->get_preferences()->getDataDirectory() + "cache/samples"
+		);
+	}
+	m_sampler->set_render_threads( m_engine->get_preferences()->m_nRenderThreads,
+				       m_engine->get_preferences()->m_nRenderThreadPriority,
+				       m_engine->get_preferences()->m_bRenderThreadAffinity );
         m_playlist.reset( new Playlist(m_engine) );
 
         m_pSong = Song::get_default_song(m_engine);
@@ -327,20 +361,23 @@ namespace Tritium
 
     void EnginePrivate::audioEngine_clearNoteQueue()
     {
-        m_queue.clear();
-        m_GuiInput.clear();
+        // m_queue belongs to the audio thread.  It clears it at the
+        // start of the next cycle.
+        m_nClearNoteQueue.fetchAndStoreOrdered(1);
+        m_GuiInput.panic();
         m_engine->get_sampler()->panic();
     }
 
-/// Clear all audio buffers
+/// Clear all audio buffers.  Only call it inside a m_ProcessReader
+/// section.
     inline void EnginePrivate::audioEngine_process_clearAudioBuffers( uint32_t nFrames )
     {
-        QMutexLocker mx( &mutex_OutputPointer );
+        AudioOutput* pOutput = m_pOutput.fetchAndAddAcquire(0);
 
         // clear main out Left and Right
-        if ( m_pAudioDriver ) {
-            m_pMainBuffer_L = m_pAudioDriver->getOut_L();
-            m_pMainBuffer_R = m_pAudioDriver->getOut_R();
+        if ( pOutput ) {
+            m_pMainBuffer_L = pOutput->getOut_L();
+            m_pMainBuffer_R = pOutput->getOut_R();
         } else {
             m_pMainBuffer_L = m_pMainBuffer_R = 0;
         }
@@ -352,48 +389,61 @@ namespace Tritium
         }
 
 #ifdef JACK_SUPPORT
-        JackOutput* jo = dynamic_cast<JackOutput*>(m_pAudioDriver.get());
+        // Track outputs.  The sampler renders straight into them
+        // (and zeros the silent ones) if it is going to run.
+        JackOutput* jo = dynamic_cast<JackOutput*>(pOutput);
         if( jo && jo->has_track_outs() ) {
-            float* buf;
+            bool bDirect = m_sampler->get_per_instrument_outs()
+                && m_audioEngineState >= Engine::StateReady;
+            float *buf_L, *buf_R;
             int k;
             for( k=0 ; k<jo->getNumTracks() ; ++k ) {
-                buf = jo->getTrackOut_L(k);
-                if( buf ) {
-                    memset( buf, 0, nFrames * sizeof( float ) );
+                buf_L = jo->getTrackOut_L(k);
+                buf_R = jo->getTrackOut_R(k);
+                if( bDirect ) {
+                    m_sampler->set_instrument_out( k, buf_L, buf_R );
+                    continue;
                 }
-                buf = jo->getTrackOut_R(k);
-                if( buf ) {
-                    memset( buf, 0, nFrames * sizeof( float ) );
+                if( buf_L ) {
+                    memset( buf_L, 0, nFrames * sizeof( float ) );
+                }
+                if( buf_R ) {
+                    memset( buf_R, 0, nFrames * sizeof( float ) );
                 }
             }
         }
 #endif
-
-        mx.unlock();
     }
 
 /// Main audio processing function. Called by audio drivers.
     int EnginePrivate::audioEngine_process( uint32_t nframes )
     {
-        timeval startTimeval = currentTime2();
+        m_profiler.begin_cycle();
         m_nFreeRollingFrameCounter += nframes;
 
+        // The engine lock is not taken here.  Everything below reads
+        // snapshots or atomics, and Engine::unlock() waits for this
+        // section to end before anything replaced under the lock is
+        // freed.  The drivers are replaced the same way (see
+        // audioEngine_setAudioDriver()).  The transport still
+        // takes its own position mutex.
+        m_ProcessReader.enter();
+
 	m_mixer->pre_process(nframes);
         audioEngine_process_clearAudioBuffers( nframes );
 
         if( m_audioEngineState < Engine::StateReady) {
+            m_ProcessReader.leave();
             return 0;
         }
 
-        // Hook for MIDI in-process callbacks.  It calls its own locks
-        // on the audioengine
-        if (m_pMidiDriver) m_pMidiDriver->processAudio(nframes);
-
-        m_engine->lock( RIGHT_HERE );
+        // Hook for MIDI in-process callbacks.  It only queues the
+        // events for the driver's own thread.
+        MidiInput* pMidi = m_pMidiInput.fetchAndAddAcquire(0);
+        if (pMidi) pMidi->processAudio(nframes);
 
-        if( m_audioEngineState < Engine::StateReady) {
-            m_engine->unlock();
-            return 0;
+        if( m_nClearNoteQueue.fetchAndStoreOrdered(0) ) {
+            m_queue.clear();
         }
 
         T<Transport>::shared_ptr xport = m_engine->get_transport();
@@ -404,7 +454,9 @@ namespace Tritium
         m_GuiInput.process(m_queue, pos, nframes);
 #warning "TODO: get MidiDriver::process() in the mix."
         // TODO: m_pMidiDriver->process(m_queue, pos, nframes);
+        m_profiler.mark(ProcessProfile::INPUT);
         m_SongSequencer.process(m_queue, pos, nframes, m_sendPatternChange);
+        m_profiler.mark(ProcessProfile::SEQUENCER);
 
         // PROCESS ALL OUTPUTS
 
@@ -423,29 +475,33 @@ namespace Tritium
                            pos,
                            nframes
             );
+        m_profiler.mark(ProcessProfile::SAMPLER);
 
-        timeval renderTime_end = currentTime2();
-
-        timeval ladspaTime_start = renderTime_end;
 	m_mixer->mix_send_return(nframes);
-        timeval ladspaTime_end = currentTime2();
+        m_profiler.mark(ProcessProfile::FX);
 
 	m_mixer->mix_down(nframes, m_pMainBuffer_L, m_pMainBuffer_R,
 			  &m_fMasterPeak_L, &m_fMasterPeak_R);
+        m_profiler.mark(ProcessProfile::MIXDOWN);
+
+        unsigned nInstruments = pSampler->get_profiled_instruments();
+        for( unsigned k = 0 ; k < nInstruments ; ++k ) {
+            unsigned nVoices;
+            uint64_t ns;
+            pSampler->get_instrument_profile( k, nVoices, ns );
+            m_profiler.set_instrument( k, nVoices, ns );
+        }
 
-//      float fRenderTime = (renderTime_end.tv_sec - renderTime_start.tv_sec) * 1000.0 + (renderTime_end.tv_usec - renderTime_start.tv_usec) / 1000.0;
-        float fLadspaTime =
-            ( ladspaTime_end.tv_sec - ladspaTime_start.tv_sec ) * 1000.0
-            + ( ladspaTime_end.tv_usec - ladspaTime_start.tv_usec ) / 1000.0;
-
-        timeval finishTimeval = currentTime2();
-        m_fProcessTime =
-            ( finishTimeval.tv_sec - startTimeval.tv_sec ) * 1000.0
-            + ( finishTimeval.tv_usec - startTimeval.tv_usec ) / 1000.0;
+        uint64_t period = pos.frame_rate
+            ? uint64_t(nframes) * 1000000000ULL / pos.frame_rate : 0;
+        m_profiler.end_cycle( period,
+                              pSampler->get_playing_notes_number(),
+                              nInstruments );
 
+        m_fProcessTime = m_profiler.last_total() / 1000000.0;
         m_fMaxProcessTime = 1000.0 / ( (float)pos.frame_rate / nframes );
 
-        m_engine->unlock();
+        m_ProcessReader.leave();
 
         if ( m_sendPatternChange ) {
             m_engine->get_event_queue()->push_event( EVENT_PATTERN_CHANGED, -1 );
@@ -473,10 +529,13 @@ namespace Tritium
         }
 
 #ifdef LADSPA_SUPPORT
+        // The audio thread doesn't take the engine lock, so keep
+        // it off the FX while they are (re)activated.
+        m_engine->get_effects()->suspendFX();
         for ( unsigned nFX = 0; nFX < MAX_FX; ++nFX ) {
             T<LadspaFX>::shared_ptr pFX = m_engine->get_effects()->getLadspaFX( nFX );
             if ( pFX == NULL ) {
-                return;
+                break;
             }
 
             pFX->deactivate();
@@ -489,6 +548,7 @@ namespace Tritium
                 );
             pFX->activate();
         }
+        m_engine->get_effects()->resumeFX();
 #endif
     }
 
@@ -497,12 +557,21 @@ namespace Tritium
     void EnginePrivate::audioEngine_renameJackPorts()
     {
 #ifdef JACK_SUPPORT
+        JackOutput *jao;
+        jao = dynamic_cast<JackOutput*>(m_pAudioDriver.get());
+
+        // The instruments render straight into the track ports.
+        // The mixer makes them post-fader.
+        bool bTrackOuts = jao && m_preferences->m_bJackTrackOuts;
+        bool bPreFader = ( m_preferences->m_nJackTrackOutputMode == Preferences::PRE_FADER );
+        m_sampler->set_per_instrument_outs( bTrackOuts );
+        m_sampler->set_per_instrument_outs_prefader( bPreFader );
+        m_mixer->post_fader_outs( bTrackOuts && !bPreFader );
+
         // renames jack ports
         if ( m_pSong == NULL ) {
             return;
         }
-        JackOutput *jao;
-        jao = dynamic_cast<JackOutput*>(m_pAudioDriver.get());
         if ( jao ) {
             jao->makeTrackOutputs( m_pSong );
         }
@@ -648,7 +717,6 @@ namespace Tritium
 	T<Preferences>::shared_ptr preferencesMng = m_engine->get_preferences();
 
         m_engine->lock( RIGHT_HERE );
-        QMutexLocker mx(&mutex_OutputPointer);
 
         DEBUGLOG( "[EnginePrivate::audioEngine_startAudioDrivers]" );
 
@@ -670,36 +738,39 @@ namespace Tritium
 
 
         QString sAudioDriver = preferencesMng->m_sAudioDriver;
+        T<AudioOutput>::shared_ptr pDriver;
 //      sAudioDriver = "Auto";
         if ( sAudioDriver == "Auto" ) {
-            if ( ( m_pAudioDriver = createDriver( "Jack" ) ) == NULL ) {
+            if ( ( pDriver = createDriver( "Jack" ) ) == NULL ) {
                 audioEngine_raiseError( Engine::ERROR_STARTING_DRIVER );
                 ERRORLOG( "Error starting audio driver" );
                 ERRORLOG( "Using the NULL output audio driver" );
 
                 // use the NULL output driver
-                m_pAudioDriver.reset( new NullDriver( m_engine, engine_process_callback, this ) );
-                m_pAudioDriver->init( 0 );
+                pDriver.reset( new NullDriver( m_engine, engine_process_callback, this ) );
+                pDriver->init( 0 );
             }
         } else {
-            m_pAudioDriver = createDriver( sAudioDriver );
-            if ( ! m_pAudioDriver ) {
+            pDriver = createDriver( sAudioDriver );
+            if ( ! pDriver ) {
                 audioEngine_raiseError( Engine::ERROR_STARTING_DRIVER );
                 ERRORLOG( "Error starting audio driver" );
                 ERRORLOG( "Using the NULL output audio driver" );
 
                 // use the NULL output driver
-                m_pAudioDriver.reset( new NullDriver( m_engine, engine_process_callback, this ) );
-                m_pAudioDriver->init( 0 );
+                pDriver.reset( new NullDriver( m_engine, engine_process_callback, this ) );
+                pDriver->init( 0 );
             }
         }
+        audioEngine_setAudioDriver( pDriver );
 
         if ( preferencesMng->m_sMidiDriver == "JackMidi" ) {
 #ifdef JACK_SUPPORT
             m_jack_client->open();
-            m_pMidiDriver.reset( new JackMidiDriver(m_jack_client, m_engine) );
-            m_pMidiDriver->open();
-            m_pMidiDriver->setActive( true );
+            T<MidiInput>::shared_ptr pMidi( new JackMidiDriver(m_jack_client, m_engine) );
+            pMidi->open();
+            pMidi->setActive( true );
+            audioEngine_setMidiDriver( pMidi );
 #endif
         }
 
@@ -719,7 +790,6 @@ namespace Tritium
 
         // Unlocking earlier might execute the jack process() callback before we
         // are fully initialized.
-        mx.unlock();
         m_engine->unlock();
 
 #ifdef JACK_SUPPORT
@@ -735,9 +805,8 @@ namespace Tritium
                 ERRORLOG( "Error starting audio driver [audioDriver::connect()]" );
                 ERRORLOG( "Using the NULL output audio driver" );
 
-                mx.relock();
-                m_pAudioDriver.reset( new NullDriver( m_engine, engine_process_callback, this ) );
-                mx.unlock();
+                audioEngine_setAudioDriver( T<AudioOutput>::shared_ptr(
+                    new NullDriver( m_engine, engine_process_callback, this ) ) );
                 m_pAudioDriver->init( 0 );
                 m_pAudioDriver->connect();
             }
@@ -755,11 +824,9 @@ namespace Tritium
 #ifdef JACK_SUPPORT
             audioEngine_renameJackPorts();
 #endif
-	    m_sampler->set_per_instrument_outs_prefader(
-		m_preferences->m_nJackTrackOutputMode == Preferences::PRE_FADER
-		);
 
             audioEngine_setupLadspaFX( m_pAudioDriver->getBufferSize() );
+            audioEngine_matchSampleRate( m_pAudioDriver->getSampleRate() );
         }
 
 
@@ -767,6 +834,60 @@ namespace Tritium
 
 
 
+/// Convert the samples of the current instruments to the audio
+/// driver's rate, so that the Sampler can play them without
+/// resampling.  Drumkits and songs are converted as they are
+/// loaded; this is for a driver that starts at a new rate.
+    void EnginePrivate::audioEngine_matchSampleRate( unsigned rate )
+    {
+        T<SampleRateCache>::shared_ptr cache = m_sampler->get_sample_rate_cache();
+        if ( rate == 0 || rate == cache->get_sample_rate() ) {
+            return;
+        }
+        cache->set_sample_rate( rate );
+
+        T<InstrumentList>::shared_ptr pList = m_sampler->get_instrument_list();
+        std::vector< T<Instrument>::shared_ptr > instruments;
+        DrumkitLoader loader( m_engine );
+        for ( unsigned nInstr = 0; nInstr < pList->get_size(); ++nInstr ) {
+            instruments.push_back( pList->get( nInstr ) );
+            loader.add( instruments.back() );
+        }
+        if ( loader.pending() == 0 ) {
+            return;
+        }
+        INFOLOG( QString( "Converting %1 samples to %2 Hz" )
+                 .arg( loader.pending() )
+                 .arg( rate ) );
+        loader.load();
+
+        // Swap in the converted layers.  Layers whose sample
+        // could not be loaded keep the old one.  Each slot is
+        // swapped atomically, so the audio thread sees either the
+        // old or the new layer; the lock only keeps other writers
+        // out.
+        std::vector<InstrumentLayer*> old_layers;
+        InstrumentLayer* layers[MAX_LAYERS];
+        m_engine->lock( RIGHT_HERE );
+        for ( unsigned nInstr = 0; nInstr < instruments.size(); ++nInstr ) {
+            loader.take_layers( nInstr, layers );
+            for ( unsigned nLayer = 0; nLayer < MAX_LAYERS; ++nLayer ) {
+                if ( layers[ nLayer ] == 0 ) continue;
+                old_layers.push_back( instruments[ nInstr ]->swap_layer( layers[ nLayer ], nLayer ) );
+            }
+        }
+        m_engine->unlock();
+
+        T<Reaper>::shared_ptr reaper = m_sampler->get_reaper();
+        for ( size_t k = 0; k < old_layers.size(); ++k ) {
+            if ( old_layers[k] ) {
+                reaper->defer( old_layers[k], old_layers[k]->get_sample_bytes() );
+            }
+        }
+    }
+
+
+
 /// Stop all audio drivers
     void EnginePrivate::audioEngine_stopAudioDrivers()
     {
@@ -790,16 +911,15 @@ namespace Tritium
 
         // delete MIDI driver
         if ( m_pMidiDriver ) {
-            m_pMidiDriver->close();
-	    m_pMidiDriver.reset();
+            T<MidiInput>::shared_ptr pMidi = m_pMidiDriver;
+            audioEngine_setMidiDriver( T<MidiInput>::shared_ptr() );
+            pMidi->close();
         }
 
         // delete audio driver
         if ( m_pAudioDriver ) {
             m_pAudioDriver->disconnect();
-            QMutexLocker mx( &mutex_OutputPointer );
-	    m_pAudioDriver.reset();
-            mx.unlock();
+            audioEngine_setAudioDriver( T<AudioOutput>::shared_ptr() );
         }
 
 #ifdef JACK_SUPPORT
@@ -811,6 +931,28 @@ namespace Tritium
 
 
 
+/// Replace the audio driver.  The process callback uses the driver
+/// through m_pOutput, so the old one is released only after the
+/// callback has stopped using it.
+    void EnginePrivate::audioEngine_setAudioDriver( T<AudioOutput>::shared_ptr pDriver )
+    {
+        m_pOutput.fetchAndStoreOrdered( 0 );
+        m_ProcessReader.synchronize();
+        m_pAudioDriver = pDriver;
+        m_pOutput.fetchAndStoreOrdered( pDriver.get() );
+    }
+
+/// Replace the MIDI driver.  See audioEngine_setAudioDriver().
+    void EnginePrivate::audioEngine_setMidiDriver( T<MidiInput>::shared_ptr pDriver )
+    {
+        m_pMidiInput.fetchAndStoreOrdered( 0 );
+        m_ProcessReader.synchronize();
+        m_pMidiDriver = pDriver;
+        m_pMidiInput.fetchAndStoreOrdered( pDriver.get() );
+    }
+
+
+
 /// Restart all audio and midi drivers
     void EnginePrivate::audioEngine_restartAudioDrivers()
     {
@@ -844,15 +986,21 @@ namespace Tritium
 
         d->audioEngine_init();
         d->audioEngine_startAudioDrivers();
+
+        d->m_SnapshotThread.add_client(
+            WorkerThread::pointer_t( new SongPublisher(d) )
+            );
+        d->m_SnapshotThread.start();
     }
 
     EnginePrivate::~EnginePrivate()
     {
+        m_SnapshotThread.shutdown();
+        m_SnapshotThread.wait();
         m_pTransport->stop();
         audioEngine_removeSong();
         audioEngine_stopAudioDrivers();
         audioEngine_destroy();
-        __kill_instruments();
     }
 
     Engine::~Engine()
@@ -931,8 +1079,20 @@ namespace Tritium
 
 
 
+    /**
+     * Publishes the song for the audio thread if it was modified
+     * (see SongSequencer::update()), hands its timeline to the
+     * transport, and returns once the audio
+     * thread is no longer using anything that was replaced while
+     * the lock was held.  The audio thread does not take the lock,
+     * so the lock only serializes the threads that edit the song.
+     */
     void Engine::unlock()
     {
+        if( d->m_SongSequencer.update() ) {
+            d->m_pTransport->set_timeline( d->m_SongSequencer.timeline() );
+        }
+        d->m_ProcessReader.synchronize();
         // Leave "d->__locker" dirty.
         d->__engine_mutex.unlock();
     }
@@ -1083,8 +1243,18 @@ namespace Tritium
 
 
 
-/// Export a song to a wav file, returns the elapsed time in mSec
+/// Export a song to a file with the default settings.  The format
+/// is chosen by the extension (see ExportSettings).
     void Engine::startExportSong( const QString& filename )
+    {
+        startExportSong( ExportSettings(filename) );
+    }
+
+
+
+/// Export a song to a file.  The engine renders offline until
+/// EVENT_PROGRESS reaches 100, then call stopExportSong().
+    void Engine::startExportSong( const ExportSettings& settings )
     {
         d->m_pTransport->stop();
 	T<Preferences>::shared_ptr pPref = get_preferences();
@@ -1094,27 +1264,57 @@ namespace Tritium
 
         d->m_pSong->set_mode( Song::SONG_MODE );
         d->m_pSong->set_loop_enabled( false );
-        unsigned nSamplerate = d->m_pAudioDriver->getSampleRate();
+
+        ExportSettings s(settings);
+        if( s.sample_rate == 0 ) {
+            s.sample_rate = d->m_pAudioDriver ? d->m_pAudioDriver->getSampleRate() : 0;
+            if( s.sample_rate == 0 ) s.sample_rate = 48000;
+        }
+        if( s.block_size == 0 || s.block_size > MAX_BUFFER_SIZE ) {
+            s.block_size = MAX_BUFFER_SIZE;
+        }
 
         // stop all audio drivers
         d->audioEngine_stopAudioDrivers();
 
-        /*
-          FIXME: Questo codice fa davvero schifo....
-        */
+        TransportPosition pos;
+        d->m_pTransport->get_position(&pos);
+        d->m_nOldFrameRate = pos.frame_rate;
+        d->m_pTransport->set_frame_rate( s.sample_rate );
 
+        double song_frames = double(d->m_pSong->song_tick_count())
+            * s.sample_rate * 60.0
+            / d->m_pSong->get_bpm()
+            / d->m_pSong->get_resolution();
 
-        d->m_pAudioDriver.reset( new DiskWriterDriver( d->m_engine, engine_process_callback, d, nSamplerate, filename ) );
+        d->audioEngine_setAudioDriver( T<AudioOutput>::shared_ptr(
+                                           new ExportDriver( d->m_engine,
+                                                             engine_process_callback,
+                                                             d,
+                                                             s,
+                                                             uint32_t(ceil(song_frames)) ) ) );
 
         get_sampler()->stop_playing_notes();
 
+        // Render the samples at the export rate without resampling.
+        d->audioEngine_matchSampleRate( s.sample_rate );
+
+        // Offline, the render threads don't compete with an audio
+        // thread, so use all CPUs unless told otherwise.
+        int threads = s.render_threads;
+        if( threads < 0 ) {
+            threads = QThread::idealThreadCount() - 1;
+            if( threads < 0 ) threads = 0;
+        }
+        get_sampler()->set_render_threads( threads );
+
         // reset
         d->m_pTransport->locate( 0 );
 
-        int res = d->m_pAudioDriver->init( pPref->m_nBufferSize );
+        int res = d->m_pAudioDriver->init( s.block_size );
         if ( res != 0 ) {
-            ERRORLOG( "Error starting disk writer driver "
-                      "[DiskWriterDriver::init()]" );
+            ERRORLOG( "Error starting export driver "
+                      "[ExportDriver::init()]" );
         }
 
         d->m_pMainBuffer_L = d->m_pAudioDriver->getOut_L();
@@ -1124,18 +1324,33 @@ namespace Tritium
 
         d->m_pTransport->locate(0);
 
+        // audioEngine_process() does nothing unless READY.
+        d->m_audioEngineState = Engine::StateReady;
+
         res = d->m_pAudioDriver->connect();
         if ( res != 0 ) {
-            ERRORLOG( "Error starting disk writer driver "
-                      "[DiskWriterDriver::connect()]" );
+            ERRORLOG( "Error starting export driver "
+                      "[ExportDriver::connect()]" );
         }
     }
 
 
 
+    bool Engine::getExportStatus( ExportStatus& status )
+    {
+        ExportDriver* drv = dynamic_cast<ExportDriver*>(d->m_pAudioDriver.get());
+        if ( ! drv ) {
+            return false;
+        }
+        drv->get_status( status );
+        return true;
+    }
+
+
+
     void Engine::stopExportSong()
     {
-        if ( ! dynamic_cast<DiskWriterDriver*>(d->m_pAudioDriver.get()) ) {
+        if ( ! dynamic_cast<ExportDriver*>(d->m_pAudioDriver.get()) ) {
             return;
         }
 
@@ -1143,7 +1358,7 @@ namespace Tritium
         d->m_pAudioDriver->disconnect();
 
         d->m_audioEngineState = Engine::StateInitialized;
-	d->m_pAudioDriver.reset();
+	d->audioEngine_setAudioDriver( T<AudioOutput>::shared_ptr() );
 
         d->m_pMainBuffer_L = NULL;
         d->m_pMainBuffer_R = NULL;
@@ -1151,6 +1366,12 @@ namespace Tritium
         d->m_pSong->set_mode( d->m_oldEngineMode );
         d->m_pSong->set_loop_enabled( d->m_bOldLoopEnabled );
 
+        d->m_pTransport->set_frame_rate( d->m_nOldFrameRate );
+        T<Preferences>::shared_ptr pPref = get_preferences();
+        get_sampler()->set_render_threads( pPref->m_nRenderThreads,
+                                           pPref->m_nRenderThreadPriority,
+                                           pPref->m_bRenderThreadAffinity );
+
         d->audioEngine_startAudioDrivers();
 
     }
@@ -1206,6 +1427,40 @@ namespace Tritium
 
 
 
+    unsigned EnginePrivate::audioEngine_getXRuns()
+    {
+#ifdef JACK_SUPPORT
+        return JackOutput::getXRuns();
+#else
+        return 0;
+#endif
+    }
+
+
+
+    void Engine::get_process_profile( ProcessProfile& profile )
+    {
+        d->m_profiler.get( profile );
+        profile.xruns = d->audioEngine_getXRuns() - d->m_nXRunsAtReset;
+    }
+
+
+
+    void Engine::reset_process_profile()
+    {
+        d->m_profiler.reset();
+        d->m_nXRunsAtReset = d->audioEngine_getXRuns();
+    }
+
+
+
+    void Engine::set_instrument_profiling( bool enabled )
+    {
+        get_sampler()->set_profiling( enabled );
+    }
+
+
+
     int Engine::loadDrumkit( T<Drumkit>::shared_ptr drumkitInfo )
     {
         Engine::state_t old_ae_state = d->m_audioEngineState;
@@ -1250,6 +1505,23 @@ namespace Tritium
         //needed for the new delete function
         int instrumentDiff =  currInstrList->get_size() - pDrumkitInstrList->get_size();
 
+        // Decode all the samples first, without the lock.
+        DrumkitLoader loader(this);
+        for ( unsigned nInstr = 0; nInstr < pDrumkitInstrList->get_size(); ++nInstr ) {
+            T<Instrument>::shared_ptr pNewInstr = pDrumkitInstrList->get( nInstr );
+            assert( pNewInstr );
+            loader.add( pNewInstr );
+        }
+        DEBUGLOG( QString( "Loading %1 instruments" )
+                  .arg( pDrumkitInstrList->get_size() ) );
+        loader.load();
+
+        // Then swap them in all at once.  The old layers and
+        // envelopes are handed to the reaper after unlocking.
+        std::vector<InstrumentLayer*> old_layers;
+        std::vector<ADSR*> old_adsrs;
+        InstrumentLayer* layers[MAX_LAYERS];
+        lock( RIGHT_HERE );
         for ( unsigned nInstr = 0; nInstr < pDrumkitInstrList->get_size(); ++nInstr ) {
             T<Instrument>::shared_ptr pInstr;
             if ( nInstr < currInstrList->get_size() ) {
@@ -1258,23 +1530,23 @@ namespace Tritium
                 assert( pInstr );
             } else {
                 pInstr = Instrument::create_empty();
-                // The instrument isn't playing yet; no need for locking
-                // :-) - Jakob Lund.  lock(
-                // "Engine::loadDrumkit" );
-                currInstrList->add( pInstr );
-                // unlock();
+                d->m_sampler->add_instrument( pInstr );
             }
 
-            T<Instrument>::shared_ptr pNewInstr = pDrumkitInstrList->get( nInstr );
-            assert( pNewInstr );
-            DEBUGLOG( QString( "Loading instrument (%1 of %2) [%3]" )
-                     .arg( nInstr )
-                     .arg( pDrumkitInstrList->get_size() )
-                     .arg( pNewInstr->get_name() ) );
+            loader.take_layers( nInstr, layers );
+            old_adsrs.push_back( pInstr->swap_from_placeholder( pDrumkitInstrList->get( nInstr ), layers ) );
+            old_layers.insert( old_layers.end(), layers, layers + MAX_LAYERS );
+        }
+        unlock();
 
-            // creo i nuovi layer in base al nuovo strumento
-            // Moved code from here right into the Instrument class - Jakob Lund.
-            pInstr->load_from_placeholder( this, pNewInstr );
+        T<Reaper>::shared_ptr reaper = d->m_sampler->get_reaper();
+        for ( size_t k = 0; k < old_layers.size(); ++k ) {
+            if ( old_layers[k] ) {
+                reaper->defer( old_layers[k], old_layers[k]->get_sample_bytes() );
+            }
+        }
+        for ( size_t k = 0; k < old_adsrs.size(); ++k ) {
+            reaper->defer( old_adsrs[k] );
         }
 
 
@@ -1328,16 +1600,24 @@ namespace Tritium
         T<Song>::shared_ptr pSong = getSong();
         T<InstrumentList>::shared_ptr pList = d->m_sampler->get_instrument_list();
         if(pList->get_size()==1){
+            InstrumentLayer* old_layers[MAX_LAYERS];
             lock( RIGHT_HERE );
             T<Instrument>::shared_ptr zInstr = pList->get( 0 );
             zInstr->set_name( (QString( "Instrument 1" )) );
             // remove all layers
             for ( int nLayer = 0; nLayer < MAX_LAYERS; nLayer++ ) {
-                InstrumentLayer* pLayer = zInstr->get_layer( nLayer );
-                delete pLayer;
+                old_layers[ nLayer ] = zInstr->get_layer( nLayer );
                 zInstr->set_layer( NULL, nLayer );
             }
             unlock();
+            for ( int nLayer = 0; nLayer < MAX_LAYERS; nLayer++ ) {
+                if ( old_layers[ nLayer ] ) {
+                    d->m_sampler->get_reaper()->defer(
+                        old_layers[ nLayer ],
+                        old_layers[ nLayer ]->get_sample_bytes()
+                        );
+                }
+            }
             get_event_queue()->push_event( EVENT_SELECTED_INSTRUMENT_CHANGED, -1 );
             DEBUGLOG("clear last instrument to empty instrument 1 instead delete the last instrument");
             return;
@@ -1350,19 +1630,14 @@ namespace Tritium
         }
         // delete the instrument from the instruments list
         lock( RIGHT_HERE );
-        pList->del( instrumentnumber );
+        d->m_sampler->remove_instrument( pInstr );
         getSong()->set_modified(true);
         unlock();
 
         // At this point the instrument has been removed from both the
-        // instrument list and every pattern in the song.  Hence there's no way
-        // (NOTE) to play on that instrument, and once all notes have stopped
-        // playing it will be save to delete.
-        // the ugly name is just for debugging...
-        QString xxx_name = QString( "XXX_%1" ) . arg( pInstr->get_name() );
-        pInstr->set_name( xxx_name );
-        d->__instrument_death_row.push_back( pInstr );
-        d->__kill_instruments(); // checks if there are still notes.
+        // instrument list and every pattern in the song.  The sampler's
+        // reaper deletes it once the notes that are still queued or
+        // playing let go of it (see Sampler::remove_instrument()).
 
         // this will force a GUI update.
         get_event_queue()->push_event( EVENT_SELECTED_INSTRUMENT_CHANGED, -1 );
@@ -1539,15 +1814,7 @@ namespace Tritium
 #ifdef JACK_SUPPORT
     void Engine::renameJackPorts()
     {
-        if( get_preferences()->m_bJackTrackOuts == true ){
-            d->audioEngine_renameJackPorts();
-	    d->m_sampler->set_per_instrument_outs(true);
-	    d->m_sampler->set_per_instrument_outs_prefader(
-		get_preferences()->m_nJackTrackOutputMode == Preferences::PRE_FADER
-		);
-        } else {
-	    d->m_sampler->set_per_instrument_outs(false);
-	}
+        d->audioEngine_renameJackPorts();
     }
 #endif
 
@@ -1644,42 +1911,11 @@ namespace Tritium
     {
         EnginePrivate *d = static_cast<EnginePrivate*>(arg);
         JackMidiDriver* instance =
-            dynamic_cast<JackMidiDriver*>(d->m_pMidiDriver.get());
-        return instance->processNonAudio(nframes);
+            dynamic_cast<JackMidiDriver*>(d->m_pMidiInput.fetchAndAddAcquire(0));
+        return instance ? instance->processNonAudio(nframes) : 0;
     }
 #endif
 
-    void EnginePrivate::__kill_instruments()
-    {
-	// TODO: Deleting all instruments can be done with
-	// simply __instrument_death_row.clear().  But,
-	// apparently notes get added to this list before
-	// they should /actually/ be deleted.... thus the
-	// check for pInstr->is_queued().
-        int c = 0;
-        T<Instrument>::shared_ptr pInstr;
-        while ( __instrument_death_row.size()
-                && __instrument_death_row.front()->is_queued() == 0 ) {
-            pInstr = __instrument_death_row.front();
-            __instrument_death_row.pop_front();
-            DEBUGLOG( QString( "Deleting unused instrument (%1). "
-                              "%2 unused remain." )
-                     . arg( pInstr->get_name() )
-                     . arg( __instrument_death_row.size() ) );
-            pInstr.reset();
-            c++;
-        }
-        if ( __instrument_death_row.size() ) {
-            pInstr = __instrument_death_row.front();
-            DEBUGLOG( QString( "Instrument %1 still has %2 active notes. "
-                              "Delaying 'delete instrument' operation." )
-                     . arg( pInstr->get_name() )
-                     . arg( pInstr->is_queued() ) );
-        }
-    }
-
-
-
     void Engine::__panic()
     {
         sequencer_stop();
@@ -25,6 +25,10 @@
 #include "transport/H2Transport.hpp"
 #include "BeatCounter.hpp"
 #include "SongSequencer.hpp"
+#include "ProcessProfiler.hpp"
+#include "RtSnapshot.hpp"
+#include "WorkerThread.hpp"
+#include "MpscRing.hpp"
 
 #include <Tritium/Transport.hpp>
 #include <Tritium/SeqEvent.hpp>
@@ -34,6 +38,9 @@
 #include <Tritium/memory.hpp>
 
 #include <QMutex>
+#include <QAtomicInt>
+#include <QAtomicPointer>
+#include <vector>
 
 namespace Tritium
 {
@@ -47,18 +54,27 @@ namespace Tritium
      * input will probably use it temporarily.
      *
      * It provides a process() method that allows the events to be given
-     * to the master sequencer queue.
+     * to the master sequencer queue.  The events are kept in a
+     * lock-free ring, so process() may be called from the audio
+     * thread.  When the ring is full, new events are dropped.
      */
     class GuiInputQueue
     {
     private:
-        typedef std::list<SeqEvent> EvList;
+	enum { CAPACITY = 1024 };
+	typedef std::vector<SeqEvent> EvList;
 	Engine *m_engine;
-        EvList __events;
-        QMutex __mutex;
+	MpscRing<SeqEvent> __ring;
+        EvList __events; // Only used in process()
 
     public:
-	GuiInputQueue(Engine* parent) : m_engine(parent) { assert(parent); }
+	GuiInputQueue(Engine* parent) :
+	    m_engine(parent),
+	    __ring(CAPACITY)
+	    {
+		assert(parent);
+		__events.reserve(__ring.capacity());
+	    }
 
         int process( SeqScript& seq, const TransportPosition& pos, uint32_t nframes ) {
             // Set up quantization.
@@ -82,51 +98,55 @@ namespace Tritium
                 quant_frame = quant.frame - pos.frame;
             }
 
+            // Take at most one ring's worth, so that __events never
+            // grows.  A panic() drops the events before it.
+            SeqEvent ev;
+            unsigned k;
+            __events.clear();
+            for( k=0 ; k<__ring.capacity() && __ring.pop(ev) ; ++k ) {
+                if( ev.type == SeqEvent::ALL_OFF && ev.instrument == 0 ) {
+                    __events.clear();
+                }
+                __events.push_back(ev);
+            }
+
             // Add events to 'seq'
-            QMutexLocker mx(&__mutex);
-            EvList::iterator k;
-            for( k=__events.begin() ; k!=__events.end() ; ++k ) {
-                if( k->quantize ) {
-                    k->frame = quant_frame;
+            EvList::iterator it;
+            for( it=__events.begin() ; it!=__events.end() ; ++it ) {
+                if( it->quantize ) {
+                    it->frame = quant_frame;
                 }
-                seq.insert(*k);
+                seq.insert(*it);
             }
-            __events.clear();
             return 0;
         }
 
         void note_on( const Note* pNote, bool quantize = false ) {
             SeqEvent ev;
-            QMutexLocker mx(&__mutex);
             ev.frame = 0;
             ev.type = SeqEvent::NOTE_ON;
-            ev.note = *pNote;
+            ev.set_note( *pNote );
             ev.quantize = quantize;
-            __events.push_back(ev);
+            __ring.push(ev);
         }
 
         void note_off( const Note* pNote, bool quantize = false ) {
             SeqEvent ev;
-            QMutexLocker mx(&__mutex);
             ev.frame = 0;
             ev.type = SeqEvent::NOTE_OFF;
-            ev.note = *pNote;
+            ev.set_note( *pNote );
             ev.quantize = quantize;
-            __events.push_back(ev);
+            __ring.push(ev);
         }
 
+        /// Drops the events that are still queued and sends an
+        /// ALL_OFF for every instrument.
         void panic() {
             SeqEvent ev;
-            QMutexLocker mx(&__mutex);
-            __events.clear();
             ev.frame = 0;
             ev.type = SeqEvent::ALL_OFF;
-            __events.push_front(ev);
-        }
-
-        void clear() {
-            QMutexLocker mx(&__mutex);
-            __events.clear();
+            ev.instrument = 0;
+            __ring.push(ev);
         }
 
     };
@@ -167,10 +187,12 @@ namespace Tritium
             int *patternStartTick );
 
         void audioEngine_restartAudioDrivers();
+        void audioEngine_setAudioDriver( T<AudioOutput>::shared_ptr pDriver );
+        void audioEngine_setMidiDriver( T<MidiInput>::shared_ptr pDriver );
         void audioEngine_startAudioDrivers();
         void audioEngine_stopAudioDrivers();
-
-        void __kill_instruments();
+        void audioEngine_matchSampleRate( unsigned rate );
+        unsigned audioEngine_getXRuns();
 
         /////////////////////////////////////////
         // Stuff from the old Tritium::Engine
@@ -209,12 +231,7 @@ namespace Tritium
         // used for song export
         Song::SongMode m_oldEngineMode;
         bool m_bOldLoopEnabled;
-
-        /**
-         * In some cases, deleting a large list of instruments is not
-         * realtime safe.
-         */
-        std::list< T<Instrument>::shared_ptr > __instrument_death_row;
+        uint32_t m_nOldFrameRate;
 
         /////////////////////////////////////////
         // Old Global Varibles from Engine.cpp
@@ -224,6 +241,8 @@ namespace Tritium
         float m_fMasterPeak_R;           ///< Master peak (right channel)
         float m_fProcessTime;            ///< time used in process function
         float m_fMaxProcessTime;         ///< max ms usable in process with no xrun
+        ProcessProfiler m_profiler;      ///< Times the stages of process()
+        unsigned m_nXRunsAtReset;        ///< Driver xruns at the last profile reset
 
 	T<Preferences>::shared_ptr m_preferences;
 	T<ActionManager>::shared_ptr m_action_manager;
@@ -242,15 +261,18 @@ namespace Tritium
         // This is *the* priority queue for scheduling notes/events to be
         // sent to the Sampler.
         SeqScript m_queue;
+        QAtomicInt m_nClearNoteQueue;    ///< Ask the audio thread to clear m_queue
         GuiInputQueue m_GuiInput;
         SongSequencer m_SongSequencer;
+        WorkerThread m_SnapshotThread;   ///< Runs the SongPublisher
+        RtReader m_ProcessReader;        ///< The audio thread's process() cycles
 
         BeatCounter m_BeatCounter;
 
 	T<AudioOutput>::shared_ptr m_pAudioDriver;     ///< Audio output
 	T<MidiInput>::shared_ptr m_pMidiDriver;        ///< MIDI input
-        QMutex mutex_OutputPointer;             ///< Mutex for audio output pointer, allows multiple readers
-        ///< When locking this AND AudioEngine, always lock AudioEngine first.
+        QAtomicPointer<AudioOutput> m_pOutput;  ///< m_pAudioDriver, for the process callback
+        QAtomicPointer<MidiInput> m_pMidiInput; ///< m_pMidiDriver, for the process callback
 
 
 	T<Song>::shared_ptr m_pSong;                          ///< Current song
@@ -289,11 +311,12 @@ namespace Tritium
 	    __engine_mutex(),
 	    m_oldEngineMode(Song::SONG_MODE),
 	    m_bOldLoopEnabled(false),
-	    __instrument_death_row(),
 	    m_fMasterPeak_L(0.0),
 	    m_fMasterPeak_R(0.0),
 	    m_fProcessTime(0.0),
 	    m_fMaxProcessTime(0.0),
+	    m_profiler(),
+	    m_nXRunsAtReset(0),
 	    m_preferences(prefs),
 	    m_action_manager(),
 	    m_sampler(),
@@ -307,12 +330,16 @@ namespace Tritium
 	    m_effects(),
 #endif
 	    m_queue(),
+	    m_nClearNoteQueue(0),
 	    m_GuiInput(parent),
 	    m_SongSequencer(),
+	    m_SnapshotThread(),
+	    m_ProcessReader(),
 	    m_BeatCounter(parent),
 	    m_pAudioDriver(),
 	    m_pMidiDriver(),
-	    mutex_OutputPointer(),
+	    m_pOutput(0),
+	    m_pMidiInput(0),
 	    m_pSong(),
 	    m_pMetronomeInstrument(),
 	    m_nFreeRollingFrameCounter(0),
@@ -20,50 +20,114 @@
  */
 
 #include <Tritium/EventQueue.hpp>
+#include "ProcessProfiler.hpp"
+#include "MpscRing.hpp"
+
+#include <QAtomicInt>
 
 namespace Tritium
 {
 
-EventQueue::EventQueue()
-		: __read_index( 0 )
-		, __write_index( 0 )
+class EventQueuePrivate
+{
+public:
+	MpscRing<Event> __ring;
+	QAtomicInt __dropped;
+	QAtomicInt __dropped_type[ EVENT_COUNT ];
+	QAtomicInt __coalesced[ EVENT_COUNT ]; // Events folded into the waiting one
+
+	EventQueuePrivate( unsigned capacity ) :
+		__ring( capacity ),
+		__dropped( 0 )
+	{
+	}
+
+	static bool coalesces( EventType type ) {
+		return type == EVENT_MIDI_ACTIVITY || type == EVENT_XRUN;
+	}
+
+	void drop( EventType type, unsigned count );
+};
+
+void EventQueuePrivate::drop( EventType type, unsigned count )
 {
-	for ( int i = 0; i < MAX_EVENTS; ++i ) {
-		__events_buffer[ i ].type = EVENT_NONE;
-		__events_buffer[ i ].value = 0;
+	__dropped.fetchAndAddRelaxed( count );
+	if ( type >= 0 && type < EVENT_COUNT ) {
+		__dropped_type[ type ].fetchAndAddRelaxed( count );
 	}
 }
 
+EventQueue::EventQueue( unsigned capacity )
+	: d( new EventQueuePrivate( capacity ) )
+{
+}
+
 
 EventQueue::~EventQueue()
 {
+	delete d;
 }
 
 
-void EventQueue::push_event( EventType type, int nValue )
+bool EventQueue::push_event( EventType type, int nValue )
 {
-	int nIndex = ++__write_index;
-	nIndex = nIndex % MAX_EVENTS;
-//	infoLog( "[pushEvent] " + toString( nIndex ) );
-	Event ev;
-	ev.type = type;
-	ev.value = nValue;
-	__events_buffer[ nIndex ] = ev;
+	return push_event( Event( type, nValue ) );
+}
+
+
+bool EventQueue::push_event( const Event& ev )
+{
+	Event e( ev );
+	e.time = ProcessProfiler::now();
+
+	if ( ! EventQueuePrivate::coalesces( e.type ) ) {
+		if ( d->__ring.push( e ) ) return true;
+		d->drop( e.type, 1 );
+		return false;
+	}
+
+	// Only the first one (since the last pop) goes in the queue.
+	QAtomicInt& pending = d->__coalesced[ e.type ];
+	if ( pending.fetchAndAddOrdered( 1 ) > 0 ) {
+		return true;
+	}
+	if ( d->__ring.push( e ) ) return true;
+
+	// Nothing is waiting, so the ones that were folded in are lost.
+	d->drop( e.type, pending.fetchAndStoreOrdered( 0 ) );
+	return false;
 }
 
 
 Event EventQueue::pop_event()
 {
-	if ( __read_index == __write_index ) {
-		Event ev;
-		ev.type = EVENT_NONE;
-		ev.value = 0;
-		return ev;
+	Event ev;
+	if ( ! d->__ring.pop( ev ) ) {
+		return Event();
+	}
+	if ( EventQueuePrivate::coalesces( ev.type ) ) {
+		ev.count = d->__coalesced[ ev.type ].fetchAndStoreOrdered( 0 );
 	}
-	int nIndex = ++__read_index;
-	nIndex = nIndex % MAX_EVENTS;
-//	infoLog( "[popEvent] " + toString( nIndex ) );
-	return __events_buffer[ nIndex ];
+	return ev;
 }
 
-};
+
+unsigned EventQueue::get_capacity()
+{
+	return d->__ring.capacity();
+}
+
+
+unsigned EventQueue::get_dropped()
+{
+	return d->__dropped.fetchAndAddRelaxed( 0 );
+}
+
+
+unsigned EventQueue::get_dropped( EventType type )
+{
+	if ( type < 0 || type >= EVENT_COUNT ) return 0;
+	return d->__dropped_type[ type ].fetchAndAddRelaxed( 0 );
+}
+
+} // namespace Tritium
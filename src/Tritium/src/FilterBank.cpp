@@ -0,0 +1,157 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "FilterBank.hpp"
+#include <cassert>
+#include <cstring>
+
+using namespace Tritium;
+
+// A coefficient sweeps its whole range (0..1) in 256 frames, about
+// 5 ms at 48 kHz.
+const float FilterBank::SLEW = 1.0f / 256.0f;
+
+FilterBank::FilterBank(size_t voices) :
+    _bp(2 * voices, 0.0f),
+    _lp(2 * voices, 0.0f),
+    _cut(voices, 0.0f),
+    _res(voices, 0.0f),
+    _fresh(voices, 1)
+{
+}
+
+void FilterBank::reset(int v)
+{
+    _bp[2*v] = _bp[2*v + 1] = 0.0f;
+    _lp[2*v] = _lp[2*v + 1] = 0.0f;
+    _fresh[v] = 1;
+}
+
+FilterBank::Group::Group(FilterBank& bank) :
+    _bank(bank),
+    _count(0)
+{
+    for( unsigned j=0 ; j<LANES ; ++j ) {
+	_bp[j] = _lp[j] = 0.0f;
+	_cut[j] = _res[j] = 0.0f;
+	_cut_target[j] = _res_target[j] = 0.0f;
+    }
+}
+
+FilterBank::Group::~Group()
+{
+    int v;
+    for( unsigned j=0 ; j<_count ; ++j ) {
+	v = _voice[j];
+	_bank._bp[2*v] = _bp[2*j];
+	_bank._bp[2*v + 1] = _bp[2*j + 1];
+	_bank._lp[2*v] = _lp[2*j];
+	_bank._lp[2*v + 1] = _lp[2*j + 1];
+	_bank._cut[v] = _cut[2*j];
+	_bank._res[v] = _res[2*j];
+	_bank._fresh[v] = 0;
+    }
+}
+
+unsigned FilterBank::Group::add(int v, float cutoff, float resonance)
+{
+    assert( ! full() );
+    unsigned j = _count++;
+    unsigned L = 2*j, R = 2*j + 1;
+
+    _voice[j] = v;
+    _bp[L] = _bank._bp[2*v];
+    _bp[R] = _bank._bp[2*v + 1];
+    _lp[L] = _bank._lp[2*v];
+    _lp[R] = _bank._lp[2*v + 1];
+    if( _bank._fresh[v] ) {
+	_cut[L] = _cut[R] = cutoff;
+	_res[L] = _res[R] = resonance;
+    } else {
+	_cut[L] = _cut[R] = _bank._cut[v];
+	_res[L] = _res[R] = _bank._res[v];
+    }
+    _cut_target[L] = _cut_target[R] = cutoff;
+    _res_target[L] = _res_target[R] = resonance;
+    return j;
+}
+
+void FilterBank::Group::clear(uint32_t nframes)
+{
+    assert( nframes <= VoiceKernels::BLOCK_SIZE );
+    memset( _x, 0, nframes * LANES * sizeof(float) );
+}
+
+void FilterBank::Group::write(unsigned j,
+			      uint32_t pos,
+			      const float* in_L,
+			      const float* in_R,
+			      const float* env,
+			      uint32_t n)
+{
+    assert( pos + n <= VoiceKernels::BLOCK_SIZE );
+    float *x = &_x[pos * LANES + 2*j];
+    for( uint32_t k=0 ; k<n ; ++k, x += LANES ) {
+	x[0] = in_L[k] * env[k];
+	x[1] = in_R[k] * env[k];
+    }
+}
+
+// Move 'from' towards 'target' by at most 'max'.
+static float glide(float from, float target, float max)
+{
+    if( target > from + max ) return from + max;
+    if( target < from - max ) return from - max;
+    return target;
+}
+
+void FilterBank::Group::run(uint32_t nframes)
+{
+    if( _count == 0 || nframes == 0 ) return;
+
+    const float max = SLEW * float(nframes);
+    float cut[LANES], res[LANES];
+    unsigned j;
+
+    for( j=0 ; j<LANES ; ++j ) {
+	cut[j] = glide( _cut[j], _cut_target[j], max );
+	res[j] = glide( _res[j], _res_target[j], max );
+    }
+    VoiceKernels::low_pass( _x, nframes, _bp, _lp, _cut, cut, _res, res );
+    for( j=0 ; j<LANES ; ++j ) {
+	_cut[j] = cut[j];
+	_res[j] = res[j];
+    }
+}
+
+void FilterBank::Group::read(unsigned j,
+			     uint32_t pos,
+			     float* out_L,
+			     float* out_R,
+			     uint32_t n) const
+{
+    assert( pos + n <= VoiceKernels::BLOCK_SIZE );
+    const float *x = &_x[pos * LANES + 2*j];
+    for( uint32_t k=0 ; k<n ; ++k, x += LANES ) {
+	out_L[k] = x[0];
+	out_R[k] = x[1];
+    }
+}
@@ -0,0 +1,143 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+#ifndef TRITIUM_FILTERBANK_HPP
+#define TRITIUM_FILTERBANK_HPP
+
+#include "VoiceKernels.hpp"
+#include <vector>
+#include <cstddef>
+
+namespace Tritium
+{
+    /**
+     * \brief Resonant low pass filters of the Sampler's voices.
+     *
+     * The filter state of every voice (by VoicePool index) is kept
+     * here in structure-of-arrays form.  The voices are filtered a
+     * Group at a time: a Group gathers the state of up to VOICES
+     * stereo voices into the lanes of VoiceKernels::low_pass(), so
+     * that all of them are filtered in the same pass.
+     *
+     * When an instrument's cutoff or resonance changes, the
+     * coefficients of its voices glide to the new values (at most
+     * SLEW per frame) instead of jumping.
+     *
+     * Different voices may be in Groups on different threads.  A
+     * voice must not be in two Groups at once.
+     */
+    class FilterBank
+    {
+    public:
+	enum {
+	    LANES = VoiceKernels::FILTER_LANES,
+	    VOICES = LANES / 2   ///< Stereo voices per Group
+	};
+
+	/// Largest change of a coefficient per frame.
+	static const float SLEW;
+
+	FilterBank(size_t voices);
+
+	/**
+	 * Clear the filter of voice v for a new note.  Its
+	 * coefficients start at the values it is first filtered
+	 * with.
+	 */
+	void reset(int v);
+
+	/**
+	 * \brief The filters of a few voices, for one process() cycle.
+	 *
+	 * Voices are added with add().  Then, for each window of up
+	 * to VoiceKernels::BLOCK_SIZE frames: clear() the input,
+	 * write() the voices' input, run() the filters and read()
+	 * the output.  The state goes back to the FilterBank when
+	 * the Group is destroyed.
+	 *
+	 * A Group is meant to live on the stack of the thread that
+	 * renders its voices.
+	 */
+	class Group
+	{
+	public:
+	    Group(FilterBank& bank);
+	    ~Group();
+
+	    /**
+	     * Add voice v, to be filtered with 'cutoff' and
+	     * 'resonance'.  Returns its index in the Group.  Must
+	     * not be called if the Group is full().
+	     */
+	    unsigned add(int v, float cutoff, float resonance);
+	    unsigned size() const { return _count; }
+	    bool full() const { return _count >= VOICES; }
+	    int voice(unsigned j) const { return _voice[j]; }
+
+	    /// Zero the input of the first nframes frames.
+	    void clear(uint32_t nframes);
+
+	    /// Set the input of voice j, frames [pos, pos + n), to
+	    /// in * env.
+	    void write(unsigned j,
+		       uint32_t pos,
+		       const float* in_L,
+		       const float* in_R,
+		       const float* env,
+		       uint32_t n);
+
+	    /// Filter the first nframes frames (in place).
+	    void run(uint32_t nframes);
+
+	    /// Copy the output of voice j, frames [pos, pos + n).
+	    void read(unsigned j,
+		      uint32_t pos,
+		      float* out_L,
+		      float* out_R,
+		      uint32_t n) const;
+
+	private:
+	    FilterBank& _bank;
+	    int _voice[VOICES];
+	    unsigned _count;
+	    float _bp[LANES];
+	    float _lp[LANES];
+	    float _cut[LANES];       // Current coefficients
+	    float _res[LANES];
+	    float _cut_target[LANES];
+	    float _res_target[LANES];
+	    float _x[VoiceKernels::BLOCK_SIZE * LANES];
+	};
+
+    private:
+	friend class Group;
+
+	// Two lanes (left, right) per voice.
+	std::vector<float> _bp;
+	std::vector<float> _lp;
+	// One per voice.
+	std::vector<float> _cut;
+	std::vector<float> _res;
+	std::vector<char> _fresh;   // No coefficients yet
+    };
+
+} // namespace Tritium
+
+#endif // TRITIUM_FILTERBANK_HPP
@@ -0,0 +1,392 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "ExportDriver.hpp"
+
+#include <Tritium/Logger.hpp>
+#include <Tritium/EventQueue.hpp>
+#include <Tritium/Engine.hpp>
+#include <Tritium/Sampler.hpp>
+#include <Tritium/Transport.hpp>
+#include <Tritium/globals.hpp>
+
+#include <QThread>
+#include <sndfile.h>
+#include <vector>
+#include <cmath>
+#include <cstring>
+#include <cassert>
+#include <unistd.h> // usleep()
+
+namespace Tritium
+{
+
+namespace
+{
+	// -100 dB
+	const float SILENCE = 1.0e-5f;
+
+	void nap()
+	{
+		usleep(1000);
+	}
+} // anonymous namespace
+
+ExportSettings::ExportSettings( const QString& name )
+	: filename( name )
+	, format( WAV )
+	, sample_format( PCM_16 )
+	, sample_rate( 0 )
+	, block_size( 4096 )
+	, render_threads( -1 )
+	, tail_seconds( 10.0f )
+{
+	if ( name.endsWith( ".flac", Qt::CaseInsensitive ) ) {
+		format = FLAC;
+	}
+}
+
+class ExportDriver::Renderer : public QThread
+{
+public:
+	Renderer( ExportDriver* parent ) : _parent( parent ) {}
+	void run() {
+		_parent->render();
+	}
+private:
+	ExportDriver* _parent;
+};
+
+class ExportDriver::Writer : public QThread
+{
+public:
+	Writer( ExportDriver* parent ) : _parent( parent ) {}
+	void run() {
+		_parent->write();
+	}
+private:
+	ExportDriver* _parent;
+};
+
+ExportDriver::ExportDriver(
+	Engine* parent,
+	audioProcessCallback processCallback,
+	void* arg,
+	const ExportSettings& settings,
+	uint32_t song_frames )
+		: AudioOutput( parent )
+		, m_processCallback( processCallback )
+		, m_processCallback_arg( arg )
+		, m_settings( settings )
+		, m_nSongFrames( song_frames )
+		, m_nBufferSize( 0 )
+		, m_pOut_L( 0 )
+		, m_pOut_R( 0 )
+		, m_renderer( 0 )
+		, m_writer( 0 )
+		, m_bAbort( false )
+		, m_rendered( 0 )
+		, m_finished( 0 )
+		, m_failed( 0 )
+		, m_frames_written( 0 )
+		, m_fPeak_L( 0.0f )
+		, m_fPeak_R( 0.0f )
+{
+	DEBUGLOG( "INIT" );
+	assert( parent );
+	assert( m_settings.sample_rate > 0 );
+}
+
+ExportDriver::~ExportDriver()
+{
+	DEBUGLOG( "DESTROY" );
+	if ( m_renderer || m_writer ) {
+		disconnect();
+	}
+	delete[] m_pOut_L;
+	delete[] m_pOut_R;
+}
+
+int ExportDriver::init( unsigned nBufferSize )
+{
+	DEBUGLOG( QString( "Init, %1 samples" ).arg( nBufferSize ) );
+
+	if ( nBufferSize == 0 || nBufferSize > MAX_BUFFER_SIZE ) {
+		ERRORLOG( QString( "Invalid export block size %1" ).arg( nBufferSize ) );
+		return 1;
+	}
+
+	m_nBufferSize = nBufferSize;
+	delete[] m_pOut_L;
+	delete[] m_pOut_R;
+	m_pOut_L = new float[nBufferSize];
+	m_pOut_R = new float[nBufferSize];
+	memset( m_pOut_L, 0, nBufferSize * sizeof( float ) );
+	memset( m_pOut_R, 0, nBufferSize * sizeof( float ) );
+
+	// Room for several blocks, so that the render thread seldom
+	// waits for the disk.
+	m_ring_L.reset( new RingBuffer<float>( nBufferSize * 8 ) );
+	m_ring_R.reset( new RingBuffer<float>( nBufferSize * 8 ) );
+
+	return 0;
+}
+
+///
+/// Connect
+/// return 0: Ok
+///
+int ExportDriver::connect()
+{
+	DEBUGLOG( "[connect]" );
+
+	if ( m_nBufferSize == 0 ) {
+		ERRORLOG( "init() was not called" );
+		return 1;
+	}
+
+	m_writer = new Writer( this );
+	m_writer->start();
+	m_renderer = new Renderer( this );
+	m_renderer->start();
+
+	return 0;
+}
+
+/// disconnect.  Stops the export if it is not finished.
+void ExportDriver::disconnect()
+{
+	DEBUGLOG( "[disconnect]" );
+
+	m_bAbort = true;
+	if ( m_renderer ) {
+		m_renderer->wait();
+		delete m_renderer;
+		m_renderer = 0;
+	}
+	if ( m_writer ) {
+		m_writer->wait();
+		delete m_writer;
+		m_writer = 0;
+	}
+}
+
+int ExportDriver::sf_format( const ExportSettings& settings )
+{
+	int format = ( settings.format == ExportSettings::FLAC ) ? SF_FORMAT_FLAC : SF_FORMAT_WAV;
+
+	switch ( settings.sample_format ) {
+	case ExportSettings::PCM_24:
+		return format | SF_FORMAT_PCM_24;
+	case ExportSettings::FLOAT:
+		if ( settings.format == ExportSettings::FLAC ) {
+			WARNINGLOG( "FLAC can not store float samples, exporting 24-bit" );
+			return format | SF_FORMAT_PCM_24;
+		}
+		return format | SF_FORMAT_FLOAT;
+	case ExportSettings::PCM_16:
+	default:
+		return format | SF_FORMAT_PCM_16;
+	}
+}
+
+void ExportDriver::get_status( ExportStatus& status )
+{
+	status.finished = finished();
+	status.failed = failed();
+	status.frames = frames_written();
+	status.song_frames = m_nSongFrames;
+	status.peak_L = m_fPeak_L;
+	status.peak_R = m_fPeak_R;
+}
+
+bool ExportDriver::is_silent( uint32_t nFrames )
+{
+	for ( uint32_t i = 0; i < nFrames; ++i ) {
+		if ( fabsf( m_pOut_L[i] ) > SILENCE || fabsf( m_pOut_R[i] ) > SILENCE ) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * Render thread.  Runs the engine until the end of the song plus
+ * the tail and hands the blocks to the writer thread.
+ */
+void ExportDriver::render()
+{
+	DEBUGLOG( "ExportDriver render thread start" );
+	T<Transport>::shared_ptr xport = m_engine->get_transport();
+	T<Sampler>::shared_ptr sampler = m_engine->get_sampler();
+	uint32_t tail_frames = 0;
+	uint32_t done = 0;
+	uint32_t limit = m_nSongFrames;
+	uint32_t nFrames;
+	bool tail = false;
+	int percent, last_percent = -1;
+
+	if ( m_settings.tail_seconds > 0 ) {
+		tail_frames = uint32_t( m_settings.tail_seconds * m_settings.sample_rate );
+	}
+
+	xport->locate( 0 );
+	xport->start();
+
+	while ( ! m_bAbort && ! m_failed.fetchAndAddAcquire( 0 ) ) {
+		if ( ! tail && done >= m_nSongFrames ) {
+			// Past the last bar.  No new notes, but the voices
+			// and effects ring out.
+			xport->stop();
+			tail = true;
+			limit = m_nSongFrames + tail_frames;
+		}
+		if ( done >= limit ) {
+			break;
+		}
+
+		nFrames = limit - done;
+		if ( nFrames > m_nBufferSize ) {
+			nFrames = m_nBufferSize;
+		}
+
+		m_processCallback( nFrames, m_processCallback_arg );
+
+		if ( tail
+		     && sampler->get_playing_notes_number() == 0
+		     && is_silent( nFrames ) ) {
+			break;
+		}
+
+		while ( m_ring_R->write_space() < nFrames ) {
+			if ( m_bAbort || m_failed.fetchAndAddAcquire( 0 ) ) {
+				break;
+			}
+			nap();
+		}
+		if ( m_ring_R->write_space() < nFrames ) {
+			break;
+		}
+		// Left first: the writer goes by the right ring.
+		m_ring_L->write( m_pOut_L, nFrames );
+		m_ring_R->write( m_pOut_R, nFrames );
+		done += nFrames;
+
+		if ( m_nSongFrames > 0 && ! tail ) {
+			percent = int( uint64_t( done ) * 100 / m_nSongFrames );
+			if ( percent > 99 ) {
+				percent = 99;
+			}
+			if ( percent != last_percent ) {
+				m_engine->get_event_queue()->push_event( EVENT_PROGRESS, percent );
+				last_percent = percent;
+			}
+		}
+	}
+
+	xport->stop();
+	m_rendered.fetchAndStoreRelease( 1 );
+	DEBUGLOG( QString( "ExportDriver render thread end, %1 frames (%2 tail)" )
+		  .arg( done )
+		  .arg( tail ? done - m_nSongFrames : 0 ) );
+}
+
+/**
+ * Writer thread.  Writes the blocks from the ring buffers to the
+ * file until the render thread is done.
+ */
+void ExportDriver::write()
+{
+	DEBUGLOG( "ExportDriver writer thread start" );
+	SF_INFO info;
+	memset( &info, 0, sizeof( info ) );
+	info.samplerate = m_settings.sample_rate;
+	info.channels = 2;
+	info.format = sf_format( m_settings );
+
+	SNDFILE* file = 0;
+	if ( ! sf_format_check( &info ) ) {
+		ERRORLOG( QString( "Can not export to this format (0x%1, %2 Hz)" )
+			  .arg( info.format, 0, 16 )
+			  .arg( info.samplerate ) );
+	} else {
+		file = sf_open( m_settings.filename.toLocal8Bit(), SFM_WRITE, &info );
+		if ( ! file ) {
+			ERRORLOG( QString( "Could not open %1 for export: %2" )
+				  .arg( m_settings.filename )
+				  .arg( sf_strerror( 0 ) ) );
+		}
+	}
+
+	if ( file ) {
+		if ( ( info.format & SF_FORMAT_SUBMASK ) != SF_FORMAT_FLOAT ) {
+			sf_command( file, SFC_SET_CLIPPING, 0, SF_TRUE );
+		}
+
+		std::vector<float> buf_L( m_nBufferSize );
+		std::vector<float> buf_R( m_nBufferSize );
+		std::vector<float> frames( m_nBufferSize * 2 );
+		uint32_t n, k;
+		bool last;
+
+		while ( ! m_bAbort ) {
+			last = m_rendered.fetchAndAddAcquire( 0 );
+			n = m_ring_R->read_space();
+			if ( n == 0 ) {
+				if ( last ) {
+					break;
+				}
+				nap();
+				continue;
+			}
+			if ( n > m_nBufferSize ) {
+				n = m_nBufferSize;
+			}
+			m_ring_L->read( &buf_L[0], n );
+			m_ring_R->read( &buf_R[0], n );
+			for ( k = 0; k < n; ++k ) {
+				frames[k * 2] = buf_L[k];
+				frames[k * 2 + 1] = buf_R[k];
+				if ( fabsf( buf_L[k] ) > m_fPeak_L ) m_fPeak_L = fabsf( buf_L[k] );
+				if ( fabsf( buf_R[k] ) > m_fPeak_R ) m_fPeak_R = fabsf( buf_R[k] );
+			}
+			if ( sf_writef_float( file, &frames[0], n ) != sf_count_t( n ) ) {
+				ERRORLOG( QString( "Error writing %1: %2" )
+					  .arg( m_settings.filename )
+					  .arg( sf_strerror( file ) ) );
+				m_failed.fetchAndStoreRelease( 1 );
+				break;
+			}
+			m_frames_written.fetchAndAddOrdered( n );
+		}
+		sf_close( file );
+	} else {
+		m_failed.fetchAndStoreRelease( 1 );
+	}
+
+	m_finished.fetchAndStoreRelease( 1 );
+	if ( ! m_bAbort ) {
+		m_engine->get_event_queue()->push_event( EVENT_PROGRESS, 100 );
+	}
+	DEBUGLOG( "ExportDriver writer thread end" );
+}
+
+} // namespace Tritium
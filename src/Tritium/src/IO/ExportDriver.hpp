@@ -0,0 +1,132 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#ifndef TRITIUM_EXPORTDRIVER_HPP
+#define TRITIUM_EXPORTDRIVER_HPP
+
+#include <Tritium/IO/AudioOutput.hpp>
+#include <Tritium/ExportSettings.hpp>
+#include <Tritium/RingBuffer.hpp>
+#include <Tritium/memory.hpp>
+#include <QAtomicInt>
+#include <inttypes.h>
+
+namespace Tritium
+{
+
+class Engine;
+typedef int  ( *audioProcessCallback )( uint32_t, void * );
+
+/**
+ * \brief Renders the song to a file as fast as possible.
+ *
+ * connect() starts two threads.  The render thread calls the
+ * process callback back-to-back with blocks of init()'s buffer
+ * size, stops the transport after 'song_frames' and keeps
+ * rendering (at most ExportSettings::tail_seconds) until the
+ * sampler has no voices left and the output is silent.  The
+ * blocks go through a ring buffer to the writer thread, which
+ * converts and writes them with libsndfile.  So the rendering
+ * does not wait for the disk, and the disk does not wait for the
+ * rendering unless the ring buffer is full.
+ *
+ * EVENT_PROGRESS is sent as the song is rendered, and 100 when
+ * the file is closed (also if it could not be written).
+ */
+class ExportDriver : public AudioOutput
+{
+public:
+	ExportDriver( Engine* parent,
+		      audioProcessCallback processCallback,
+		      void* arg,
+		      const ExportSettings& settings,
+		      uint32_t song_frames );
+	~ExportDriver();
+
+	int init( unsigned nBufferSize );
+	int connect();
+	void disconnect();
+
+	unsigned getBufferSize() {
+		return m_nBufferSize;
+	}
+	unsigned getSampleRate() {
+		return m_settings.sample_rate;
+	}
+	float* getOut_L() {
+		return m_pOut_L;
+	}
+	float* getOut_R() {
+		return m_pOut_R;
+	}
+
+	/// The file is closed (or could not be written).
+	bool finished() {
+		return m_finished.fetchAndAddAcquire(0);
+	}
+	/// The file could not be opened or written.
+	bool failed() {
+		return m_failed.fetchAndAddAcquire(0);
+	}
+	/// Frames written to the file so far.
+	uint32_t frames_written() {
+		return m_frames_written.fetchAndAddAcquire(0);
+	}
+
+	/// The peaks are only up to date once finished().
+	void get_status( ExportStatus& status );
+
+	/// libsndfile format for the settings.
+	static int sf_format( const ExportSettings& settings );
+
+private:
+	class Renderer;
+	class Writer;
+	friend class Renderer;
+	friend class Writer;
+
+	void render();
+	void write();
+	bool is_silent( uint32_t nFrames );
+
+	audioProcessCallback m_processCallback;
+	void* m_processCallback_arg;
+	ExportSettings m_settings;
+	uint32_t m_nSongFrames;
+	unsigned m_nBufferSize;
+	float* m_pOut_L;
+	float* m_pOut_R;
+	T< RingBuffer<float> >::auto_ptr m_ring_L;
+	T< RingBuffer<float> >::auto_ptr m_ring_R;
+	Renderer* m_renderer;
+	Writer* m_writer;
+	bool m_bAbort;
+	QAtomicInt m_rendered;        // Render thread is done
+	QAtomicInt m_finished;
+	QAtomicInt m_failed;
+	QAtomicInt m_frames_written;
+	float m_fPeak_L;              // Writer thread
+	float m_fPeak_R;
+};
+
+} // namespace Tritium
+
+#endif // TRITIUM_EXPORTDRIVER_HPP
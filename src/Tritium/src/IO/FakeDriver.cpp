@@ -21,6 +21,7 @@
 
 #include <Tritium/Logger.hpp>
 #include <Tritium/Engine.hpp>
+#include <Tritium/Preferences.hpp>
 #include <Tritium/Transport.hpp>
 #include "FakeDriver.hpp"
 
@@ -82,7 +83,7 @@ void FakeDriver::disconnect()
 
 unsigned FakeDriver::getSampleRate()
 {
-	return 44100;
+	return m_engine->get_preferences()->m_nSampleRate;
 }
 
 float* FakeDriver::getOut_L()
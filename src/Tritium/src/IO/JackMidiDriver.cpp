@@ -30,6 +30,8 @@
 #include <Tritium/Engine.hpp>
 #include <Tritium/Preferences.hpp> // For preferred auto-connection
 #include <cerrno> // EEXIST for jack_connect()
+#include <cstring> // memcpy()
+#include <QThread>
 
 #ifdef JACK_SUPPORT
 
@@ -84,19 +86,44 @@ using namespace Tritium;
 
 JackProcessCallback jackMidiFallbackProcess; // implemented in Engine.cpp
 
+class JackMidiDriver::Worker : public QThread
+{
+public:
+	Worker(JackMidiDriver* parent) : _parent(parent) {}
+
+	void run() {
+		_parent->work();
+	}
+
+private:
+	JackMidiDriver* _parent;
+};
+
 JackMidiDriver::JackMidiDriver(T<JackClient>::shared_ptr parent, Engine* e_parent)
 	: MidiInput( e_parent, "JackMidiDriver" ),
 	  m_jack_client(parent),
-	  m_port(0)
+	  m_port(0),
+	  m_events(RING_SIZE),
+	  m_dropped(0),
+	  m_kill(false),
+	  m_worker(0)
 {
 	assert(e_parent);
 	DEBUGLOG( "CREATE" );
+	sem_init(&m_wake, 0, 0);
+	m_worker = new Worker(this);
+	m_worker->start();
 }
 
 JackMidiDriver::~JackMidiDriver()
 {
 	DEBUGLOG( "DESTROY" );
 	close();
+	m_kill = true;
+	sem_post(&m_wake);
+	m_worker->wait();
+	delete m_worker;
+	sem_destroy(&m_wake);
 }
 
 void JackMidiDriver::open(void)
@@ -322,14 +349,15 @@ int JackMidiDriver::processNonAudio(jack_nframes_t nframes)
 }
 
 // This function must be realtime safe.  It will be called from
-// the JACK process callback.
+// the JACK process callback.  It only queues the events for work().
 int JackMidiDriver::process(jack_nframes_t nframes, bool use_frame)
 {
 	if (!m_port) return 0;
 
 	jack_nframes_t event_ct, event_pos;
 	jack_midi_event_t jack_event;
-	Tritium::MidiMessage msg;
+	Event ev;
+	bool wake = false;
 
 	void* port_buf = jack_port_get_buffer(m_port, nframes);
 	event_ct = jack_midi_get_event_count(port_buf);
@@ -338,14 +366,54 @@ int JackMidiDriver::process(jack_nframes_t nframes, bool use_frame)
 		if ( jack_midi_event_get(&jack_event, port_buf, event_pos) ) {
 			break;
 		}
-		translate_jack_midi_to_h2(msg, jack_event, use_frame);
-		if (msg.m_type != MidiMessage::UNKNOWN) {
-			handleMidiMessage(msg);
+		wake = true;
+		if ( jack_event.size > MAX_EVENT_SIZE ) {
+			m_dropped.fetchAndAddOrdered(1);
+			continue;
+		}
+		ev.frame = jack_event.time;
+		ev.size = jack_event.size;
+		ev.use_frame = use_frame;
+		memcpy(ev.data, jack_event.buffer, jack_event.size);
+		if ( ! m_events.push(ev) ) {
+			m_dropped.fetchAndAddOrdered(1);
 		}
 	}
+	if ( wake ) {
+		sem_post(&m_wake);
+	}
 	return 0;
 }
 
+/**
+ * Worker thread loop.  Handles the events that process() queued.
+ * The frame of a message is the frame in the cycle that queued it.
+ */
+void JackMidiDriver::work()
+{
+	jack_midi_event_t jack_event;
+	Tritium::MidiMessage msg;
+	Event ev;
+
+	while( true ) {
+		while( sem_wait(&m_wake) != 0 && errno == EINTR ) {}
+		if( m_kill ) break;
+		while( m_events.pop(ev) ) {
+			jack_event.time = ev.frame;
+			jack_event.size = ev.size;
+			jack_event.buffer = ev.data;
+			translate_jack_midi_to_h2(msg, jack_event, ev.use_frame);
+			if (msg.m_type != MidiMessage::UNKNOWN) {
+				handleMidiMessage(msg);
+			}
+		}
+		int dropped = m_dropped.fetchAndStoreOrdered(0);
+		if( dropped ) {
+			WARNINGLOG( QString("Dropped %1 JACK MIDI event(s)").arg(dropped) );
+		}
+	}
+}
+
 std::vector<QString> JackMidiDriver::getOutputPortList(void)
 {
 	return m_jack_client->getMidiOutputPortList();
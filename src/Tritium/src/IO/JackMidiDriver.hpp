@@ -38,12 +38,23 @@
 #include <vector>
 #include <QtCore/QString>
 #include <Tritium/memory.hpp>
+#include <QAtomicInt>
+#include <semaphore.h>
+#include <stdint.h>
+#include "../MpscRing.hpp"
 
 namespace Tritium
 {
 
 class JackClient;
 
+/**
+ * The JACK process callback only copies the raw MIDI events into a
+ * lock-free ring and wakes the driver's thread, which translates
+ * and handles them (see MidiInput::handleMidiMessage()).  Events
+ * longer than MAX_EVENT_SIZE (long SysEx dumps) and events that
+ * don't fit in the ring are dropped and logged.
+ */
 class JackMidiDriver : public MidiInput
 {
 public:
@@ -59,10 +70,29 @@ public:
 	int processNonAudio(jack_nframes_t nframes);
 
 private:
+	enum { MAX_EVENT_SIZE = 16, RING_SIZE = 512 };
+
+	struct Event
+	{
+		uint32_t frame;
+		uint32_t size;
+		bool use_frame;
+		jack_midi_data_t data[MAX_EVENT_SIZE];
+	};
+
+	class Worker;
+	friend class Worker;
+
 	T<JackClient>::shared_ptr m_jack_client;
 	jack_port_t* m_port;
+	MpscRing<Event> m_events;
+	QAtomicInt m_dropped;  // Events the process callback couldn't queue
+	sem_t m_wake;
+	bool m_kill;
+	Worker* m_worker;
 
 	int process(jack_nframes_t nframes, bool use_frame);
+	void work();
 
 }; // JackMidiDriver
 
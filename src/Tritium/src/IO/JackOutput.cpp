@@ -36,12 +36,14 @@
 #include <Tritium/Preferences.hpp>
 #include <Tritium/globals.hpp>
 #include <Tritium/memory.hpp>
+#include <QAtomicInt>
 
 namespace Tritium
 {
 
 unsigned long jack_server_sampleRate = 0;
 jack_nframes_t jack_server_bufferSize = 0;
+QAtomicInt jack_server_xruns(0);
 
 int jackDriverSampleRate( jack_nframes_t nframes, void * /*arg*/ )
 {
@@ -60,6 +62,12 @@ int jackDriverBufferSize( jack_nframes_t nframes, void * /*arg*/ )
 	return 0;
 }
 
+int jackDriverXRun( void * /*arg*/ )
+{
+	jack_server_xruns.fetchAndAddRelaxed(1);
+	return 0;
+}
+
 void jackDriverShutdown( void *arg )
 {
 	T<JackClient>::shared_ptr *ptr =
@@ -193,6 +201,12 @@ unsigned JackOutput::getSampleRate()
 	return jack_server_sampleRate;
 }
 
+/// Xruns reported by the JACK server (all clients, since startup).
+unsigned JackOutput::getXRuns()
+{
+	return jack_server_xruns.fetchAndAddRelaxed(0);
+}
+
 float* JackOutput::getOut_L()
 {
 	jack_default_audio_sample_t *out = ( jack_default_audio_sample_t * ) jack_port_get_buffer ( output_port_1, jack_server_bufferSize );
@@ -209,7 +223,7 @@ float* JackOutput::getOut_R()
 
 float* JackOutput::getTrackOut_L( unsigned nTrack )
 {
-	if(nTrack > (unsigned)track_port_count ) return 0;
+	if(nTrack >= (unsigned)track_port_count ) return 0;
 	jack_port_t *p = track_output_ports_L[nTrack];
 	jack_default_audio_sample_t* out = 0;
 	if( p ) {
@@ -220,7 +234,7 @@ float* JackOutput::getTrackOut_L( unsigned nTrack )
 
 float* JackOutput::getTrackOut_R( unsigned nTrack )
 {
-	if(nTrack > (unsigned)track_port_count ) return 0;
+	if(nTrack >= (unsigned)track_port_count ) return 0;
 	jack_port_t *p = track_output_ports_R[nTrack];
 	jack_default_audio_sample_t* out = 0;
 	if( p ) {
@@ -259,6 +273,10 @@ int JackOutput::init( unsigned /*nBufferSize*/ )
 	*/
 	jack_set_buffer_size_callback ( client, jackDriverBufferSize, 0 );
 
+	/* count the xruns for Engine::get_process_profile().
+	*/
+	jack_set_xrun_callback ( client, jackDriverXRun, 0 );
+
 	/* tell the JACK server to call `jack_shutdown()' if
 	   it ever shuts down, either entirely, or if it
 	   just decides to stop calling us.
@@ -307,10 +325,15 @@ void JackOutput::makeTrackOutputs( T<Song>::shared_ptr song )
 		instr = instruments->get( n );
 		setTrackOutput( n, instr );
 	}
-	// clean up unused ports
+	// clean up unused ports.  The audio thread stops looking at
+	// them (track_port_count) before they go away.
 	jack_client_t* client = m_jack_client->ref();
 	jack_port_t *p_L, *p_R;
-	for ( int n = nInstruments; n < track_port_count; n++ ) {
+	int nOld = track_port_count;
+	if ( nInstruments < nOld ) {
+		track_port_count = nInstruments;
+	}
+	for ( int n = nInstruments; n < nOld; n++ ) {
 		p_L = track_output_ports_L[n];
 		p_R = track_output_ports_R[n];
 		track_output_ports_L[n] = 0;
@@ -318,13 +341,12 @@ void JackOutput::makeTrackOutputs( T<Song>::shared_ptr song )
 		track_output_ports_R[n] = 0;
 		jack_port_unregister( client, p_R );
 	}
-
-	track_port_count = nInstruments;
 }
 
 /**
  * Give the @a n 'th port the name of @a instr .
  * If the n'th port doesn't exist, new ports up to n are created.
+ * The audio thread sees them once they are all registered.
  */
 void JackOutput::setTrackOutput( int n, T<Instrument>::shared_ptr instr )
 {
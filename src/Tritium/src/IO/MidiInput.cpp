@@ -75,59 +75,59 @@ void MidiInput::handleMidiMessage( const MidiMessage& msg )
 		break;
 
 	case MidiMessage::POLYPHONIC_KEY_PRESSURE:
-		ERRORLOG( "POLYPHONIC_KEY_PRESSURE event not handled yet" );
+		RT_ERRORLOG( RtLogMessage("POLYPHONIC_KEY_PRESSURE event not handled yet") );
 		break;
 
 	case MidiMessage::CONTROL_CHANGE:
-		DEBUGLOG( QString( "[handleMidiMessage] CONTROL_CHANGE Parameter: %1, Value: %2").arg( msg.m_nData1 ).arg( msg.m_nData2 ) );
+		RT_DEBUGLOG( RtLogMessage( "[handleMidiMessage] CONTROL_CHANGE Parameter: %1, Value: %2" ) << msg.m_nData1 << msg.m_nData2 );
 		handleControlChangeMessage( msg );
 		break;
 
 	case MidiMessage::PROGRAM_CHANGE:
-		DEBUGLOG( QString( "[handleMidiMessage] PROGRAM_CHANGE event, seting next pattern to %1" ).arg( msg.m_nData1 ) );
+		RT_DEBUGLOG( RtLogMessage( "[handleMidiMessage] PROGRAM_CHANGE event, seting next pattern to %1" ) << msg.m_nData1 );
 		m_engine->sequencer_setNextPattern(msg.m_nData1, false, false);
 		break;
 
 	case MidiMessage::CHANNEL_PRESSURE:
-		ERRORLOG( "CHANNEL_PRESSURE event not handled yet" );
+		RT_ERRORLOG( RtLogMessage("CHANNEL_PRESSURE event not handled yet") );
 		break;
 
 	case MidiMessage::PITCH_WHEEL:
-		ERRORLOG( "PITCH_WHEEL event not handled yet" );
+		RT_ERRORLOG( RtLogMessage("PITCH_WHEEL event not handled yet") );
 		break;
 
 	case MidiMessage::SYSTEM_EXCLUSIVE:
-		ERRORLOG( "SYSTEM_EXCLUSIVE event not handled yet" );
+		RT_ERRORLOG( RtLogMessage("SYSTEM_EXCLUSIVE event not handled yet") );
 		break;
 
 	case MidiMessage::START:
-		DEBUGLOG( "START event" );
+		RT_DEBUGLOG( RtLogMessage("START event") );
 		m_engine->get_transport()->start();
 		break;
 
 	case MidiMessage::CONTINUE:
-		ERRORLOG( "CONTINUE event not handled yet" );
+		RT_ERRORLOG( RtLogMessage("CONTINUE event not handled yet") );
 		break;
 
 	case MidiMessage::STOP:
-		DEBUGLOG( "STOP event" );
+		RT_DEBUGLOG( RtLogMessage("STOP event") );
 		m_engine->get_transport()->stop();
 		break;
 
 	case MidiMessage::SONG_POS:
-		ERRORLOG( "SONG_POS event not handled yet" );
+		RT_ERRORLOG( RtLogMessage("SONG_POS event not handled yet") );
 		break;
 
 	case MidiMessage::QUARTER_FRAME:
-		DEBUGLOG( "QUARTER_FRAME event not handled yet" );
+		RT_DEBUGLOG( RtLogMessage("QUARTER_FRAME event not handled yet") );
 		break;
 
 	case MidiMessage::UNKNOWN:
-		ERRORLOG( "Unknown midi message" );
+		RT_ERRORLOG( RtLogMessage("Unknown midi message") );
 		break;
 
 	default:
-		ERRORLOG( QString( "unhandled midi message type: %1" ).arg( msg.m_type ) );
+		RT_ERRORLOG( RtLogMessage( "unhandled midi message type: %1" ) << int(msg.m_type) );
 	}
 }
 
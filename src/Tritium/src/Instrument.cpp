@@ -21,6 +21,7 @@
  */
 
 #include "InstrumentPrivate.hpp"
+#include "DrumkitLoader.hpp"
 
 #include <Tritium/Instrument.hpp>
 #include <Tritium/InstrumentLayer.hpp>
@@ -32,12 +33,28 @@
 #include <Tritium/SoundLibrary.hpp>
 #include <Tritium/Logger.hpp>
 #include <Tritium/Engine.hpp>
+#include <Tritium/Sampler.hpp>
+#include <Tritium/Reaper.hpp>
 
 #include <QFileInfo>
 #include <cassert>
 
 using namespace Tritium;
 
+namespace
+{
+    QAtomicInt next_handle( 0 );
+
+    uint32_t new_handle()
+    {
+	uint32_t handle;
+	do {
+	    handle = uint32_t( next_handle.fetchAndAddOrdered( 1 ) ) + 1;
+	} while ( handle == 0 );
+	return handle;
+    }
+} // anonymous namespace
+
 /*********************************************************************
  * InstrumentPrivate definition
  *********************************************************************
@@ -48,6 +65,7 @@ Instrument::InstrumentPrivate::InstrumentPrivate(
     ADSR* adsr
     )
     : queued( 0 )
+    , handle( new_handle() )
     , adsr( adsr )
     , muted( false )
     , name( name )
@@ -68,15 +86,14 @@ Instrument::InstrumentPrivate::InstrumentPrivate(
     , stop_notes( false )
 {
     for ( unsigned nLayer = 0; nLayer < MAX_LAYERS; ++nLayer ) {
-	layer_list[ nLayer ] = NULL;
+	layer_list[ nLayer ].fetchAndStoreRelaxed( NULL );
     }
 }
 
 Instrument::InstrumentPrivate::~InstrumentPrivate()
 {
     for ( unsigned nLayer = 0; nLayer < MAX_LAYERS; ++nLayer ) {
-	delete layer_list[ nLayer ];
-	layer_list[ nLayer ] = NULL;
+	delete layer_list[ nLayer ].fetchAndStoreRelaxed( NULL );
     }
     delete adsr;
     adsr = NULL;
@@ -112,16 +129,33 @@ InstrumentLayer* Instrument::get_layer( int nLayer )
 	return NULL;
     }
 
-    return d->layer_list[ nLayer ];
+    return d->layer_list[ nLayer ].fetchAndAddAcquire( 0 );
 }
 
 void Instrument::set_layer( InstrumentLayer* pLayer, unsigned nLayer )
+{
+    swap_layer( pLayer, nLayer );
+}
+
+InstrumentLayer* Instrument::swap_layer( InstrumentLayer* pLayer, unsigned nLayer )
 {
     if ( nLayer < MAX_LAYERS ) {
-	d->layer_list[ nLayer ] = pLayer;
-    } else {
-	ERRORLOG( "nLayer > MAX_LAYER" );
+	return d->layer_list[ nLayer ].fetchAndStoreOrdered( pLayer );
     }
+    ERRORLOG( "nLayer > MAX_LAYER" );
+    return NULL;
+}
+
+size_t Instrument::get_sample_bytes()
+{
+    size_t bytes = 0;
+    for ( unsigned nLayer = 0; nLayer < MAX_LAYERS; ++nLayer ) {
+	InstrumentLayer *pLayer = get_layer( nLayer );
+	if ( pLayer ) {
+	    bytes += pLayer->get_sample_bytes();
+	}
+    }
+    return bytes;
 }
 
 void Instrument::set_adsr( ADSR* adsr )
@@ -130,76 +164,65 @@ void Instrument::set_adsr( ADSR* adsr )
     d->adsr = adsr;
 }
 
+ADSR* Instrument::swap_adsr( ADSR* adsr )
+{
+    ADSR* old = d->adsr;
+    d->adsr = adsr;
+    return old;
+}
+
 /**
  * \brief Load stand and samples from a `placeholder` instrument.
  *
  * Loads the stand and samples into an Instrument object from a
  * `placeholder` instrument (an Instrument that has everything but the
- * actual samples).
+ * actual samples).  The samples are decoded first (in parallel, see
+ * DrumkitLoader) and then swapped in all at once.
  */
 void Instrument::load_from_placeholder( Engine* engine, T<Instrument>::shared_ptr placeholder, bool is_live )
 {
-    LocalFileMng mgr(engine);
-    QString path =
-	mgr.getDrumkitDirectory( placeholder->get_drumkit_name() )
-	+ placeholder->get_drumkit_name()
-	+ "/";
+    InstrumentLayer* layers[MAX_LAYERS];
+    DrumkitLoader loader( engine );
+    loader.add( placeholder );
+    loader.load();
+    loader.take_layers( 0, layers );
+
+    if ( is_live )
+	engine->lock( RIGHT_HERE );
+
+    ADSR* old_adsr = swap_from_placeholder( placeholder, layers );
+
+    if ( is_live )
+	engine->unlock();
+
+    // The old layers may still be playing.  The sampler's reaper
+    // deletes them once the audio thread is done with them.
+    T<Reaper>::shared_ptr reaper = engine->get_sampler()->get_reaper();
+    reaper->defer( old_adsr );
     for ( unsigned nLayer = 0; nLayer < MAX_LAYERS; ++nLayer ) {
-	InstrumentLayer *pNewLayer = placeholder->get_layer( nLayer );
-	if ( pNewLayer != NULL ) {
-	    // this is a 'placeholder sample:
-	    T<Sample>::shared_ptr pNewSample = pNewLayer->get_sample();
-			
-	    // now we load the actal data:
-	    QFileInfo samp_file( pNewSample->get_filename() );
-	    if( !samp_file.exists() ) {
-		samp_file.setFile( path + pNewSample->get_filename() );
-	    }
-	    T<Sample>::shared_ptr pSample = Sample::load( samp_file.absoluteFilePath() );
-	    InstrumentLayer *pOldLayer = this->get_layer( nLayer );
-
-	    if ( pSample == NULL ) {
-		ERRORLOG( "Error loading sample. Creating a new empty layer." );
-		if ( is_live )
-		    engine->lock( RIGHT_HERE );
-				
-		this->set_layer( NULL, nLayer );
-				
-		if ( is_live )
-		    engine->unlock();
-		delete pOldLayer;
-		continue;
-	    }
-	    InstrumentLayer *pLayer = new InstrumentLayer( pSample );
-	    pLayer->set_velocity_range( pNewLayer->get_velocity_range() );
-	    pLayer->set_gain( pNewLayer->get_gain() );
-	    pLayer->set_pitch(pNewLayer->get_pitch()); 
-
-	    if ( is_live )
-		engine->lock( RIGHT_HERE );
-			
-	    this->set_layer( pLayer, nLayer );	// set the new layer
-			
-	    if ( is_live )
-		engine->unlock();
-	    delete pOldLayer;		// delete the old layer
-
-	} else {
-	    InstrumentLayer *pOldLayer = this->get_layer( nLayer );
-	    if ( is_live )
-		engine->lock( RIGHT_HERE );
-			
-	    this->set_layer( NULL, nLayer );
-			
-	    if ( is_live )
-		engine->unlock();
-	    delete pOldLayer;		// delete the old layer
+	if ( layers[ nLayer ] ) {
+	    reaper->defer( layers[ nLayer ], layers[ nLayer ]->get_sample_bytes() );
 	}
+    }
+}
 
+/**
+ * \brief Take the layers and properties of a `placeholder` instrument.
+ *
+ * The layers in `layers` (NULL for an empty layer) replace the
+ * current ones, and the old layers are returned in `layers`.  The
+ * properties (name, gain, ADSR, etc.) are copied from
+ * `placeholder`.  This does not lock the engine and does not free
+ * the old layers, so that the caller can hold the lock for as short
+ * a time as possible.  Returns the old ADSR, which the caller frees
+ * like the old layers.
+ */
+ADSR* Instrument::swap_from_placeholder( T<Instrument>::shared_ptr placeholder, InstrumentLayer* layers[] )
+{
+    for ( unsigned nLayer = 0; nLayer < MAX_LAYERS; ++nLayer ) {
+	layers[ nLayer ] = this->swap_layer( layers[ nLayer ], nLayer );
     }
-    if ( is_live )
-	engine->lock( RIGHT_HERE );
-	
+
     // update instrument properties
     this->set_gain( placeholder->get_gain() );
     this->set_id( placeholder->get_id() );
@@ -209,14 +232,12 @@ void Instrument::load_from_placeholder( Engine* engine, T<Instrument>::shared_pt
     this->set_drumkit_name( placeholder->get_drumkit_name() );
     this->set_muted( placeholder->is_muted() );
     this->set_random_pitch_factor( placeholder->get_random_pitch_factor() );
-    this->set_adsr( new ADSR( *( placeholder->get_adsr() ) ) );
+    ADSR* old_adsr = this->swap_adsr( new ADSR( *( placeholder->get_adsr() ) ) );
     this->set_filter_active( placeholder->is_filter_active() );
     this->set_filter_cutoff( placeholder->get_filter_cutoff() );
     this->set_filter_resonance( placeholder->get_filter_resonance() );
     this->set_mute_group( placeholder->get_mute_group() );
-	
-    if ( is_live )
-	engine->unlock();
+    return old_adsr;
 }
 
 /**
@@ -445,18 +466,29 @@ void Instrument::set_soloed( bool soloed )
 
 void Instrument::enqueue()
 {
-    d->queued++;
+    d->queued.fetchAndAddOrdered( 1 );
 }
 
 void Instrument::dequeue()
 {
-    assert( d->queued > 0 );
-    d->queued--;
+    int old = d->queued.fetchAndAddOrdered( -1 );
+    assert( old > 0 );
+    (void) old;
 }
 
 int Instrument::is_queued()
 {
-    return d->queued;
+    return d->queued.fetchAndAddAcquire( 0 );
+}
+
+uint32_t Instrument::get_handle()
+{
+    return d->handle;
+}
+
+bool Instrument::is_busy( void* instr )
+{
+    return static_cast<Instrument*>( instr )->is_queued() != 0;
 }
 
 bool Instrument::is_stop_notes()
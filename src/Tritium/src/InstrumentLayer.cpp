@@ -232,3 +232,13 @@ T<Sample>::shared_ptr InstrumentLayer::get_sample()
 {
     return m_sample;
 }
+
+Sample* InstrumentLayer::get_sample_ptr()
+{
+    return m_sample.get();
+}
+
+size_t InstrumentLayer::get_sample_bytes()
+{
+    return m_sample ? m_sample->get_size() : 0;
+}
@@ -45,7 +45,7 @@ InstrumentList::~InstrumentList()
 void InstrumentList::add( T<Instrument>::shared_ptr newInstrument )
 {
     m_list.push_back( newInstrument );
-    m_posmap[newInstrument] = m_list.size() - 1;
+    m_posmap[newInstrument.get()] = m_list.size() - 1;
 }
 
 
@@ -64,9 +64,17 @@ T<Instrument>::shared_ptr InstrumentList::get( unsigned int pos )
 /// Returns index of instrument in list, if instrument not found, returns -1
 int InstrumentList::get_pos( T<Instrument>::shared_ptr pInstr )
 {
-    if ( m_posmap.find( pInstr ) == m_posmap.end() )
+    return get_pos( pInstr.get() );
+}
+
+int InstrumentList::get_pos( Instrument* pInstr )
+{
+    // Called from several render threads at once: don't use
+    // operator[], which may insert.
+    map_t::const_iterator it = m_posmap.find( pInstr );
+    if ( it == m_posmap.end() )
 	return -1;
-    return m_posmap[ pInstr ];
+    return it->second;
 }
 
 unsigned int InstrumentList::get_size()
@@ -84,6 +92,20 @@ void InstrumentList::replace( T<Instrument>::shared_ptr pNewInstr, unsigned nPos
     m_list.insert( m_list.begin() + nPos, pNewInstr );	// insert the new Instrument
     // remove the old Instrument
     m_list.erase( m_list.begin() + nPos + 1 );
+    reindex();
+}
+
+void InstrumentList::move( unsigned from, unsigned to )
+{
+    if ( from >= m_list.size() || to >= m_list.size() ) {
+	ERRORLOG( QString( "Instrument index out of bounds in InstrumentList::move. %1 -> %2, size %3" )
+		  .arg( from ).arg( to ).arg( m_list.size() ) );
+	return;
+    }
+    instrument_t instr = m_list[from];
+    m_list.erase( m_list.begin() + from );
+    m_list.insert( m_list.begin() + to, instr );
+    reindex();
 }
 
 
@@ -92,6 +114,16 @@ void InstrumentList::del( int pos )
     assert( pos < ( int )m_list.size() );
     assert( pos >= 0 );
     m_list.erase( m_list.begin() + pos );
+    reindex();
+}
+
+/// Rebuild m_posmap after the positions changed.
+void InstrumentList::reindex()
+{
+    m_posmap.clear();
+    for ( unsigned k = 0; k < m_list.size(); ++k ) {
+	m_posmap[ m_list[k].get() ] = k;
+    }
 }
 
 /**
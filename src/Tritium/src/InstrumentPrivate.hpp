@@ -24,6 +24,8 @@
 #include <Tritium/globals.hpp>
 #include <Tritium/Instrument.hpp>
 #include <QString>
+#include <QAtomicInt>
+#include <QAtomicPointer>
 
 namespace Tritium
 {
@@ -37,8 +39,11 @@ namespace Tritium
     class Instrument::InstrumentPrivate
     {
     public:
-	int queued;
-	InstrumentLayer* layer_list[MAX_LAYERS];
+	QAtomicInt queued;          ///< Voices playing it (see Instrument::enqueue())
+	uint32_t handle;            ///< See Instrument::get_handle()
+	/// Read by the audio thread while the GUI or a loader
+	/// replaces layers, so the slots are atomic.
+	QAtomicPointer<InstrumentLayer> layer_list[MAX_LAYERS];
 	ADSR* adsr;
 	bool muted;
 	QString name;               ///< Instrument name
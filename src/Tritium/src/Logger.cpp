@@ -21,6 +21,7 @@
 
 #include "LoggerPrivate.hpp"
 #include "WorkerThread.hpp"
+#include "ProcessProfiler.hpp"
 #include <Tritium/Logger.hpp>
 #include <Tritium/util.hpp>
 
@@ -50,6 +51,10 @@ static WorkerThread *worker_thread = 0;
  */
 
 LoggerPrivate::LoggerPrivate(Logger* parent, bool use_file) :
+    m_rt_queue(RT_QUEUE_SIZE),
+    m_rt_dropped(0),
+    m_rt_suppressed(0),
+    m_rt_dropped_reported(0),
     m_log_level(Logger::Error | Logger::Warning | Logger::Info),
     m_use_file(use_file),
     m_kill(false),
@@ -91,7 +96,7 @@ LoggerPrivate::~LoggerPrivate()
 bool LoggerPrivate::events_waiting()
 {
     if(m_logger) {
-	return !(m_msg_queue.empty());
+	return !(m_msg_queue.empty() && m_rt_queue.empty());
     }
     return false;
 }
@@ -105,6 +110,8 @@ int LoggerPrivate::process()
 {
     if( m_kill ) return 0;
 
+    process_rt();
+
     LoggerPrivate::queue_t& queue = m_msg_queue;
     LoggerPrivate::queue_t::iterator it, last;
     QString tmpString;
@@ -229,6 +236,162 @@ void LoggerPrivate::log( unsigned level,
     m_msg_queue.push_back( tmp );
 }
 
+/**
+ * The rate limit for 'format', or 0 if there are no free slots.
+ * Slots are claimed by the first message with a format, and never
+ * released (formats are string literals).
+ */
+LoggerPrivate::RtRate* LoggerPrivate::rt_rate(const char* format)
+{
+    const unsigned PROBES = 8;
+    unsigned h = unsigned( size_t(format) >> 2 );
+    for( unsigned k = 0 ; k < PROBES ; ++k ) {
+	RtRate& r = m_rt_rates[ (h + k) % RT_RATE_SLOTS ];
+	const char* f = r.format;
+	if( f == format ) return &r;
+	if( f == 0 ) {
+	    if( r.format.testAndSetOrdered(0, format) ) return &r;
+	    if( (const char*)r.format == format ) return &r;
+	}
+    }
+    return 0;
+}
+
+void LoggerPrivate::rt_log( unsigned level,
+			    const char* funcname,
+			    const char* file,
+			    unsigned line,
+			    const RtLogMessage& msg )
+{
+    if( level == Logger::None ) return;
+
+    unsigned suppressed = 0;
+    RtRate *r = rt_rate(msg.format);
+    if( r ) {
+	int now = int( ProcessProfiler::now() / 1000000000ULL );
+	int then = r->second.fetchAndAddAcquire(0);
+	if( then != now && r->second.testAndSetOrdered(then, now) ) {
+	    r->count.fetchAndStoreOrdered(0);
+	}
+	if( r->count.fetchAndAddOrdered(1) >= RT_RATE_LIMIT ) {
+	    r->suppressed.fetchAndAddOrdered(1);
+	    m_rt_suppressed.fetchAndAddRelaxed(1);
+	    return;
+	}
+	suppressed = r->suppressed.fetchAndStoreOrdered(0);
+    }
+
+    RtRecord rec;
+    rec.level = level;
+    rec.funcname = funcname;
+    rec.file = file;
+    rec.line = line;
+    rec.suppressed = suppressed;
+    rec.msg = msg;
+    if( ! m_rt_queue.push(rec) ) {
+	m_rt_dropped.fetchAndAddRelaxed(1);
+	if( r ) r->suppressed.fetchAndAddOrdered(suppressed);
+    }
+}
+
+/**
+ * Format the real-time messages and add them to the queue.
+ */
+void LoggerPrivate::process_rt()
+{
+    RtRecord rec;
+    while( m_rt_queue.pop(rec) ) {
+	const RtLogMessage& m = rec.msg;
+	QString msg( m.format );
+	for( unsigned k = 0 ; k < m.nargs && k < RtLogMessage::MAX_ARGS ; ++k ) {
+	    const RtLogMessage::Arg& a = m.args[k];
+	    switch( a.type ) {
+	    case RtLogMessage::Int: msg = msg.arg(a.i); break;
+	    case RtLogMessage::UInt: msg = msg.arg(a.u); break;
+	    case RtLogMessage::Double: msg = msg.arg(a.d); break;
+	    case RtLogMessage::String: msg = msg.arg( QString::fromLatin1(a.s) ); break;
+	    }
+	}
+	if( rec.suppressed ) {
+	    msg += QString(" (%1 more not logged)").arg(rec.suppressed);
+	}
+	log( rec.level, rec.funcname, rec.file, rec.line, msg );
+    }
+
+    unsigned dropped = get_rt_dropped();
+    if( dropped != m_rt_dropped_reported ) {
+	log( Logger::Warning, __FUNCTION__, __FILE__, __LINE__,
+	     QString("%1 real-time log messages were dropped (queue full)")
+	     .arg(dropped - m_rt_dropped_reported) );
+	m_rt_dropped_reported = dropped;
+    }
+}
+
+/*********************************************************************
+ * RtLogMessage implementation
+ *********************************************************************
+ */
+
+RtLogMessage& RtLogMessage::operator<<( int v )
+{
+    if( nargs < MAX_ARGS ) {
+	args[nargs].type = Int;
+	args[nargs].i = v;
+	++nargs;
+    }
+    return *this;
+}
+
+RtLogMessage& RtLogMessage::operator<<( unsigned v )
+{
+    if( nargs < MAX_ARGS ) {
+	args[nargs].type = UInt;
+	args[nargs].u = v;
+	++nargs;
+    }
+    return *this;
+}
+
+RtLogMessage& RtLogMessage::operator<<( double v )
+{
+    if( nargs < MAX_ARGS ) {
+	args[nargs].type = Double;
+	args[nargs].d = v;
+	++nargs;
+    }
+    return *this;
+}
+
+RtLogMessage& RtLogMessage::operator<<( const char* v )
+{
+    if( nargs < MAX_ARGS ) {
+	Arg& a = args[nargs];
+	a.type = String;
+	unsigned k = 0;
+	for( ; v && v[k] && k < MAX_STRING - 1 ; ++k ) {
+	    a.s[k] = v[k];
+	}
+	a.s[k] = 0;
+	++nargs;
+    }
+    return *this;
+}
+
+RtLogMessage& RtLogMessage::operator<<( const QString& v )
+{
+    if( nargs < MAX_ARGS ) {
+	Arg& a = args[nargs];
+	a.type = String;
+	int k = 0;
+	for( ; k < v.size() && k < MAX_STRING - 1 ; ++k ) {
+	    a.s[k] = v.at(k).toLatin1();
+	}
+	a.s[k] = 0;
+	++nargs;
+    }
+    return *this;
+}
+
 /*********************************************************************
  * Logger implementation
  *********************************************************************
@@ -279,6 +442,25 @@ void Logger::log( unsigned level,
     get_instance()->d->log(level, funcname, file, line, msg);
 }
 
+void Logger::rt_log( unsigned level,
+		     const char* funcname,
+		     const char* file,
+		     unsigned line,
+		     const RtLogMessage& msg )
+{
+    get_instance()->d->rt_log(level, funcname, file, line, msg);
+}
+
+unsigned Logger::get_rt_dropped()
+{
+    return d->get_rt_dropped();
+}
+
+unsigned Logger::get_rt_suppressed()
+{
+    return d->get_rt_suppressed();
+}
+
 void Logger::set_log_level(unsigned lev)
 {
     get_instance()->d->set_log_level(lev);
@@ -22,9 +22,12 @@
 #define TRITIUM_LOGGERPRIVATE_HPP
 
 #include "WorkerThread.hpp"
+#include "MpscRing.hpp"
 #include <Tritium/Logger.hpp>
 #include <list>
 #include <QString>
+#include <QAtomicInt>
+#include <QAtomicPointer>
 
 namespace Tritium
 {
@@ -49,8 +52,50 @@ namespace Tritium
 		  const char* file,
 		  unsigned line,
 		  const QString& msg );
+	void rt_log( unsigned level,
+		     const char* funcname,
+		     const char* file,
+		     unsigned line,
+		     const RtLogMessage& msg );
+	unsigned get_rt_dropped() { return m_rt_dropped.fetchAndAddRelaxed(0); }
+	unsigned get_rt_suppressed() { return m_rt_suppressed.fetchAndAddRelaxed(0); }
+
+	enum { RT_QUEUE_SIZE = 256 };
+	enum { RT_RATE_LIMIT = 10 };   ///< Messages per second per format
+	enum { RT_RATE_SLOTS = 64 };
 
     private:
+	struct RtRecord
+	{
+	    unsigned level;
+	    const char* funcname;
+	    const char* file;
+	    unsigned line;
+	    unsigned suppressed;  ///< Messages of this format not logged before this one
+	    RtLogMessage msg;
+	};
+
+	/// Rate limit for the messages with one format.
+	struct RtRate
+	{
+	    QAtomicPointer<const char> format;
+	    QAtomicInt second;      ///< When 'count' started
+	    QAtomicInt count;       ///< Messages logged in 'second'
+	    QAtomicInt suppressed;  ///< Not logged since the last one that was
+	};
+
+	RtRate* rt_rate(const char* format);
+	void process_rt();
+
+	/* Real-time messages.  Any thread can add them, and
+	 * process() formats them and adds them to m_msg_queue.
+	 */
+	MpscRing<RtRecord> m_rt_queue;
+	RtRate m_rt_rates[RT_RATE_SLOTS];
+	QAtomicInt m_rt_dropped;
+	QAtomicInt m_rt_suppressed;
+	unsigned m_rt_dropped_reported;
+
 	/* m_msg_queue needs to be a list type (e.g. std::list<>)
 	 * because of the following properties:
 	 *
@@ -0,0 +1,89 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "MappedFile.hpp"
+#include <Tritium/Logger.hpp>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace Tritium;
+
+MappedFile::MappedFile() :
+    _data(0),
+    _size(0),
+    _locked(false)
+{
+}
+
+MappedFile::~MappedFile()
+{
+    unmap();
+}
+
+bool MappedFile::map(const QString& path)
+{
+    unmap();
+
+    int fd = open( path.toLocal8Bit(), O_RDONLY );
+    if( fd < 0 ) {
+	return false;
+    }
+    struct stat st;
+    if( fstat(fd, &st) != 0 || st.st_size <= 0 ) {
+	close(fd);
+	return false;
+    }
+
+    int flags = MAP_SHARED;
+#ifdef MAP_POPULATE
+    flags |= MAP_POPULATE;
+#endif
+    void* addr = mmap( 0, st.st_size, PROT_READ, flags, fd, 0 );
+    close(fd);  // The mapping keeps the file open.
+    if( addr == MAP_FAILED ) {
+	ERRORLOG( QString("Could not map %1").arg(path) );
+	return false;
+    }
+    _data = static_cast<char*>(addr);
+    _size = st.st_size;
+
+    // Locking fails if RLIMIT_MEMLOCK is too low.  The pages are
+    // still resident (MAP_POPULATE), but may be evicted later.
+    _locked = ( mlock(_data, _size) == 0 );
+    if( ! _locked ) {
+	DEBUGLOG( QString("Could not lock %1 in memory").arg(path) );
+    }
+    return true;
+}
+
+void MappedFile::unmap()
+{
+    if( ! _data ) return;
+    if( _locked ) {
+	munlock(_data, _size);
+    }
+    munmap(_data, _size);
+    _data = 0;
+    _size = 0;
+    _locked = false;
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+#ifndef TRITIUM_MAPPEDFILE_HPP
+#define TRITIUM_MAPPEDFILE_HPP
+
+#include <QString>
+#include <cstddef>
+
+namespace Tritium
+{
+    /**
+     * \brief A file mapped read-only into memory.
+     *
+     * The mapping is shared, so every process (and every plugin
+     * instance) that maps the same file uses the same pages of the
+     * page cache.  The pages are read in and locked (if the system
+     * allows it) when the file is mapped, so that the audio thread
+     * doesn't wait for the disk when it reads them.
+     *
+     * The file is unmapped when the object is deleted.
+     */
+    class MappedFile
+    {
+    public:
+	MappedFile();
+	~MappedFile();
+
+	/// Map 'path'.  Returns false if it can not be mapped.
+	bool map(const QString& path);
+
+	const char* data() { return _data; }
+	size_t size() { return _size; }
+
+    private:
+	MappedFile(const MappedFile&);             // Not copyable
+	MappedFile& operator=(const MappedFile&);
+
+	void unmap();
+
+	char* _data;
+	size_t _size;
+	bool _locked;
+    };
+
+} // namespace Tritium
+
+#endif // TRITIUM_MAPPEDFILE_HPP
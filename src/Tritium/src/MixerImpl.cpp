@@ -23,7 +23,8 @@
 #include <Tritium/fx/Effects.hpp>
 #include <Tritium/fx/LadspaFX.hpp>
 #include "MixerImplPrivate.hpp"
-#include <cstring> // memcpy
+#include "VoiceKernels.hpp"
+#include <cstring> // memset
 #include <algorithm>
 #include <cmath>
 
@@ -42,6 +43,7 @@ MixerImpl::MixerImpl(uint32_t max_buffer,
     d->_fx = fx_man;
     d->_fx_count = (fx_count < MAX_FX) ? fx_count : MAX_FX;
     d->_gain = 1.0f;
+    d->_post_fader_outs = false;
 }
 
 MixerImpl::~MixerImpl()
@@ -90,17 +92,17 @@ void MixerImpl::mix_send_return(uint32_t nframes)
 {
     if( !d->_fx ) return;
 
-    uint32_t count = d->_fx->getPluginList().size();
+    const Effects::Rack& rack = d->_fx->acquireRack();
+    uint32_t count = rack.count;
     if( count > d->_fx_count ) count = d->_fx_count;
 
+    // An effect's buffers are only cleared when something is sent
+    // to it (or it has to run anyway).  Effects that are disabled,
+    // or whose tail has died out with no input, aren't run at all.
+    bool fed[MAX_FX];
     uint32_t k;
     for(k=0 ; k<count; ++k) {
-	T<LadspaFX>::shared_ptr effect = d->_fx->getLadspaFX(k);
-	if( !effect ) continue;
-	memset(effect->m_pBuffer_L, 0, nframes * sizeof(float));
-	if( effect->getPluginType() == LadspaFX::STEREO_FX ) {
-	    memset(effect->m_pBuffer_R, 0, nframes * sizeof(float));
-	}
+	fed[k] = false;
     }
 
     MixerImplPrivate::port_list_t::iterator it;
@@ -110,8 +112,12 @@ void MixerImpl::mix_send_return(uint32_t nframes)
 	if(port->zero_flag()) continue;
 	for(k=0 ; k<count ; ++k) {
 	    if(chan.send_gain(k) == 0.0f) continue;
-	    T<LadspaFX>::shared_ptr effect = d->_fx->getLadspaFX(k);
-	    if(!effect) continue;
+	    LadspaFX* effect = rack.fx[k].get();
+	    if(!effect || !effect->isEnabled()) continue;
+	    if(!fed[k]) {
+		MixerImplPrivate::clear_fx(effect, nframes);
+		fed[k] = true;
+	    }
 	    float *L, *R;
 	    L = port->get_buffer();
 	    if(port->type() == AudioPort::STEREO) {
@@ -129,59 +135,58 @@ void MixerImpl::mix_send_return(uint32_t nframes)
     }
 
     for(k=0 ; k<count ; ++k) {
-	T<LadspaFX>::shared_ptr effect = d->_fx->getLadspaFX(k);
-	if(effect) {
-	    effect->processFX(nframes);
+	LadspaFX* effect = rack.fx[k].get();
+	if(!effect || !effect->isEnabled()) continue;
+	TailDetector& tail = effect->getTailDetector();
+	if(!tail.wantProcess(fed[k])) continue;
+	if(!fed[k]) {
+	    MixerImplPrivate::clear_fx(effect, nframes);
+	}
+	effect->processFX(nframes);
+	if(tail.getState() == TailDetector::TAIL) {
+	    float peak = TailDetector::peak(effect->m_pBuffer_L, nframes);
+	    if(effect->getPluginType() == LadspaFX::STEREO_FX) {
+		peak = std::max(peak, TailDetector::peak(effect->m_pBuffer_R, nframes));
+	    }
+	    tail.processed(peak, nframes);
 	}
     }
+    d->_fx->releaseRack();
 }
 
 void MixerImpl::mix_down(uint32_t nframes, float* left, float* right, float* peak_left, float* peak_right)
 {
-    #warning "This is the prosaic approach.  Need an optimized one."
     MixerImplPrivate::port_list_t::iterator it;
+    float from[4], to[4];
     bool zero = true;
 
-    /* See below for
-     * the "Theory of Pan"
+    /* Each channel is mixed into both outputs in one pass
+     * (VoiceKernels::pan_mix()).  The gains are ramped over the
+     * cycle when the gain or pan changed, to avoid zipper noise.
+     * See below for the "Theory of Pan."
      */
     for(it=d->_in_ports.begin() ; it!=d->_in_ports.end() ; ++it) {
 	Channel& chan = **it;
-	T<AudioPort>::shared_ptr port = chan.port();
+	AudioPort* port = chan.port().get();
 	if( port->zero_flag() ) continue;
-	if( port->type() == AudioPort::MONO ) {
-	    float gL, gR, pan, gain;
-	    gain = chan.gain() * d->_gain;
-	    pan = chan.pan();
-	    MixerImplPrivate::eval_pan(gain, pan, gL, gR);
-	    if(zero) {
-		MixerImplPrivate::copy_buffer_with_gain(left, port->get_buffer(), nframes, gL);
-		MixerImplPrivate::copy_buffer_with_gain(right, port->get_buffer(), nframes, gR);
-	    } else {
-		MixerImplPrivate::mix_buffer_with_gain(left, port->get_buffer(), nframes, gL);
-		MixerImplPrivate::mix_buffer_with_gain(right, port->get_buffer(), nframes, gR);
-	    }
-	} else {
-	    assert( port->type() == AudioPort::STEREO );
-	    float gL, gR, pan, gain;
-
-	    // Left
-	    gain = chan.gain() * d->_gain;
-	    pan = chan.pan_L();
-	    MixerImplPrivate::eval_pan(gain, pan, gL, gR);
-	    if(zero) {
-		MixerImplPrivate::copy_buffer_with_gain(left, port->get_buffer(), nframes, gL);
-		MixerImplPrivate::copy_buffer_with_gain(right, port->get_buffer(), nframes, gR);
-	    } else {
-		MixerImplPrivate::mix_buffer_with_gain(left, port->get_buffer(), nframes, gL);
-		MixerImplPrivate::mix_buffer_with_gain(right, port->get_buffer(), nframes, gR);
-	    }
-	    pan = chan.pan_R();
-	    MixerImplPrivate::eval_pan(gain, pan, gL, gR);
-	    MixerImplPrivate::mix_buffer_with_gain(left, port->get_buffer(1), nframes, gL);
-	    MixerImplPrivate::mix_buffer_with_gain(right, port->get_buffer(1), nframes, gR);
+	MixerImplPrivate::pan_gains(chan, d->_gain, from, to);
+	const float* src_R = 0;
+	if( port->type() == AudioPort::STEREO ) {
+	    src_R = port->get_buffer(1);
 	}
+	VoiceKernels::pan_mix(port->get_buffer(), src_R, from, to,
+			      left, right, nframes, zero);
 	zero = false;
+
+	// A post-fader output gets the same gains, in place.  The
+	// mixer's ports are all AudioPortImpl's.
+	if( d->_post_fader_outs && src_R
+	    && static_cast<AudioPortImpl*>(port)->external() ) {
+	    float* buf_L = port->get_buffer();
+	    float* buf_R = port->get_buffer(1);
+	    VoiceKernels::pan_mix(buf_L, buf_R, from, to,
+				  buf_L, buf_R, nframes, true);
+	}
     }
     if(zero) {
 	memset(left, 0, nframes * sizeof(float));
@@ -190,30 +195,30 @@ void MixerImpl::mix_down(uint32_t nframes, float* left, float* right, float* pea
 
     uint32_t k, plugin_count;
     if(d->_fx) {
-	plugin_count = d->_fx->getPluginList().size();
-    } else {
-	plugin_count = 0;
-    }
-    if(plugin_count > d->_fx_count) {
-	plugin_count = d->_fx_count;
-    }
-    for(k=0 ; k<plugin_count ; ++k) {
-	assert(d->_fx);
-	T<LadspaFX>::shared_ptr effect = d->_fx->getLadspaFX(k);
-	if(!effect) continue;
-	if(!effect->isEnabled()) continue;
-	MixerImplPrivate::mix_buffer_with_gain(left, effect->m_pBuffer_L, nframes, effect->getVolume());
-	if(effect->getPluginType() == LadspaFX::STEREO_FX) {
-	    MixerImplPrivate::mix_buffer_with_gain(right, effect->m_pBuffer_R, nframes, effect->getVolume());
-	} else {
-	    MixerImplPrivate::mix_buffer_with_gain(right, effect->m_pBuffer_L, nframes, effect->getVolume());
+	const Effects::Rack& rack = d->_fx->acquireRack();
+	plugin_count = rack.count;
+	if(plugin_count > d->_fx_count) {
+	    plugin_count = d->_fx_count;
+	}
+	for(k=0 ; k<plugin_count ; ++k) {
+	    LadspaFX* effect = rack.fx[k].get();
+	    if(!effect) continue;
+	    if(!effect->isEnabled()) continue;
+	    if(effect->getTailDetector().getState() == TailDetector::IDLE) continue;
+	    MixerImplPrivate::mix_buffer_with_gain(left, effect->m_pBuffer_L, nframes, effect->getVolume());
+	    if(effect->getPluginType() == LadspaFX::STEREO_FX) {
+		MixerImplPrivate::mix_buffer_with_gain(right, effect->m_pBuffer_R, nframes, effect->getVolume());
+	    } else {
+		MixerImplPrivate::mix_buffer_with_gain(right, effect->m_pBuffer_L, nframes, effect->getVolume());
+	    }
 	}
+	d->_fx->releaseRack();
     }
     if(peak_left) {
-	(*peak_left) = MixerImplPrivate::clip_buffer_get_peak(left, nframes);
+	(*peak_left) = VoiceKernels::clip_peak(left, nframes);
     }
     if(peak_right) {
-	(*peak_right) = MixerImplPrivate::clip_buffer_get_peak(right, nframes);
+	(*peak_right) = VoiceKernels::clip_peak(right, nframes);
     }
 }
 
@@ -231,6 +236,16 @@ float MixerImpl::gain()
     return d->_gain;
 }
 
+void MixerImpl::post_fader_outs(bool post_fader)
+{
+    d->_post_fader_outs = post_fader;
+}
+
+bool MixerImpl::post_fader_outs()
+{
+    return d->_post_fader_outs;
+}
+
 uint32_t MixerImpl::count()
 {
     return d->_in_ports.size();
@@ -279,7 +294,7 @@ void MixerImplPrivate::delete_port(MixerImplPrivate::port_ref_t port)
 
 T<Mixer::Channel>::shared_ptr MixerImplPrivate::channel_for_port(const MixerImplPrivate::port_ref_t port)
 {
-    for(uint32_t k; k<_in_ports.size() ; ++k) {
+    for(uint32_t k=0 ; k<_in_ports.size() ; ++k) {
 	if( _in_ports[k]->port() == port ) return _in_ports[k];
     }
     return T<Mixer::Channel>::shared_ptr();
@@ -361,51 +376,56 @@ void MixerImplPrivate::eval_pan(float gain, float pan, float& left, float& right
     right = R;
 }
 
-void MixerImplPrivate::copy_buffer_no_gain(float* dst, float* src, uint32_t nframes)
-{
-    memcpy(dst, src, nframes * sizeof(float));
-}
-
-void MixerImplPrivate::copy_buffer_with_gain(float* dst, float* src, uint32_t nframes, float gain)
-{
-    mult_gain t;
-    t.gain = gain;
-    std::transform(src, src+nframes, dst, t);
-}
+/**
+ * Get the pan gains (VoiceKernels::PAN_LL, etc.) of 'chan' for
+ * this cycle.  eval_pan() is only done again when the gain, pan,
+ * or master gain has changed.  In that case 'from' gets the gains
+ * of the last cycle so that the change can be ramped.  Otherwise,
+ * from == to.
+ */
+void MixerImplPrivate::pan_gains(Mixer::Channel& chan, float master, float from[4], float to[4])
+{
+    ChannelPrivate& c = *chan.d;
+    float gain = c._gain * master;
+    float pan_L = c._pan_L();
+    float pan_R = c._pan_R();
+    int j;
+
+    if( c._mix_valid
+	&& gain == c._mix_for[0]
+	&& pan_L == c._mix_for[1]
+	&& pan_R == c._mix_for[2] ) {
+	for( j=0 ; j<4 ; ++j ) {
+	    from[j] = to[j] = c._mix_gain[j];
+	}
+	return;
+    }
 
-void MixerImplPrivate::mix_buffer_no_gain(float* dst, float* src, uint32_t nframes)
-{
-    std::transform(src, src+nframes, dst, dst, std::plus<float>());
+    eval_pan(gain, pan_L, to[VoiceKernels::PAN_LL], to[VoiceKernels::PAN_LR]);
+    eval_pan(gain, pan_R, to[VoiceKernels::PAN_RL], to[VoiceKernels::PAN_RR]);
+    for( j=0 ; j<4 ; ++j ) {
+	from[j] = (c._mix_valid) ? c._mix_gain[j] : to[j];
+	c._mix_gain[j] = to[j];
+    }
+    c._mix_for[0] = gain;
+    c._mix_for[1] = pan_L;
+    c._mix_for[2] = pan_R;
+    c._mix_valid = true;
 }
 
-void MixerImplPrivate::mix_buffer_with_gain(float* dst, float* src, uint32_t nframes, float gain)
+void MixerImplPrivate::clear_fx(LadspaFX* effect, uint32_t nframes)
 {
-    add_with_gain t;
-    t.gain = gain;
-    std::transform(src, src+nframes, dst, dst, t);
+    memset(effect->m_pBuffer_L, 0, nframes * sizeof(float));
+    if( effect->getPluginType() == LadspaFX::STEREO_FX ) {
+	memset(effect->m_pBuffer_R, 0, nframes * sizeof(float));
+    }
 }
 
-float MixerImplPrivate::clip_buffer_get_peak(float* buf, uint32_t nframes)
+void MixerImplPrivate::mix_buffer_with_gain(float* dst, const float* src, uint32_t nframes, float gain)
 {
-    float max = 0.0, min = 0.0, tmp;
-
-    while(nframes--) {
-	tmp = buf[nframes];
-	if(tmp > 1.0f) {
-	    max = 1.0f;
-	    buf[nframes] = 1.0f;
-	} else if (tmp > max) {
-	    max = tmp;
-	} else if (tmp < -1.0f) {
-	    min = -1.0f;
-	    buf[nframes] = -1.0f;
-	} else if (tmp < min) {
-	    min = tmp;
-	}
+    for(uint32_t k=0 ; k<nframes ; ++k) {
+	dst[k] += src[k] * gain;
     }
-    min = -min;
-    if(min > max) max = min;
-    return max;
 }
 
 ////////////////////////////////////////////////////////////
@@ -25,12 +25,12 @@
 #include <Tritium/memory.hpp>
 #include "AudioPortImpl.hpp"
 #include <deque>
-#include <functional>
 #include <QMutex>
 
 namespace Tritium
 {
     class Effects;
+    class LadspaFX;
 
     class MixerImplPrivate
     {
@@ -47,6 +47,7 @@ namespace Tritium
 	QMutex _in_ports_mutex;
 	T<Effects>::shared_ptr _fx;
 	size_t _fx_count;
+	bool _post_fader_outs;
 
 	port_ref_t new_stereo_port();
 	port_ref_t new_mono_port();
@@ -54,27 +55,9 @@ namespace Tritium
 	channel_ref_t channel_for_port( const port_ref_t port );
 
 	static void eval_pan(float gain, float pan, float& left, float& right);
-	static void copy_buffer_no_gain(float* dst, float* src, uint32_t nframes);
-	static void copy_buffer_with_gain(float* dst, float* src, uint32_t nframes, float gain);
-	static void mix_buffer_no_gain(float* dst, float* src, uint32_t nframes);
-	static void mix_buffer_with_gain(float* dst, float* src, uint32_t nframes, float gain);
-	static float clip_buffer_get_peak(float* buf, uint32_t nframes);
-
-	struct mult_gain : public std::unary_function<float, float>
-	{
-	    float gain;
-	    float operator()(float t) {
-		return gain * t;
-	    }
-	};
-
-	struct add_with_gain : public std::binary_function<float, float, float>
-	{
-	    float gain;
-	    float operator()(float _new, float orig) {
-		return orig + _new * gain;
-	    }
-	};
+	static void pan_gains(Mixer::Channel& chan, float master, float from[4], float to[4]);
+	static void mix_buffer_with_gain(float* dst, const float* src, uint32_t nframes, float gain);
+	static void clear_fx(LadspaFX* effect, uint32_t nframes);
     };
 
     bool operator==(const T<Mixer::Channel>::shared_ptr chan, const T<AudioPort>::shared_ptr port) {
@@ -124,6 +107,12 @@ namespace Tritium
 	PanProperty<float> _pan_R;
 	std::deque<float> _send_gain;
 
+	// Mix-down state.  Only used by the audio thread, and not
+	// copied with the other properties.
+	float _mix_for[3];   // gain * master, pan_L, pan_R of _mix_gain
+	float _mix_gain[4];  // Pan gains (VoiceKernels::PAN_LL, etc.)
+	bool _mix_valid;
+
 	/* Default settings are for a stereo channel.
 	 */
 	ChannelPrivate(
@@ -137,7 +126,8 @@ namespace Tritium
 	    _gain(gain),
 	    _pan_L(pan_L),
 	    _pan_R(pan_R),
-	    _send_gain(sends, 0.0)
+	    _send_gain(sends, 0.0),
+	    _mix_valid(false)
 	    {
 	    }
 
@@ -146,7 +136,8 @@ namespace Tritium
 	    _gain(c._gain),
 	    _pan_L(c._pan_L),
 	    _pan_R(c._pan_R),
-	    _send_gain(c._send_gain)
+	    _send_gain(c._send_gain),
+	    _mix_valid(false)
 	    {
 	    }
 
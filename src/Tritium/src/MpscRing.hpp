@@ -0,0 +1,138 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+#ifndef TRITIUM_MPSCRING_HPP
+#define TRITIUM_MPSCRING_HPP
+
+#include <QAtomicInt>
+
+namespace Tritium
+{
+    /**
+     * \brief A bounded multi-producer, single-consumer queue.
+     *
+     * After Dmitry Vyukov's bounded MPMC queue.  Each cell has a
+     * sequence number.  The cell at position 'pos' is free for
+     * the producer that claims 'pos' when its sequence is 'pos',
+     * and ready for the consumer when it is 'pos + 1'.  Producers
+     * claim positions with a CAS on the write position, copy the
+     * item, and then release the cell by storing its sequence.
+     * The consumer releases the cell for the next round by
+     * setting its sequence to 'pos + capacity'.
+     *
+     * push() and pop() never lock or allocate.  Any number of
+     * threads may push(), but only one thread may pop().  When
+     * the ring is full, push() fails (nothing is overwritten).
+     *
+     * Positions wrap around at 2^32, which is a multiple of the
+     * capacity (a power of 2).
+     */
+    template <typename X>
+    class MpscRing
+    {
+    public:
+	/// The capacity is rounded up to a power of 2.
+	MpscRing(unsigned capacity) :
+	    _write_pos(0),
+	    _read_pos(0)
+	    {
+		unsigned size = 2;
+		while( size < capacity ) size <<= 1;
+		_cells = new Cell[size];
+		_mask = size - 1;
+		for( unsigned k = 0 ; k < size ; ++k ) {
+		    _cells[k].sequence = k;
+		}
+	    }
+
+	~MpscRing() {
+	    delete[] _cells;
+	}
+
+	unsigned capacity() {
+	    return _mask + 1;
+	}
+
+	/// Returns false if the ring is full.
+	bool push(const X& item) {
+	    unsigned pos = _write_pos.fetchAndAddAcquire(0);
+	    Cell *cell;
+	    for(;;) {
+		cell = &_cells[pos & _mask];
+		unsigned seq = cell->sequence.fetchAndAddAcquire(0);
+		int diff = int(seq - pos);
+		if( diff == 0 ) {
+		    if( _write_pos.testAndSetOrdered( int(pos), int(pos + 1) ) ) {
+			break;
+		    }
+		} else if( diff < 0 ) {
+		    return false;
+		}
+		pos = _write_pos.fetchAndAddAcquire(0);
+	    }
+
+	    cell->item = item;
+	    cell->sequence.fetchAndStoreRelease( int(pos + 1) );
+	    return true;
+	}
+
+	/// Consumer only.  Returns false if the ring is empty.
+	bool pop(X& item) {
+	    unsigned pos = _read_pos;
+	    Cell& cell = _cells[pos & _mask];
+	    unsigned seq = cell.sequence.fetchAndAddAcquire(0);
+	    if( seq != pos + 1 ) {
+		return false; // Empty (or the producer isn't done yet)
+	    }
+
+	    item = cell.item;
+	    cell.item = X(); // Don't keep a reference in the ring
+	    _read_pos = pos + 1;
+	    cell.sequence.fetchAndStoreRelease( int(pos + _mask + 1) );
+	    return true;
+	}
+
+	/// Consumer only.
+	bool empty() {
+	    unsigned pos = _read_pos;
+	    unsigned seq = _cells[pos & _mask].sequence.fetchAndAddAcquire(0);
+	    return seq != pos + 1;
+	}
+
+    private:
+	struct Cell
+	{
+	    QAtomicInt sequence;
+	    X item;
+	};
+
+	// Not copyable
+	MpscRing(const MpscRing&);
+	MpscRing& operator=(const MpscRing&);
+
+	Cell *_cells;
+	unsigned _mask;
+	QAtomicInt _write_pos;
+	unsigned _read_pos;
+    };
+
+} // namespace Tritium
+
+#endif // TRITIUM_MPSCRING_HPP
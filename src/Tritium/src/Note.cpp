@@ -38,16 +38,7 @@ Note::Note(
     float fPitch,
     NoteKey key
 )
-		: m_nSilenceOffset( 0 )
-		, m_nReleaseOffset( 0 )
-		, m_fSamplePosition( 0.0 )
-		, m_noteKey( key )
-		, m_fCutoff( 1.0 )
-		, m_fResonance( 0.0 )
-		, m_fBandPassFilterBuffer_L( 0.0 )
-		, m_fBandPassFilterBuffer_R( 0.0 )
-		, m_fLowPassFilterBuffer_L( 0.0 )
-		, m_fLowPassFilterBuffer_R( 0.0 )
+		: m_noteKey( key )
 		, m_nHumanizeDelay( 0 )
 		, __velocity( velocity )
 		, __leadlag( 0.0 )
@@ -65,17 +56,7 @@ Note::Note(
 
 Note::Note( const Note* pNote )
 {
-	m_nSilenceOffset          = pNote->m_nSilenceOffset;
-	m_nReleaseOffset          = pNote->m_nReleaseOffset;
-	m_fSamplePosition         = pNote->m_fSamplePosition;
 	m_noteKey                 = pNote->m_noteKey;
-	// m_adsr copied in set_instrument()
-	m_fCutoff                 = pNote->m_fCutoff;
-	m_fResonance              = pNote->m_fResonance;
-	m_fBandPassFilterBuffer_L = pNote->m_fBandPassFilterBuffer_L;
-	m_fBandPassFilterBuffer_R = pNote->m_fBandPassFilterBuffer_R;
-	m_fLowPassFilterBuffer_L  = pNote->m_fLowPassFilterBuffer_L;
-	m_fLowPassFilterBuffer_R  = pNote->m_fLowPassFilterBuffer_R;
 	m_nHumanizeDelay          = pNote->m_nHumanizeDelay;
 	set_instrument(             pNote->__instrument );
 	__velocity                = pNote->get_velocity();
@@ -103,23 +84,6 @@ void Note::set_instrument( T<Instrument>::shared_ptr instrument )
 	}
 
 	__instrument = instrument;
-	assert( __instrument->get_adsr() );
-	m_adsr = ADSR( *( __instrument->get_adsr() ) );
-
-	/*
-		if ( pInstrument->m_pADSR == NULL ) {
-			ERRORLOG( "NULL ADSR? Instrument: " + pInstrument->m_sName );
-		}
-		else {
-			DEBUGLOG( "copio l'adsr dallo strumento" );
-			if ( m_pADSR ) {
-				DEBUGLOG( "Replacing an existing ADSR" );
-				delete m_pADSR;
-				m_pADSR = NULL;
-			}
-			m_pADSR = new ADSR( *(m_pInstrument->m_pADSR) );
-		}
-	*/
 }
 
 
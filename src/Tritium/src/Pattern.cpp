@@ -78,6 +78,7 @@ void Pattern::purge_instrument( T<Instrument>::shared_ptr I, Engine* engine )
 	}
 	
 	if ( locked ) {
+		compile_events();
 		engine->unlock();
 		while ( slate.size() ) {
 			delete slate.front();
@@ -123,12 +124,31 @@ T<Pattern>::shared_ptr Pattern::copy()
 		Note *pNote = new Note( pos->second );
 		newPat->note_map.insert( std::make_pair( pos->first, pNote ) );
 	}
+	newPat->compile_events();
 
 	return newPat;
 }
 
 
 
+void Pattern::compile_events()
+{
+	event_table_t events;
+	events.reserve( note_map.size() );
+
+	Pattern::note_map_t::const_iterator pos;
+	for ( pos = note_map.begin(); pos != note_map.end(); ++pos ) {
+		if ( pos->first < 0 ) continue;
+		Event ev;
+		ev.tick = pos->first;
+		ev.note = pos->second;
+		events.push_back( ev );
+	}
+	__events.swap( events );
+}
+
+
+
 void Pattern::debug_dump()
 {
 	DEBUGLOG( "Pattern dump" );
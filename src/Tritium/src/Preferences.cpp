@@ -131,6 +131,12 @@ Preferences::Preferences()
 	m_bUseMetronome = false;
 	m_fMetronomeVolume = 0.5;
 	m_nMaxNotes = 256;
+	m_nSamplePreloadFrames = 0;
+	m_bSampleDiskCache = false;
+	m_nPresetCacheMegabytes = 256;
+	m_nRenderThreads = 0;
+	m_nRenderThreadPriority = 0;
+	m_bRenderThreadAffinity = false;
 	m_nBufferSize = 1024;
 	m_nSampleRate = 44100;
 
@@ -389,6 +395,12 @@ void Preferences::loadPreferences( bool bGlobal )
 				m_bUseMetronome = LocalFileMng::readXmlBool( audioEngineNode, "use_metronome", m_bUseMetronome );
 				m_fMetronomeVolume = LocalFileMng::readXmlFloat( audioEngineNode, "metronome_volume", 0.5f );
 				m_nMaxNotes = LocalFileMng::readXmlInt( audioEngineNode, "maxNotes", m_nMaxNotes );
+				m_nSamplePreloadFrames = LocalFileMng::readXmlInt( audioEngineNode, "samplePreloadFrames", m_nSamplePreloadFrames );
+				m_bSampleDiskCache = LocalFileMng::readXmlBool( audioEngineNode, "sampleDiskCache", m_bSampleDiskCache );
+				m_nPresetCacheMegabytes = LocalFileMng::readXmlInt( audioEngineNode, "presetCacheMegabytes", m_nPresetCacheMegabytes );
+				m_nRenderThreads = LocalFileMng::readXmlInt( audioEngineNode, "renderThreads", m_nRenderThreads );
+				m_nRenderThreadPriority = LocalFileMng::readXmlInt( audioEngineNode, "renderThreadPriority", m_nRenderThreadPriority );
+				m_bRenderThreadAffinity = LocalFileMng::readXmlBool( audioEngineNode, "renderThreadAffinity", m_bRenderThreadAffinity );
 				m_nBufferSize = LocalFileMng::readXmlInt( audioEngineNode, "buffer_size", m_nBufferSize );
 				m_nSampleRate = LocalFileMng::readXmlInt( audioEngineNode, "samplerate", m_nSampleRate );
 
@@ -703,6 +715,12 @@ void Preferences::savePreferences()
 		LocalFileMng::writeXmlString( audioEngineNode, "use_metronome", m_bUseMetronome ? "true": "false" );
 		LocalFileMng::writeXmlString( audioEngineNode, "metronome_volume", QString("%1").arg( m_fMetronomeVolume ) );
 		LocalFileMng::writeXmlString( audioEngineNode, "maxNotes", QString("%1").arg( m_nMaxNotes ) );
+		LocalFileMng::writeXmlString( audioEngineNode, "samplePreloadFrames", QString("%1").arg( m_nSamplePreloadFrames ) );
+		LocalFileMng::writeXmlString( audioEngineNode, "sampleDiskCache", m_bSampleDiskCache ? "true": "false" );
+		LocalFileMng::writeXmlString( audioEngineNode, "presetCacheMegabytes", QString("%1").arg( m_nPresetCacheMegabytes ) );
+		LocalFileMng::writeXmlString( audioEngineNode, "renderThreads", QString("%1").arg( m_nRenderThreads ) );
+		LocalFileMng::writeXmlString( audioEngineNode, "renderThreadPriority", QString("%1").arg( m_nRenderThreadPriority ) );
+		LocalFileMng::writeXmlString( audioEngineNode, "renderThreadAffinity", m_bRenderThreadAffinity ? "true": "false" );
 		LocalFileMng::writeXmlString( audioEngineNode, "buffer_size", QString("%1").arg( m_nBufferSize ) );
 		LocalFileMng::writeXmlString( audioEngineNode, "samplerate", QString("%1").arg( m_nSampleRate ) );
 
@@ -0,0 +1,292 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "ProcessProfiler.hpp"
+
+#include <QThread>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#ifdef WIN32
+#    include <Tritium/timehelper.hpp>
+#else
+#    include <time.h>
+#endif
+
+namespace Tritium
+{
+
+/*********************************************************************
+ * ProcessProfile
+ *********************************************************************
+ */
+
+float ProcessProfile::bin_end(unsigned bin)
+{
+    return std::pow(2.0, double(bin) / 4.0) / 1000.0;
+}
+
+const char* ProcessProfile::stage_name(stage_t stage)
+{
+    static const char* names[STAGE_COUNT] = {
+	"Input", "Sequencer", "Sampler", "FX", "Mixdown", "Total"
+    };
+    if( stage < 0 || stage >= STAGE_COUNT ) return "";
+    return names[stage];
+}
+
+/*********************************************************************
+ * ProcessProfiler
+ *********************************************************************
+ */
+
+ProcessProfiler::Results::Results() :
+    instrument_voices( MAX_INSTRUMENTS, 0 ),
+    instrument_last( MAX_INSTRUMENTS, 0 )
+{
+    instrument_max[0].resize( MAX_INSTRUMENTS, 0 );
+    instrument_max[1].resize( MAX_INSTRUMENTS, 0 );
+    clear();
+}
+
+void ProcessProfiler::Results::clear()
+{
+    clear_half(0);
+    clear_half(1);
+    current = 0;
+    memset( last, 0, sizeof(last) );
+    cycles = 0;
+    overruns = 0;
+    period = 0;
+    voices = 0;
+    instruments = 0;
+}
+
+void ProcessProfiler::Results::clear_half(unsigned h)
+{
+    memset( &half[h], 0, sizeof(Half) );
+    std::fill( instrument_max[h].begin(), instrument_max[h].end(), 0 );
+}
+
+ProcessProfiler::ProcessProfiler() :
+    _begin(0),
+    _mark(0),
+    _instrument_voices( MAX_INSTRUMENTS, 0 ),
+    _instrument_ns( MAX_INSTRUMENTS, 0 ),
+    _seq(0),
+    _reset(0)
+{
+    memset( _stage, 0, sizeof(_stage) );
+}
+
+uint64_t ProcessProfiler::now()
+{
+#ifdef WIN32
+    struct timeval tv;
+    gettimeofday( &tv, 0 );
+    return uint64_t(tv.tv_sec) * 1000000000ULL + uint64_t(tv.tv_usec) * 1000;
+#else
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return uint64_t(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+#endif
+}
+
+/**
+ * Bin 0 is everything under 1 us.  Bin k (k > 0) is from
+ * 2^((k-1)/4) to 2^(k/4) us.
+ */
+unsigned ProcessProfiler::bin(uint64_t ns)
+{
+    if( ns < 1000 ) return 0;
+
+    // us = m * 2^e, and 2m is in [1, 2).
+    int e;
+    double m2 = 2.0 * std::frexp( double(ns) / 1000.0, &e );
+    unsigned q = (m2 >= 1.1892071150027210) // 2^(1/4)
+	+ (m2 >= 1.4142135623730951)        // 2^(2/4)
+	+ (m2 >= 1.6817928305074290);       // 2^(3/4)
+    unsigned b = 4 * (e - 1) + q + 1;
+    return std::min( b, unsigned(ProcessProfile::HISTOGRAM_BINS - 1) );
+}
+
+void ProcessProfiler::begin_cycle(uint64_t t)
+{
+    _begin = t;
+    _mark = t;
+    memset( _stage, 0, sizeof(_stage) );
+}
+
+void ProcessProfiler::mark(ProcessProfile::stage_t stage, uint64_t t)
+{
+    _stage[stage] += t - _mark;
+    _mark = t;
+}
+
+void ProcessProfiler::set_instrument(unsigned index, unsigned voices, uint64_t ns)
+{
+    if( index >= MAX_INSTRUMENTS ) return;
+    _instrument_voices[index] = voices;
+    _instrument_ns[index] = ns;
+}
+
+void ProcessProfiler::end_cycle(uint64_t period, unsigned voices, unsigned instruments, uint64_t t)
+{
+    _stage[ProcessProfile::TOTAL] = t - _begin;
+
+    _seq.fetchAndAddOrdered(1);
+    update(period, voices, instruments);
+    _seq.fetchAndAddOrdered(1);
+}
+
+void ProcessProfiler::update(uint64_t period, unsigned voices, unsigned instruments)
+{
+    Results& r = _results;
+    unsigned k;
+
+    if( _reset.testAndSetOrdered(1, 0) ) {
+	r.clear();
+    }
+
+    if( r.half[r.current].count >= ProcessProfile::WINDOW_CYCLES ) {
+	r.current = ! r.current;
+	r.clear_half(r.current);
+    }
+
+    Half& h = r.half[r.current];
+    ++h.count;
+    for( k = 0 ; k < ProcessProfile::STAGE_COUNT ; ++k ) {
+	uint64_t t = _stage[k];
+	r.last[k] = t;
+	h.sum[k] += t;
+	if( t > h.max[k] ) h.max[k] = t;
+	++h.histogram[k][ bin(t) ];
+    }
+
+    ++r.cycles;
+    if( period && _stage[ProcessProfile::TOTAL] > period ) ++r.overruns;
+    r.period = period;
+    r.voices = voices;
+
+    r.instruments = std::min( instruments, unsigned(MAX_INSTRUMENTS) );
+    std::vector<uint64_t>& imax = r.instrument_max[r.current];
+    for( k = 0 ; k < r.instruments ; ++k ) {
+	r.instrument_voices[k] = _instrument_voices[k];
+	r.instrument_last[k] = _instrument_ns[k];
+	if( _instrument_ns[k] > imax[k] ) imax[k] = _instrument_ns[k];
+    }
+}
+
+void ProcessProfiler::reset()
+{
+    _reset.fetchAndStoreOrdered(1);
+}
+
+namespace
+{
+    inline float ms(uint64_t ns)
+    {
+	return float( double(ns) / 1000000.0 );
+    }
+
+    /// The time that 'fraction' of 'total' cycles are under.
+    float percentile(const uint32_t* histogram, uint32_t total,
+		     double fraction, float max)
+    {
+	if( total == 0 ) return 0.0f;
+	uint32_t target = uint32_t( std::ceil( fraction * total ) );
+	if( target == 0 ) target = 1;
+	uint32_t sum = 0;
+	unsigned b;
+	for( b = 0 ; b < ProcessProfile::HISTOGRAM_BINS - 1 ; ++b ) {
+	    sum += histogram[b];
+	    if( sum >= target ) break;
+	}
+	return std::min( ProcessProfile::bin_end(b), max );
+    }
+} // anonymous namespace
+
+void ProcessProfiler::get(ProcessProfile& p)
+{
+    Half half[2];
+    uint64_t last[ProcessProfile::STAGE_COUNT];
+    uint64_t cycles, period;
+    uint32_t overruns;
+    unsigned voices, instruments, k, j;
+    std::vector<unsigned> ivoices( MAX_INSTRUMENTS );
+    std::vector<uint64_t> ilast( MAX_INSTRUMENTS );
+    std::vector<uint64_t> imax( MAX_INSTRUMENTS );
+
+    for(;;) {
+	int seq = _seq.fetchAndAddAcquire(0);
+	if( seq & 1 ) {
+	    QThread::yieldCurrentThread();
+	    continue;
+	}
+	const Results& r = _results;
+	half[0] = r.half[0];
+	half[1] = r.half[1];
+	memcpy( last, r.last, sizeof(last) );
+	cycles = r.cycles;
+	period = r.period;
+	overruns = r.overruns;
+	voices = r.voices;
+	instruments = std::min( r.instruments, unsigned(MAX_INSTRUMENTS) );
+	for( k = 0 ; k < instruments ; ++k ) {
+	    ivoices[k] = r.instrument_voices[k];
+	    ilast[k] = r.instrument_last[k];
+	    imax[k] = std::max( r.instrument_max[0][k], r.instrument_max[1][k] );
+	}
+	if( _seq.fetchAndAddAcquire(0) == seq ) break;
+    }
+
+    uint32_t window = half[0].count + half[1].count;
+    for( k = 0 ; k < ProcessProfile::STAGE_COUNT ; ++k ) {
+	ProcessProfile::Stage& s = p.stages[k];
+	uint64_t sum = half[0].sum[k] + half[1].sum[k];
+	for( j = 0 ; j < ProcessProfile::HISTOGRAM_BINS ; ++j ) {
+	    s.histogram[j] = half[0].histogram[k][j] + half[1].histogram[k][j];
+	}
+	s.last = ms( last[k] );
+	s.mean = window ? ms( sum / window ) : 0.0f;
+	s.max = ms( std::max( half[0].max[k], half[1].max[k] ) );
+	s.p50 = percentile( s.histogram, window, 0.5, s.max );
+	s.p99 = percentile( s.histogram, window, 0.99, s.max );
+	s.p999 = percentile( s.histogram, window, 0.999, s.max );
+    }
+
+    p.instruments.resize( instruments );
+    for( k = 0 ; k < instruments ; ++k ) {
+	p.instruments[k].voices = ivoices[k];
+	p.instruments[k].render = ms( ilast[k] );
+	p.instruments[k].max = ms( imax[k] );
+    }
+
+    p.cycles = cycles;
+    p.window = window;
+    p.overruns = overruns;
+    p.xruns = 0;
+    p.period = ms( period );
+    p.voices = voices;
+}
+
+} // namespace Tritium
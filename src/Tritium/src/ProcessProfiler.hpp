@@ -0,0 +1,127 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+#ifndef TRITIUM_PROCESSPROFILER_HPP
+#define TRITIUM_PROCESSPROFILER_HPP
+
+#include <Tritium/ProcessProfile.hpp>
+#include <Tritium/globals.hpp>
+#include <QAtomicInt>
+#include <vector>
+#include <stdint.h>
+
+namespace Tritium
+{
+    /**
+     * \brief Times the stages of the audio engine's process() cycle.
+     *
+     * The audio thread calls begin_cycle(), mark() after each stage,
+     * and end_cycle().  It never locks or allocates.  Any other
+     * thread can call get() and reset().
+     *
+     * The results are published with a sequence lock: the audio
+     * thread makes the sequence number odd while it updates them
+     * and even when it is done.  get() copies them and tries again
+     * if the number changed.
+     *
+     * The window is two halves of WINDOW_CYCLES cycles.  When the
+     * current half is full, the other one is cleared and becomes
+     * the current one.
+     */
+    class ProcessProfiler
+    {
+    public:
+	ProcessProfiler();
+
+	/// Monotonic time (ns).
+	static uint64_t now();
+	/// The histogram bin of a time (ns).
+	static unsigned bin(uint64_t ns);
+
+	// Audio thread.  The versions with a time 't' (from now())
+	// are for tests.
+	void begin_cycle() { begin_cycle( now() ); }
+	void begin_cycle(uint64_t t);
+	/// End 'stage', which started at the previous mark.
+	void mark(ProcessProfile::stage_t stage) { mark( stage, now() ); }
+	void mark(ProcessProfile::stage_t stage, uint64_t t);
+	void set_instrument(unsigned index, unsigned voices, uint64_t ns);
+	/**
+	 * 'period' is the length of the cycle (ns).  The first
+	 * 'instruments' instruments set with set_instrument() are
+	 * published.
+	 */
+	void end_cycle(uint64_t period, unsigned voices, unsigned instruments) {
+	    end_cycle( period, voices, instruments, now() );
+	}
+	void end_cycle(uint64_t period, unsigned voices, unsigned instruments, uint64_t t);
+	/// Length of the last cycle (ns).
+	uint64_t last_total() { return _stage[ProcessProfile::TOTAL]; }
+
+	// Any thread
+	void get(ProcessProfile& profile);
+	void reset();
+
+    private:
+	struct Half
+	{
+	    uint32_t count;
+	    uint64_t sum[ProcessProfile::STAGE_COUNT];
+	    uint64_t max[ProcessProfile::STAGE_COUNT];
+	    uint32_t histogram[ProcessProfile::STAGE_COUNT][ProcessProfile::HISTOGRAM_BINS];
+	};
+
+	// Published with _seq.  Times are in ns.
+	struct Results
+	{
+	    Half half[2];
+	    unsigned current;
+	    uint64_t last[ProcessProfile::STAGE_COUNT];
+	    uint64_t cycles;
+	    uint32_t overruns;
+	    uint64_t period;
+	    unsigned voices;
+	    unsigned instruments;
+	    std::vector<unsigned> instrument_voices;
+	    std::vector<uint64_t> instrument_last;
+	    std::vector<uint64_t> instrument_max[2];
+
+	    Results();
+	    void clear();
+	    void clear_half(unsigned h);
+	};
+
+	void update(uint64_t period, unsigned voices, unsigned instruments);
+
+	// Audio thread
+	uint64_t _begin;
+	uint64_t _mark;
+	uint64_t _stage[ProcessProfile::STAGE_COUNT];
+	std::vector<unsigned> _instrument_voices;
+	std::vector<uint64_t> _instrument_ns;
+
+	Results _results;
+	QAtomicInt _seq;
+	QAtomicInt _reset;
+    };
+
+} // namespace Tritium
+
+#endif // TRITIUM_PROCESSPROFILER_HPP
@@ -0,0 +1,227 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <Tritium/Reaper.hpp>
+#include "RtSnapshot.hpp"
+#include "MpscRing.hpp"
+#include <QMutex>
+#include <QMutexLocker>
+#include <QAtomicInt>
+#include <deque>
+#include <vector>
+
+namespace Tritium
+{
+    namespace
+    {
+	/// A shared_ptr reference, or a pointer to 'destroy'.
+	struct Item
+	{
+	    T<void>::shared_ptr ref;
+	    void* ptr;
+	    void (*destroy)(void*);
+	    bool (*busy)(void*);  // Still in use (see Reaper::defer())
+	    size_t bytes;
+	    int mark;         // RtReader::mark() when deferred
+
+	    Item() : ptr(0), destroy(0), busy(0), bytes(0), mark(0) {}
+
+	    void free() {
+		if( ptr ) destroy(ptr);
+		ptr = 0;
+		ref.reset();
+	    }
+	};
+    } // anonymous namespace
+
+    struct ReaperPrivate
+    {
+	T<RtReader>::shared_ptr reader;
+	MpscRing<Item> ring;        // retire()'d by the audio thread
+	QMutex mutex;               // Guards the rest (not 'overflows')
+	std::deque<Item> deferred;
+	size_t pending_bytes;
+	uint64_t freed;
+	uint64_t freed_bytes;
+	QAtomicInt overflows;
+
+	ReaperPrivate(T<RtReader>::shared_ptr r, unsigned capacity) :
+	    reader(r),
+	    ring(capacity),
+	    pending_bytes(0),
+	    freed(0),
+	    freed_bytes(0),
+	    overflows(0)
+	    {}
+
+	// The reader is done with it and nobody else refers to it.
+	// 'busy' is tested last: once the reaper has the only
+	// reference, nothing can make it busy again.
+	bool is_ready(const Item& it) {
+	    if( ! reader->passed(it.mark) ) return false;
+	    if( ! (it.ptr || it.ref.unique()) ) return false;
+	    return ! (it.busy && it.busy( it.ptr ? it.ptr : it.ref.get() ));
+	}
+
+	void defer(Item& it) {
+	    it.mark = reader->mark();
+	    QMutexLocker lk(&mutex);
+	    deferred.push_back(it);
+	    pending_bytes += it.bytes;
+	}
+    };
+
+    Reaper::Reaper(T<RtReader>::shared_ptr reader, unsigned capacity) :
+	d( new ReaperPrivate(reader, capacity) )
+    {
+    }
+
+    Reaper::~Reaper()
+    {
+	collect(true);
+	delete d;
+    }
+
+    bool Reaper::retire(T<void>::shared_ptr ref, size_t bytes)
+    {
+	if( ! ref ) return true;
+	Item it;
+	it.ref = ref;
+	it.bytes = bytes;
+	if( d->ring.push(it) ) return true;
+	d->overflows.fetchAndAddOrdered(1);
+	return false;
+    }
+
+    bool Reaper::retire_raw(void* ptr, destroy_t fn, size_t bytes)
+    {
+	if( ! ptr ) return true;
+	Item it;
+	it.ptr = ptr;
+	it.destroy = fn;
+	it.bytes = bytes;
+	if( d->ring.push(it) ) return true;
+	d->overflows.fetchAndAddOrdered(1);
+	return false;
+    }
+
+    void Reaper::defer(T<void>::shared_ptr ref, size_t bytes, busy_t busy)
+    {
+	if( ! ref ) return;
+	Item it;
+	it.ref = ref;
+	it.busy = busy;
+	it.bytes = bytes;
+	d->defer(it);
+    }
+
+    void Reaper::defer_raw(void* ptr, destroy_t fn, size_t bytes)
+    {
+	if( ! ptr ) return;
+	Item it;
+	it.ptr = ptr;
+	it.destroy = fn;
+	it.bytes = bytes;
+	d->defer(it);
+    }
+
+    bool Reaper::ready()
+    {
+	if( ! d->ring.empty() ) return true;
+	QMutexLocker lk(&d->mutex);
+	std::deque<Item>::iterator k;
+	for( k = d->deferred.begin() ; k != d->deferred.end() ; ++k ) {
+	    if( d->is_ready(*k) ) return true;
+	}
+	return false;
+    }
+
+    /**
+     * Free the retired objects and the deferred objects that are
+     * ready.  The objects are freed without holding the lock, so
+     * defer() doesn't wait for a large sample to be freed.
+     */
+    unsigned Reaper::collect(bool all)
+    {
+	std::vector<Item> dead;
+	Item it;
+	while( d->ring.pop(it) ) {
+	    dead.push_back(it);
+	}
+	it = Item();
+
+	QMutexLocker lk(&d->mutex);
+	std::deque<Item>::iterator k = d->deferred.begin();
+	while( k != d->deferred.end() ) {
+	    if( all || d->is_ready(*k) ) {
+		d->pending_bytes -= k->bytes;
+		dead.push_back(*k);
+		k = d->deferred.erase(k);
+	    } else {
+		++k;
+	    }
+	}
+	lk.unlock();
+
+	size_t bytes = 0;
+	for( size_t j = 0 ; j < dead.size() ; ++j ) {
+	    bytes += dead[j].bytes;
+	    dead[j].free();
+	}
+
+	if( ! dead.empty() ) {
+	    lk.relock();
+	    d->freed += dead.size();
+	    d->freed_bytes += bytes;
+	}
+	return dead.size();
+    }
+
+    unsigned Reaper::pending()
+    {
+	QMutexLocker lk(&d->mutex);
+	return d->deferred.size();
+    }
+
+    size_t Reaper::pending_bytes()
+    {
+	QMutexLocker lk(&d->mutex);
+	return d->pending_bytes;
+    }
+
+    uint64_t Reaper::freed()
+    {
+	QMutexLocker lk(&d->mutex);
+	return d->freed;
+    }
+
+    uint64_t Reaper::freed_bytes()
+    {
+	QMutexLocker lk(&d->mutex);
+	return d->freed_bytes;
+    }
+
+    unsigned Reaper::overflows()
+    {
+	return d->overflows.fetchAndAddAcquire(0);
+    }
+
+} // namespace Tritium
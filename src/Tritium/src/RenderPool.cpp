@@ -0,0 +1,165 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "RenderPool.hpp"
+#include <Tritium/Logger.hpp>
+#include <QThread>
+#include <cerrno>
+#include <cstring> // strerror()
+#include <pthread.h>
+#include <sched.h>
+
+using namespace Tritium;
+
+class RenderPool::Worker : public QThread
+{
+public:
+    Worker(RenderPool* parent, int rt_priority, int cpu) :
+	_parent(parent),
+	_rt_priority(rt_priority),
+	_cpu(cpu)
+	{}
+
+    void run() {
+	int err;
+	if( _rt_priority > 0 ) {
+	    struct sched_param param;
+	    memset(&param, 0, sizeof(param));
+	    param.sched_priority = _rt_priority;
+	    err = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+	    if( err ) {
+		WARNINGLOG( QString("Render thread can not run SCHED_FIFO (priority %1): %2")
+			    .arg(_rt_priority)
+			    .arg(strerror(err)) );
+	    }
+	}
+#ifdef __linux__
+	if( _cpu >= 0 ) {
+	    cpu_set_t set;
+	    CPU_ZERO(&set);
+	    CPU_SET(_cpu, &set);
+	    err = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+	    if( err ) {
+		WARNINGLOG( QString("Could not pin render thread to CPU %1: %2")
+			    .arg(_cpu)
+			    .arg(strerror(err)) );
+	    }
+	}
+#endif
+	_parent->work();
+    }
+
+private:
+    RenderPool* _parent;
+    int _rt_priority;
+    int _cpu;
+};
+
+RenderPool::RenderPool(unsigned threads, int rt_priority, bool pin) :
+    _job(0),
+    _count(0),
+    _next(0),
+    _busy(0),
+    _kill(false)
+{
+    sem_init(&_wake, 0, 0);
+
+    int cpus = QThread::idealThreadCount();
+    for( unsigned k=0 ; k<threads ; ++k ) {
+	int cpu = -1;
+	if( pin && cpus > 1 ) {
+	    cpu = (k + 1) % cpus;
+	}
+	Worker* w = new Worker(this, rt_priority, cpu);
+	w->start();
+	_workers.push_back(w);
+    }
+}
+
+RenderPool::~RenderPool()
+{
+    size_t k;
+    _kill = true;
+    for( k=0 ; k<_workers.size() ; ++k ) {
+	sem_post(&_wake);
+    }
+    for( k=0 ; k<_workers.size() ; ++k ) {
+	_workers[k]->wait();
+	delete _workers[k];
+    }
+    sem_destroy(&_wake);
+}
+
+bool RenderPool::run_one()
+{
+    int k = _next.fetchAndAddOrdered(1);
+    if( k >= int(_count) ) {
+	return false;
+    }
+    (*_job)(k);
+    return true;
+}
+
+/**
+ * Worker thread loop.  A worker only leaves run_one() after
+ * every index has been taken, and run() waits for all the woken
+ * workers to get there.  So no worker is still taking indexes
+ * when run() starts the next job.
+ */
+void RenderPool::work()
+{
+    while( true ) {
+	while( sem_wait(&_wake) != 0 && errno == EINTR ) {}
+	if( _kill ) break;
+	while( run_one() ) {}
+	_busy.fetchAndAddOrdered(-1);
+    }
+}
+
+void RenderPool::run(Job& job, unsigned count)
+{
+    if( count == 0 ) return;
+
+    _job = &job;
+    _count = count;
+    _next.fetchAndStoreOrdered(0);
+
+    unsigned wake = count - 1;
+    if( wake > _workers.size() ) wake = _workers.size();
+    _busy.fetchAndStoreOrdered(wake);
+    for( unsigned k=0 ; k<wake ; ++k ) {
+	sem_post(&_wake);
+    }
+
+    // The calling thread works, too.
+    while( run_one() ) {}
+
+    // Workers that haven't woken up yet have nothing left to do.
+    // Take back their wake-ups instead of waiting for them.
+    while( _busy.fetchAndAddAcquire(0) > 0 && sem_trywait(&_wake) == 0 ) {
+	_busy.fetchAndAddOrdered(-1);
+    }
+
+    // The others are running the last indexes.
+    while( _busy.fetchAndAddAcquire(0) > 0 ) {
+	sched_yield();
+    }
+}
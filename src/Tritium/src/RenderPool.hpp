@@ -0,0 +1,87 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+#ifndef TRITIUM_RENDERPOOL_HPP
+#define TRITIUM_RENDERPOOL_HPP
+
+#include <QAtomicInt>
+#include <vector>
+#include <semaphore.h>
+
+namespace Tritium
+{
+    /**
+     * \brief Threads that help the audio thread render.
+     *
+     * run() hands out the indexes 0 ... count-1 of a Job to the
+     * worker threads and to the calling thread, and returns when
+     * all of them are done.  The indexes are taken with an atomic
+     * counter and the workers are woken with a semaphore, so run()
+     * does not lock or allocate and may be called from the JACK
+     * process callback.
+     *
+     * Which thread runs which index is not defined.  Jobs must
+     * write to separate data if the result is to be the same as
+     * running them in order on one thread.
+     */
+    class RenderPool
+    {
+    public:
+	class Job
+	{
+	public:
+	    virtual ~Job() {}
+	    virtual void operator()(unsigned index) = 0;
+	};
+
+	/**
+	 * Start 'threads' worker threads.  If rt_priority > 0 they
+	 * run SCHED_FIFO at that priority (if the system allows it).
+	 * If 'pin' is set, worker k is bound to CPU k+1 (modulo the
+	 * number of CPUs), which leaves CPU 0 to the audio thread.
+	 */
+	RenderPool(unsigned threads, int rt_priority = 0, bool pin = false);
+	~RenderPool();
+
+	/// Number of worker threads (not counting the caller of run()).
+	unsigned threads() { return _workers.size(); }
+
+	/// Run job(0) ... job(count-1).  Returns when all are done.
+	void run(Job& job, unsigned count);
+
+    private:
+	class Worker;
+	friend class Worker;
+
+	bool run_one();
+	void work();
+
+	std::vector<Worker*> _workers;
+	sem_t _wake;
+	Job* _job;
+	unsigned _count;
+	QAtomicInt _next;   // Next index to run
+	QAtomicInt _busy;   // Workers woken by run() that are not done yet
+	bool _kill;
+    };
+
+} // namespace Tritium
+
+#endif // TRITIUM_RENDERPOOL_HPP
@@ -0,0 +1,177 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+#ifndef TRITIUM_RTSNAPSHOT_HPP
+#define TRITIUM_RTSNAPSHOT_HPP
+
+#include <Tritium/memory.hpp>
+#include <QAtomicInt>
+#include <QAtomicPointer>
+#include <QMutex>
+#include <QMutexLocker>
+#include <deque>
+#include <unistd.h> // usleep()
+
+namespace Tritium
+{
+    /**
+     * \brief Tracks the read sections of one real-time thread.
+     *
+     * The reader (e.g. the audio thread) calls enter() before it
+     * reads any RtSnapshot that uses this RtReader and leave() when
+     * it is done with everything it read.  Both are a single atomic
+     * store, so they never block.
+     *
+     * A writer that replaced something can free the old version
+     * once the reader has passed the point where the writer
+     * replaced it: either the reader was outside of a section, or
+     * it has finished a section since then.  mark() takes the point
+     * and passed() checks it.  Only one thread may be the reader.
+     */
+    class RtReader
+    {
+    public:
+	RtReader() : _active(0), _sections(0) {}
+
+	// Reader
+	void enter() {
+	    _active.fetchAndStoreOrdered(1);
+	}
+	void leave() {
+	    _sections.fetchAndAddOrdered(1);
+	    _active.fetchAndStoreOrdered(0);
+	}
+
+	// Writers
+	int mark() {
+	    return _sections.fetchAndAddOrdered(0);
+	}
+	bool passed(int mark) {
+	    return ( _active.fetchAndAddOrdered(0) == 0 )
+		|| ( _sections.fetchAndAddOrdered(0) != mark );
+	}
+	/// Wait until the reader has passed this point.  Never call
+	/// it from inside a section.
+	void synchronize() {
+	    int m = mark();
+	    while( ! passed(m) ) {
+		usleep(100);
+	    }
+	}
+
+    private:
+	QAtomicInt _active;    // The reader is inside a section
+	QAtomicInt _sections;  // Number of finished sections
+    };
+
+    /**
+     * \brief Immutable data published to a real-time reader.
+     *
+     * Read-copy-update: writers never change the published object.
+     * They build a new one and publish() it, which swaps a pointer.
+     * The reader calls get() (between RtReader::enter() and
+     * leave()) and can use the object until leave().  The old
+     * object is kept on a retired list until the reader has passed
+     * the swap, and then collect() drops it.  Since the objects are
+     * shared_ptr's, whatever they hold is deleted in the writer's
+     * thread, never in the reader's.
+     *
+     * Writers are serialized with an internal mutex.  current()
+     * may be called from any thread except the reader.
+     */
+    template <typename X>
+    class RtSnapshot
+    {
+    public:
+	typedef typename T<X>::shared_ptr pointer_t;
+
+	RtSnapshot(RtReader& reader, pointer_t initial = pointer_t()) :
+	    _reader(reader),
+	    _current(initial),
+	    _rt(initial.get())
+	    {}
+
+	/// Deletes everything.  The reader must be gone.
+	~RtSnapshot() {}
+
+	/// Reader only.  Valid until RtReader::leave().
+	X* get() {
+	    return _rt.fetchAndAddAcquire(0);
+	}
+
+	/// The published object, for writers to copy from.
+	pointer_t current() {
+	    QMutexLocker lk(&_mutex);
+	    return _current;
+	}
+
+	/// Make 'next' the object the reader sees.  Never blocks
+	/// the reader.
+	void publish(pointer_t next) {
+	    QMutexLocker lk(&_mutex);
+	    _rt.fetchAndStoreOrdered(next.get());
+	    Retired r;
+	    r.ptr = _current;
+	    r.mark = _reader.mark();
+	    _current = next;
+	    if( r.ptr ) _retired.push_back(r);
+	    collect_locked();
+	}
+
+	/// Drop the retired objects that the reader has passed.
+	void collect() {
+	    QMutexLocker lk(&_mutex);
+	    collect_locked();
+	}
+
+	/// Number of objects waiting for the reader.
+	size_t retired() {
+	    QMutexLocker lk(&_mutex);
+	    return _retired.size();
+	}
+
+    private:
+	struct Retired
+	{
+	    pointer_t ptr;
+	    int mark;
+	};
+
+	void collect_locked() {
+	    while( ! _retired.empty()
+		   && _reader.passed( _retired.front().mark ) ) {
+		_retired.pop_front();
+	    }
+	}
+
+	// Not copyable
+	RtSnapshot(const RtSnapshot&);
+	RtSnapshot& operator=(const RtSnapshot&);
+
+	RtReader& _reader;
+	QMutex _mutex;
+	pointer_t _current;
+	QAtomicPointer<X> _rt;
+	std::deque<Retired> _retired;
+    };
+
+} // namespace Tritium
+
+#endif // TRITIUM_RTSNAPSHOT_HPP
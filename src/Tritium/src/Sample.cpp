@@ -44,24 +44,55 @@ Sample::Sample(
 	, __sample_rate( sample_rate )
 	, __filename( filename )
 	, __n_frames( frames )
+	, __total_frames( frames )
 {
 		//DEBUGLOG("INIT " + m_sFilename + ". nFrames: " + toString( nFrames ) );
 }
 
 
 
+Sample::Sample(
+	unsigned frames,
+	const QString& filename,
+	unsigned sample_rate,
+	T<MappedFile>::shared_ptr mapping,
+	float* data_l,
+	float* data_r
+	)
+	: __data_l( data_l )
+	, __data_r( data_r )
+	, __sample_rate( sample_rate )
+	, __filename( filename )
+	, __n_frames( frames )
+	, __total_frames( frames )
+	, __mapping( mapping )
+{
+}
+
+
+
 Sample::~Sample()
 {
-	delete[] __data_l;
-	delete[] __data_r;
+	if ( ! __mapping ) {
+		delete[] __data_l;
+		delete[] __data_r;
+	}
 	//DEBUGLOG( "DESTROY " + m_sFilename);
 }
 
 
 
 
-T<Sample>::shared_ptr Sample::load( const QString& filename )
+T<Sample>::shared_ptr Sample::load( const QString& filename, unsigned preload_frames )
 {
+	if ( preload_frames > 0 ) {
+		T<Sample>::shared_ptr pSample = load_head( filename, preload_frames );
+		if ( pSample ) {
+			return pSample;
+		}
+		// Short file, or libsndfile can't read it: load it all.
+	}
+
 	// is it a flac file?
 	if ( ( filename.endsWith( "flac") ) || ( filename.endsWith( "FLAC" )) ) {
 		return load_flac( filename );
@@ -138,6 +169,62 @@ T<Sample>::shared_ptr Sample::load_wave( const QString& filename )
 }
 
 
+/// Load only the head of a sample.  The rest is read by the
+/// Sampler's streamer (through libsndfile) while the note plays.
+/// Returns a null pointer if the file is not longer than
+/// preload_frames or can not be opened.
+T<Sample>::shared_ptr Sample::load_head( const QString& filename, unsigned preload_frames )
+{
+	SF_INFO soundInfo;
+	soundInfo.format = 0;
+	SNDFILE* file = sf_open( filename.toLocal8Bit(), SFM_READ, &soundInfo );
+	if ( !file ) {
+		return T<Sample>::shared_ptr();
+	}
+	if ( soundInfo.frames <= (sf_count_t)preload_frames
+	     || soundInfo.channels < 1 || soundInfo.channels > 2 ) {
+		sf_close( file );
+		return T<Sample>::shared_ptr();
+	}
+
+	float *pTmpBuffer = new float[ preload_frames * soundInfo.channels ];
+	sf_count_t nRead = sf_readf_float( file, pTmpBuffer, preload_frames );
+	sf_close( file );
+	if ( nRead != (sf_count_t)preload_frames ) {
+		delete[] pTmpBuffer;
+		return T<Sample>::shared_ptr();
+	}
+
+	float *data_l = new float[ preload_frames ];
+	float *data_r = new float[ preload_frames ];
+
+	if ( soundInfo.channels == 1 ) {	// MONO sample
+		for ( unsigned i = 0; i < preload_frames; i++ ) {
+			data_l[i] = pTmpBuffer[i];
+			data_r[i] = pTmpBuffer[i];
+		}
+	} else {				// STEREO sample
+		for ( unsigned i = 0; i < preload_frames; i++ ) {
+			data_l[i] = pTmpBuffer[i * 2];
+			data_r[i] = pTmpBuffer[i * 2 + 1];
+		}
+	}
+	delete[] pTmpBuffer;
+
+	T<Sample>::shared_ptr pSample(
+	    new Sample(
+		preload_frames,
+		filename,
+		soundInfo.samplerate,
+		data_l,
+		data_r
+		)
+	    );
+	pSample->__total_frames = soundInfo.frames;
+	return pSample;
+}
+
+
 /*
 void Sample::save( const string& sFilename )
 {
@@ -0,0 +1,460 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <Tritium/SampleRateCache.hpp>
+#include <Tritium/Sample.hpp>
+#include <Tritium/Logger.hpp>
+#include "MappedFile.hpp"
+#include <QMutex>
+#include <QMutexLocker>
+#include <QFile>
+#include <QFileInfo>
+#include <QDir>
+#include <QDateTime>
+#include <QCryptographicHash>
+#include <map>
+#include <vector>
+#include <cmath>
+#include <cstring>
+#include <stdint.h>
+#include <unistd.h> // getpid()
+
+namespace Tritium
+{
+    namespace
+    {
+	/**
+	 * Windowed sinc interpolator.  The kernel is a sinc with its
+	 * cutoff a little under the lower of the two Nyquist
+	 * frequencies, and a Kaiser window that is ZERO_CROSSINGS
+	 * long on each side.  It is tabulated at TABLE_RES points per
+	 * zero crossing and linearly interpolated.
+	 */
+	class SincFilter
+	{
+	public:
+	    enum { ZERO_CROSSINGS = 32, TABLE_RES = 512 };
+
+	    SincFilter(unsigned in_rate, unsigned out_rate);
+
+	    static unsigned output_frames(unsigned in_frames, unsigned in_rate, unsigned out_rate) {
+		uint64_t n = uint64_t(in_frames) * out_rate + in_rate - 1;
+		return unsigned(n / in_rate);
+	    }
+
+	    void process(const float* in_L, const float* in_R, unsigned in_frames,
+			 float* out_L, float* out_R, unsigned out_frames);
+
+	private:
+	    float weight(double distance) {
+		double x = distance * _scale * TABLE_RES;
+		unsigned k = unsigned(x);
+		if( k >= ZERO_CROSSINGS * TABLE_RES ) return 0.0f;
+		float frac = float(x - k);
+		return _table[k] + frac * (_table[k+1] - _table[k]);
+	    }
+
+	    unsigned _in_rate;
+	    unsigned _out_rate;
+	    double _scale;             // Cutoff, relative to the input Nyquist
+	    int _taps;                 // Input frames on each side
+	    std::vector<float> _table; // Kernel * _scale, for [0, ZERO_CROSSINGS]
+	};
+
+	const double ROLLOFF = 0.90;     // Cutoff, relative to Nyquist
+	const double KAISER_BETA = 8.0;  // About -80 dB stopband
+
+	// Modified Bessel function of the first kind, order 0.
+	double bessel_i0(double x)
+	{
+	    double sum = 1.0, term = 1.0;
+	    for( int k = 1 ; k < 50 ; ++k ) {
+		term *= (x / (2.0 * k)) * (x / (2.0 * k));
+		sum += term;
+		if( term < sum * 1e-12 ) break;
+	    }
+	    return sum;
+	}
+
+	SincFilter::SincFilter(unsigned in_rate, unsigned out_rate) :
+	    _in_rate(in_rate),
+	    _out_rate(out_rate)
+	{
+	    _scale = ROLLOFF;
+	    if( out_rate < in_rate ) {
+		_scale *= double(out_rate) / double(in_rate);
+	    }
+	    _taps = int( ceil( ZERO_CROSSINGS / _scale ) );
+
+	    const unsigned size = ZERO_CROSSINGS * TABLE_RES;
+	    const double norm = bessel_i0(KAISER_BETA);
+	    _table.resize( size + 2 );
+	    for( unsigned k = 0 ; k <= size ; ++k ) {
+		double x = double(k) / TABLE_RES;
+		double sinc = (k == 0) ? 1.0 : sin(M_PI * x) / (M_PI * x);
+		double r = x / ZERO_CROSSINGS;
+		double window = bessel_i0( KAISER_BETA * sqrt(1.0 - r * r) ) / norm;
+		_table[k] = float( _scale * sinc * window );
+	    }
+	    _table[size + 1] = 0.0f;
+	}
+
+	void SincFilter::process(const float* in_L, const float* in_R, unsigned in_frames,
+				 float* out_L, float* out_R, unsigned out_frames)
+	{
+	    const double step = double(_in_rate) / double(_out_rate);
+	    const int last = int(in_frames) - 1;
+
+	    for( unsigned n = 0 ; n < out_frames ; ++n ) {
+		double center = double(n) * step;
+		int mid = int( floor(center) );
+		int lo = mid - _taps + 1;
+		int hi = mid + _taps;
+		if( lo < 0 ) lo = 0;
+		if( hi > last ) hi = last;
+
+		float sum_L = 0.0f, sum_R = 0.0f;
+		for( int i = lo ; i <= hi ; ++i ) {
+		    float w = weight( fabs(center - i) );
+		    sum_L += w * in_L[i];
+		    sum_R += w * in_R[i];
+		}
+		out_L[n] = sum_L;
+		out_R[n] = sum_R;
+	    }
+	}
+
+	/*
+	 * Disk cache files are the decoded data, tagged with the
+	 * source file's path, size and time so that a changed file
+	 * doesn't match.  The file is a DiskHeader, the left channel
+	 * and the right channel.  Each channel is padded to a
+	 * multiple of 4 frames, so that both start 16-byte aligned
+	 * when the file is mapped.
+	 */
+	const char DISK_MAGIC[4] = { 'T', 'S', 'R', 'C' };
+	const uint32_t DISK_VERSION = 2;
+
+	struct DiskHeader
+	{
+	    char magic[4];
+	    uint32_t version;
+	    uint32_t sample_rate;
+	    uint32_t frames;
+	};
+
+	uint64_t disk_stride(uint32_t frames)
+	{
+	    return (uint64_t(frames) + 3) & ~uint64_t(3);
+	}
+
+	// Sample::load() would only load the head of this sample.
+	bool too_long(T<Sample>::shared_ptr sample, unsigned preload_frames)
+	{
+	    return sample && preload_frames > 0
+		&& sample->get_n_frames() > preload_frames;
+	}
+
+    } // anonymous namespace
+
+    struct SampleRateCachePrivate
+    {
+	struct Entry
+	{
+	    T<Sample>::weak_ptr sample;
+	    qint64 size;           // Of the source file
+	    QDateTime modified;    // Of the source file
+	};
+	typedef std::map<QString, Entry> map_t;
+
+	QMutex mutex;
+	unsigned rate;
+	QString disk_dir;
+	map_t samples;   // Absolute file name --> loaded sample
+
+	SampleRateCachePrivate() : rate(0) {}
+
+	QString disk_file(const QFileInfo& info, unsigned rate);
+	T<Sample>::shared_ptr read_disk(const QString& path, const QString& filename, unsigned rate);
+	bool write_disk(const QString& path, T<Sample>::shared_ptr sample);
+    };
+
+    /**
+     * The disk cache file for 'info' at 'rate' (0 = the file's own
+     * rate), or an empty string if there is no disk cache.
+     */
+    QString SampleRateCachePrivate::disk_file(const QFileInfo& info, unsigned rate)
+    {
+	QString dir;
+	{
+	    QMutexLocker lk(&mutex);
+	    dir = disk_dir;
+	}
+	if( dir.isEmpty() ) return QString();
+
+	QString tag = QString("%1\n%2\n%3")
+	    .arg(info.absoluteFilePath())
+	    .arg(info.size())
+	    .arg(info.lastModified().toTime_t());
+	QByteArray hash = QCryptographicHash::hash( tag.toUtf8(), QCryptographicHash::Md5 );
+	return QString("%1/%2-%3.raw")
+	    .arg(dir)
+	    .arg( QString(hash.toHex()) )
+	    .arg(rate);
+    }
+
+    /**
+     * Map a disk cache file.  The sample's data points into the
+     * mapping, so every sample (in any process) that maps the same
+     * file shares the memory.
+     */
+    T<Sample>::shared_ptr SampleRateCachePrivate::read_disk(const QString& path,
+							     const QString& filename,
+							     unsigned rate)
+    {
+	T<Sample>::shared_ptr rv;
+	if( path.isEmpty() || ! QFile::exists(path) ) return rv;
+
+	T<MappedFile>::shared_ptr map( new MappedFile );
+	if( ! map->map(path) ) return rv;
+
+	const DiskHeader* h = reinterpret_cast<const DiskHeader*>( map->data() );
+	if( map->size() < sizeof(DiskHeader)
+	    || memcmp(h->magic, DISK_MAGIC, 4) != 0
+	    || h->version != DISK_VERSION
+	    || h->frames == 0
+	    || ( rate != 0 && h->sample_rate != rate )
+	    || map->size() != sizeof(DiskHeader) + 2 * sizeof(float) * disk_stride(h->frames) ) {
+	    WARNINGLOG( QString("Ignoring bad sample cache file %1").arg(path) );
+	    return rv;
+	}
+
+	float* data_l = (float*)( map->data() + sizeof(DiskHeader) );
+	float* data_r = data_l + disk_stride(h->frames);
+	rv.reset( new Sample(h->frames, filename, h->sample_rate, map, data_l, data_r) );
+	return rv;
+    }
+
+    bool SampleRateCachePrivate::write_disk(const QString& path, T<Sample>::shared_ptr sample)
+    {
+	if( path.isEmpty() ) return false;
+	QFileInfo info(path);
+	QDir().mkpath( info.absolutePath() );
+
+	// Write to a temporary file and rename, so that another
+	// process never maps a partial file.
+	QString tmp = QString("%1.%2.%3.tmp")
+	    .arg(path)
+	    .arg( (qulonglong)getpid() )
+	    .arg( (qulonglong)sample.get() );
+	QFile file(tmp);
+	if( ! file.open(QIODevice::WriteOnly) ) {
+	    WARNINGLOG( QString("Could not write sample cache file %1").arg(tmp) );
+	    return false;
+	}
+
+	DiskHeader h;
+	memcpy(h.magic, DISK_MAGIC, 4);
+	h.version = DISK_VERSION;
+	h.sample_rate = sample->get_sample_rate();
+	h.frames = sample->get_n_frames();
+	qint64 bytes = qint64(h.frames) * sizeof(float);
+	qint64 pad_bytes = qint64(disk_stride(h.frames) - h.frames) * sizeof(float);
+	const char pad[4 * sizeof(float)] = { 0 };
+	bool ok = file.write( (const char*)&h, sizeof(h) ) == qint64(sizeof(h))
+	    && file.write( (const char*)sample->get_data_l(), bytes ) == bytes
+	    && file.write( pad, pad_bytes ) == pad_bytes
+	    && file.write( (const char*)sample->get_data_r(), bytes ) == bytes
+	    && file.write( pad, pad_bytes ) == pad_bytes;
+	file.close();
+
+	// Processes that have the old file mapped keep their copy.
+	QFile::remove(path);
+	if( ! ok || ! QFile::rename(tmp, path) ) {
+	    WARNINGLOG( QString("Could not write sample cache file %1").arg(path) );
+	    QFile::remove(tmp);
+	    return false;
+	}
+	return true;
+    }
+
+    SampleRateCache::SampleRateCache() :
+	d( new SampleRateCachePrivate )
+    {
+    }
+
+    SampleRateCache::~SampleRateCache()
+    {
+	delete d;
+	d = 0;
+    }
+
+    void SampleRateCache::set_sample_rate(unsigned rate)
+    {
+	QMutexLocker lk(&d->mutex);
+	if( rate != d->rate ) {
+	    d->rate = rate;
+	    d->samples.clear();
+	}
+    }
+
+    unsigned SampleRateCache::get_sample_rate()
+    {
+	QMutexLocker lk(&d->mutex);
+	return d->rate;
+    }
+
+    void SampleRateCache::set_disk_cache(const QString& dir)
+    {
+	QMutexLocker lk(&d->mutex);
+	d->disk_dir = dir;
+    }
+
+    QString SampleRateCache::get_disk_cache()
+    {
+	QMutexLocker lk(&d->mutex);
+	return d->disk_dir;
+    }
+
+    bool SampleRateCache::matches(T<Sample>::shared_ptr sample)
+    {
+	unsigned rate = get_sample_rate();
+	return ( ! sample )
+	    || rate == 0
+	    || sample->get_sample_rate() == 0
+	    || sample->get_sample_rate() == rate
+	    || sample->is_streaming();
+    }
+
+    void SampleRateCache::clear()
+    {
+	QMutexLocker lk(&d->mutex);
+	d->samples.clear();
+    }
+
+    /**
+     * Load 'filename' (see Sample::load()) and convert it to
+     * get_sample_rate().  Returns the sample from memory if it is
+     * already loaded, or maps it from the disk cache if there is
+     * one.  Otherwise it is decoded (and converted) and saved to
+     * the disk cache.  Streaming samples are returned as they are
+     * loaded.
+     */
+    T<Sample>::shared_ptr SampleRateCache::load(const QString& filename, unsigned preload_frames)
+    {
+	unsigned rate = get_sample_rate();
+	if( rate == 0 && get_disk_cache().isEmpty() ) {
+	    return Sample::load( filename, preload_frames );
+	}
+
+	QFileInfo info(filename);
+	QString key = info.absoluteFilePath();
+	SampleRateCachePrivate::map_t::iterator it;
+	T<Sample>::shared_ptr pSample;
+
+	{
+	    QMutexLocker lk(&d->mutex);
+	    it = d->samples.find(key);
+	    if( it != d->samples.end()
+		&& it->second.size == info.size()
+		&& it->second.modified == info.lastModified() ) {
+		pSample = it->second.sample.lock();
+	    }
+	}
+	if( pSample && ( rate == 0 || pSample->get_sample_rate() == rate )
+	    && ! too_long(pSample, preload_frames) ) {
+	    return pSample;
+	}
+
+	QString disk = d->disk_file(info, rate);
+	pSample = d->read_disk(disk, filename, rate);
+	if( too_long(pSample, preload_frames) ) {
+	    pSample.reset(); // Stream it instead.
+	}
+	if( ! pSample ) {
+	    pSample = Sample::load( filename, preload_frames );
+	    if( ! pSample || pSample->is_streaming() ) {
+		return pSample;
+	    }
+	    if( rate != 0 && pSample->get_sample_rate() != rate ) {
+		pSample = resample( pSample, rate );
+	    }
+	    // Map what was saved, so that the first process shares
+	    // the memory too.
+	    if( d->write_disk(disk, pSample) ) {
+		T<Sample>::shared_ptr pMapped = d->read_disk(disk, filename, rate);
+		if( pMapped ) pSample = pMapped;
+	    }
+	}
+
+	QMutexLocker lk(&d->mutex);
+	if( d->rate == rate ) {
+	    // Drop the entries of samples that were freed.
+	    for( it = d->samples.begin() ; it != d->samples.end() ; ) {
+		if( it->second.sample.expired() ) {
+		    d->samples.erase(it++);
+		} else {
+		    ++it;
+		}
+	    }
+	    SampleRateCachePrivate::Entry& e = d->samples[key];
+	    e.sample = pSample;
+	    e.size = info.size();
+	    e.modified = info.lastModified();
+	}
+	return pSample;
+    }
+
+    /**
+     * Returns a copy of 'sample' at 'rate'.  Returns 'sample' itself
+     * if it is already at that rate or it is streaming.
+     */
+    T<Sample>::shared_ptr SampleRateCache::resample(T<Sample>::shared_ptr sample, unsigned rate)
+    {
+	if( ! sample
+	    || rate == 0
+	    || sample->get_sample_rate() == 0
+	    || sample->get_sample_rate() == rate
+	    || sample->is_streaming()
+	    || sample->get_n_frames() == 0 ) {
+	    return sample;
+	}
+
+	unsigned in_rate = sample->get_sample_rate();
+	unsigned frames = SincFilter::output_frames( sample->get_n_frames(), in_rate, rate );
+	float *data_l = new float[frames];
+	float *data_r = new float[frames];
+
+	SincFilter filter( in_rate, rate );
+	filter.process( sample->get_data_l(), sample->get_data_r(), sample->get_n_frames(),
+			data_l, data_r, frames );
+
+	DEBUGLOG( QString("Converted %1 from %2 Hz to %3 Hz")
+		  .arg(sample->get_filename())
+		  .arg(in_rate)
+		  .arg(rate) );
+
+	return T<Sample>::shared_ptr(
+	    new Sample( frames, sample->get_filename(), rate, data_l, data_r )
+	    );
+    }
+
+} // namespace Tritium
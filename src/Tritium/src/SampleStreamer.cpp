@@ -0,0 +1,282 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "SampleStreamer.hpp"
+#include <Tritium/Sample.hpp>
+#include <Tritium/Logger.hpp>
+#include <cstring>
+#include <cassert>
+
+using namespace Tritium;
+
+SampleStreamer::Stream::Stream() :
+    state(Free),
+    eof(0),
+    ring_L(RING_FRAMES),
+    ring_R(RING_FRAMES),
+    file(0),
+    channels(0),
+    head(0),
+    ring_frame(0),
+    win_start(0),
+    win_len(0)
+{
+}
+
+SampleStreamer::SampleStreamer() :
+    _streams(MAX_STREAMS),
+    _read_buf(READ_CHUNK * 2),
+    _split_L(READ_CHUNK),
+    _split_R(READ_CHUNK),
+    _underruns(0),
+    _kill(false)
+{
+    for( size_t k=0 ; k<_streams.size() ; ++k ) {
+	_streams[k] = new Stream;
+    }
+}
+
+SampleStreamer::~SampleStreamer()
+{
+    for( size_t k=0 ; k<_streams.size() ; ++k ) {
+	if( _streams[k]->file ) {
+	    sf_close( _streams[k]->file );
+	}
+	delete _streams[k];
+    }
+}
+
+int SampleStreamer::open(T<Sample>::shared_ptr sample)
+{
+    int k;
+    for( k=0 ; k<int(_streams.size()) ; ++k ) {
+	Stream& s = *_streams[k];
+	if( int(s.state) != Free ) continue;
+
+	// The worker leaves Claimed streams alone, so this slot
+	// is ours until we publish it.
+	if( ! s.state.testAndSetAcquire(Free, Claimed) ) continue;
+	s.sample = sample;
+	s.head = sample->get_n_frames();
+	s.ring_frame = s.head;
+	s.win_start = 0;
+	s.win_len = 0;
+	s.eof = 0;
+	s.state.fetchAndStoreRelease(Opening);
+	return k;
+    }
+    return -1;
+}
+
+void SampleStreamer::close(int id)
+{
+    assert( id >= 0 && id < int(_streams.size()) );
+    _streams[id]->state.fetchAndStoreRelease(Closing);
+}
+
+/**
+ * Copy frames [frame, frame+count) of the sample into dest.  The
+ * head comes from memory, the rest from the rings.
+ */
+void SampleStreamer::fill(Stream& s, float* dest_L, float* dest_R, uint32_t frame, uint32_t count)
+{
+    uint32_t n;
+
+    // From the head
+    if( frame < s.head ) {
+	n = s.head - frame;
+	if( n > count ) n = count;
+	memcpy( dest_L, s.sample->get_data_l() + frame, n * sizeof(float) );
+	memcpy( dest_R, s.sample->get_data_r() + frame, n * sizeof(float) );
+	dest_L += n;
+	dest_R += n;
+	frame += n;
+	count -= n;
+    }
+    if( count == 0 ) return;
+
+    // Skip anything in the ring that we no longer need (e.g. after
+    // an underrun).
+    uint32_t avail = s.ring_L.read_space();
+    if( s.ring_R.read_space() < avail ) avail = s.ring_R.read_space();
+    if( frame > s.ring_frame ) {
+	n = frame - s.ring_frame;
+	if( n > avail ) n = avail;
+	s.ring_L.increment_read_idx(n);
+	s.ring_R.increment_read_idx(n);
+	s.ring_frame += n;
+	avail -= n;
+    }
+
+    if( frame == s.ring_frame ) {
+	n = (count < avail) ? count : avail;
+	s.ring_L.read(dest_L, n);
+	s.ring_R.read(dest_R, n);
+	s.ring_frame += n;
+	dest_L += n;
+	dest_R += n;
+	count -= n;
+    }
+
+    if( count ) {
+	memset( dest_L, 0, count * sizeof(float) );
+	memset( dest_R, 0, count * sizeof(float) );
+	if( ! s.eof.fetchAndAddAcquire(0) ) {
+	    _underruns.fetchAndAddRelaxed(1);
+	}
+    }
+}
+
+void SampleStreamer::window(int id, uint32_t first, uint32_t count,
+			    const float** L, const float** R)
+{
+    assert( id >= 0 && id < int(_streams.size()) );
+    assert( count <= WINDOW_FRAMES );
+    Stream& s = *_streams[id];
+
+    if( first < s.win_start || first >= s.win_start + s.win_len ) {
+	s.win_start = first;
+	s.win_len = 0;
+    } else if( first > s.win_start ) {
+	uint32_t shift = first - s.win_start;
+	s.win_len -= shift;
+	memmove( s.win_L, s.win_L + shift, s.win_len * sizeof(float) );
+	memmove( s.win_R, s.win_R + shift, s.win_len * sizeof(float) );
+	s.win_start = first;
+    }
+
+    if( count > s.win_len ) {
+	fill( s,
+	      s.win_L + s.win_len,
+	      s.win_R + s.win_len,
+	      s.win_start + s.win_len,
+	      count - s.win_len );
+	s.win_len = count;
+    }
+
+    *L = s.win_L;
+    *R = s.win_R;
+}
+
+bool SampleStreamer::needs_work(Stream& s)
+{
+    switch( int(s.state) ) {
+    case Opening:
+    case Closing:
+	return true;
+    case Running:
+	return ( ! s.eof.fetchAndAddAcquire(0) )
+	    && s.ring_L.write_space() >= READ_CHUNK
+	    && s.ring_R.write_space() >= READ_CHUNK;
+    }
+    return false;
+}
+
+bool SampleStreamer::events_waiting()
+{
+    if( _kill ) return false;
+    for( size_t k=0 ; k<_streams.size() ; ++k ) {
+	if( needs_work(*_streams[k]) ) return true;
+    }
+    return false;
+}
+
+void SampleStreamer::do_open(Stream& s)
+{
+    SF_INFO info;
+    info.format = 0;
+    s.file = sf_open( s.sample->get_filename().toLocal8Bit(), SFM_READ, &info );
+    s.channels = info.channels;
+    if( s.file && sf_seek( s.file, s.head, SEEK_SET ) < 0 ) {
+	sf_close( s.file );
+	s.file = 0;
+    }
+    if( ! s.file ) {
+	ERRORLOG( QString("Could not stream %1").arg(s.sample->get_filename()) );
+	s.eof = 1;
+    }
+    // If the audio thread closed it meanwhile, leave it Closing.
+    s.state.testAndSetOrdered(Opening, Running);
+}
+
+void SampleStreamer::do_read(Stream& s)
+{
+    uint32_t space = s.ring_L.write_space();
+    if( s.ring_R.write_space() < space ) space = s.ring_R.write_space();
+
+    while( space >= READ_CHUNK && ! _kill && int(s.state) == Running ) {
+	sf_count_t n = sf_readf_float( s.file, &_read_buf[0], READ_CHUNK );
+	if( n <= 0 ) {
+	    sf_close( s.file );
+	    s.file = 0;
+	    s.eof.fetchAndStoreRelease(1);
+	    return;
+	}
+	if( s.channels == 1 ) {
+	    s.ring_L.write( &_read_buf[0], n );
+	    s.ring_R.write( &_read_buf[0], n );
+	} else {
+	    for( sf_count_t k=0 ; k<n ; ++k ) {
+		_split_L[k] = _read_buf[k * s.channels];
+		_split_R[k] = _read_buf[k * s.channels + 1];
+	    }
+	    s.ring_L.write( &_split_L[0], n );
+	    s.ring_R.write( &_split_R[0], n );
+	}
+	space -= n;
+    }
+}
+
+void SampleStreamer::do_close(Stream& s)
+{
+    if( s.file ) {
+	sf_close( s.file );
+	s.file = 0;
+    }
+    s.sample.reset();
+    s.ring_L.reset();
+    s.ring_R.reset();
+    s.state.fetchAndStoreRelease(Free);
+}
+
+int SampleStreamer::process()
+{
+    for( size_t k=0 ; k<_streams.size() && ! _kill ; ++k ) {
+	Stream& s = *_streams[k];
+	switch( int(s.state) ) {
+	case Opening:
+	    do_open(s);
+	    break;
+	case Running:
+	    if( s.file ) do_read(s);
+	    break;
+	case Closing:
+	    do_close(s);
+	    break;
+	}
+    }
+    return 0;
+}
+
+void SampleStreamer::shutdown()
+{
+    _kill = true;
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+#ifndef TRITIUM_SAMPLESTREAMER_HPP
+#define TRITIUM_SAMPLESTREAMER_HPP
+
+#include "WorkerThread.hpp"
+#include <Tritium/RingBuffer.hpp>
+#include <Tritium/memory.hpp>
+#include <QAtomicInt>
+#include <vector>
+#include <stdint.h>
+#include <sndfile.h>
+
+namespace Tritium
+{
+    class Sample;
+
+    /**
+     * \brief Streams the tails of long samples from disk.
+     *
+     * A streaming Sample (see Sample::is_streaming()) only has its
+     * head in memory.  When a note starts on such a sample, the
+     * Sampler open()'s a stream.  The worker thread opens the file,
+     * seeks to the end of the head, and keeps the stream's ring
+     * buffers full.  The Sampler reads the sample through
+     * window(), which serves frames from the head and then from the
+     * ring buffers.
+     *
+     * open(), close() and window() are for the audio thread and
+     * never block or allocate.  They may be called from several
+     * render threads at once, as long as each stream is only used
+     * by one of them.  The number of streams is fixed; if
+     * they are all in use, open() fails and the note only plays its
+     * head.
+     *
+     * If the disk can't keep up, window() pads with silence and
+     * counts an underrun.
+     */
+    class SampleStreamer : public WorkerThreadClient
+    {
+    public:
+	enum {
+	    MAX_STREAMS = 64,       ///< Voices that can stream at once
+	    RING_FRAMES = 32768,    ///< Ring buffer size, per stream and channel
+	    WINDOW_FRAMES = 4096,   ///< Most frames window() can return
+	    READ_CHUNK = 4096       ///< Frames read from disk at a time
+	};
+
+	SampleStreamer();
+	virtual ~SampleStreamer();
+
+	// Audio thread interface
+
+	/// Start streaming 'sample'.  Returns the stream id, or -1.
+	int open(T<Sample>::shared_ptr sample);
+
+	/// Stop streaming.  The id may be reused after this.
+	void close(int id);
+
+	/**
+	 * Get frames [first, first+count) of the sample.
+	 *
+	 * On return, *L and *R point to 'count' frames of audio
+	 * (count <= WINDOW_FRAMES).  'first' must not go backwards
+	 * between calls.  The pointers are valid until the next call
+	 * for this stream.
+	 */
+	void window(int id, uint32_t first, uint32_t count,
+		    const float** L, const float** R);
+
+	/// Number of times window() ran out of data.
+	unsigned underruns() { return _underruns; }
+
+	// WorkerThreadClient interface
+	virtual bool events_waiting();
+	virtual int process();
+	virtual void shutdown();
+
+    private:
+	typedef enum {
+	    Free,       // Not used
+	    Claimed,    // Being set up by open()
+	    Opening,    // Waiting for the worker to open the file
+	    Running,    // Worker is filling the rings
+	    Closing     // Waiting for the worker to clean up
+	} state_t;
+
+	struct Stream
+	{
+	    QAtomicInt state;
+	    QAtomicInt eof;             // Worker reached end of file
+	    T<Sample>::shared_ptr sample;
+	    RingBuffer<float> ring_L;
+	    RingBuffer<float> ring_R;
+
+	    // Worker thread only
+	    SNDFILE* file;
+	    int channels;
+
+	    // Audio thread only
+	    uint32_t head;              // Frames in memory (the head)
+	    uint32_t ring_frame;        // Sample frame at the ring's read index
+	    uint32_t win_start;         // Sample frame of win_L[0]
+	    uint32_t win_len;
+	    float win_L[WINDOW_FRAMES];
+	    float win_R[WINDOW_FRAMES];
+
+	    Stream();
+	};
+
+	bool needs_work(Stream& s);
+	void fill(Stream& s, float* dest_L, float* dest_R, uint32_t frame, uint32_t count);
+	void do_open(Stream& s);
+	void do_read(Stream& s);
+	void do_close(Stream& s);
+
+	std::vector<Stream*> _streams;
+	std::vector<float> _read_buf;   // Worker: interleaved frames from disk
+	std::vector<float> _split_L;    // Worker: deinterleaved
+	std::vector<float> _split_R;
+	QAtomicInt _underruns;
+	bool _kill;
+    };
+
+} // namespace Tritium
+
+#endif // TRITIUM_SAMPLESTREAMER_HPP
@@ -21,12 +21,13 @@
 
 #include <cassert>
 #include <cmath>
-#include <list>
 #include <QMutexLocker>
 #include <algorithm>
 #include <functional>
 
 #include "SamplerPrivate.hpp"
+#include "VoiceKernels.hpp"
+#include "ProcessProfiler.hpp"
 
 #include <Tritium/IO/AudioOutput.hpp>
 #include <Tritium/IO/JackOutput.hpp>
@@ -48,18 +49,8 @@
 
 using namespace Tritium;
 
-inline static float linear_interpolation( float fVal_A, float fVal_B, float fVal )
-{
-    return fVal_A * ( 1 - fVal ) + fVal_B * fVal;
-//	return fVal_A + fVal * ( fVal_B - fVal_A );
-//	return fVal_A + ((fVal_B - fVal_A) * fVal);
-}
-
 void SamplerPrivate::handle_event(const SeqEvent& ev)
 {
-    // TODO: If we receive a note that we don't have an instrument
-    // for, we still try to process it.  The results in a
-    // segfault.  Need to filter these out.  See handle_note_on()
     switch(ev.type) {
     case SeqEvent::NOTE_ON:
 	handle_note_on(ev);
@@ -68,7 +59,12 @@ void SamplerPrivate::handle_event(const SeqEvent& ev)
 	handle_note_off(ev);
 	break;
     case SeqEvent::ALL_OFF:
-	panic();
+	if( ev.instrument == 0 ) {
+	    stop_voices( 0 );
+	} else {
+	    Instrument* pInstr = rt_instruments->find( ev.instrument );
+	    if( pInstr ) stop_voices( pInstr );
+	}
 	break;
     }
 }
@@ -80,37 +76,168 @@ void SamplerPrivate::panic()
 
 void SamplerPrivate::handle_note_on(const SeqEvent& ev)
 {
+    // Drop notes for instruments that we don't have (any more).
+    Instrument* pInstr = rt_instruments->find( ev.instrument );
+    if ( !pInstr ) {
+	return;
+    }
+
     // Respect the mute groups.
-    T<Instrument>::shared_ptr pInstr = ev.note.get_instrument(); // TODO: May return invalid note
+    int v;
     if ( pInstr->get_mute_group() != -1 ) {
 	// remove all notes using the same mute group
-	NoteList::iterator j, prev;
-	T<Instrument>::shared_ptr otherInst;
-	for ( j = current_notes.begin() ; j != current_notes.end() ; ++j ) {
-	    otherInst = j->get_instrument();
+	Instrument* otherInst;
+	for ( v = voices.first() ; v != -1 ; v = voices.next(v) ) {
+	    otherInst = voices.voice(v).instrument;
 	    if( (otherInst != pInstr)
 		&& (otherInst->get_mute_group() == pInstr->get_mute_group())) {
-		j->m_adsr.release();
+		voices.voice(v).adsr.release();
 	    }
 	}
     }
+
+    v = voices.allocate();
+    if ( v == -1 ) {
+	v = steal_voice( pInstr );
+	if ( v == -1 ) {
+	    return; // max_notes == 0
+	}
+    }
     pInstr->enqueue();
-    QMutexLocker lk( &mutex_current_notes );
-    current_notes.push_back( ev.note );
-    current_notes.back().m_nSilenceOffset = ev.frame;
-    current_notes.back().m_nReleaseOffset = (uint32_t)-1;
+    VoicePool::Voice& voice = voices.voice(v);
+    voice.instrument = pInstr;
+    voice.velocity = ev.velocity;
+    voice.pan_l = ev.pan_l;
+    voice.pan_r = ev.pan_r;
+    voice.pitch = ev.pitch;
+    voice.port = port_for_instrument( pInstr );
+    voice.silence_offset = ev.frame;
+    voice.release_offset = (uint32_t)-1;
+    voice.sample_position = 0;
+    voice.adsr = *( pInstr->get_adsr() );
+    filters.reset(v);
 }
 
 void SamplerPrivate::handle_note_off(const SeqEvent& ev)
 {
-    NoteList::iterator k;
-    for( k=current_notes.begin() ; k!=current_notes.end() ; ++k ) {
-	if( k->get_instrument() == ev.note.get_instrument() ) {
-	    k->m_nReleaseOffset = ev.frame;
+    Instrument* pInstr = rt_instruments->find( ev.instrument );
+    if( !pInstr ) return;
+    int v;
+    for( v = voices.first() ; v != -1 ; v = voices.next(v) ) {
+	if( voices.voice(v).instrument == pInstr ) {
+	    voices.voice(v).release_offset = ev.frame;
+	}
+    }
+}
+
+/**
+ * \brief Cut a voice to make room for 'incoming'.
+ *
+ * Returns the index of a free voice, or -1 if there are no voices
+ * to steal (i.e. the limit is 0).
+ */
+int SamplerPrivate::steal_voice(Instrument* incoming)
+{
+    int v, victim = voices.first();
+    if ( victim == -1 ) {
+	return -1;
+    }
+
+    switch( steal_policy ) {
+    case Sampler::STEAL_QUIETEST:
+	{
+	    float level, quietest = 2.0f;
+	    for( v = voices.first() ; v != -1 ; v = voices.next(v) ) {
+		const VoicePool::Voice& voice = voices.voice(v);
+		level = voice.velocity * voice.adsr.get_current_value();
+		if( level < quietest ) {
+		    quietest = level;
+		    victim = v;
+		}
+	    }
+	}
+	break;
+    case Sampler::STEAL_SAME_INSTRUMENT:
+	for( v = voices.first() ; v != -1 ; v = voices.next(v) ) {
+	    if( voices.voice(v).instrument == incoming ) {
+		victim = v;
+		break;
+	    }
+	}
+	break;
+    case Sampler::STEAL_OLDEST:
+    default:
+	break;
+    }
+
+    end_voice( victim );
+    return voices.allocate();
+}
+
+/// Stop a voice and return it to the pool.
+void SamplerPrivate::end_voice(int v)
+{
+    VoicePool::Voice& voice = voices.voice(v);
+    if( voice.stream != -1 ) {
+	streamer->close( voice.stream );
+	voice.stream = -1;
+    }
+    // The voice has no reference to drop.  If the instrument was
+    // removed while it played, the reaper frees it once it is no
+    // longer queued.
+    if( voice.instrument ) {
+	voice.instrument->dequeue();
+	voice.instrument = 0;
+    }
+    voices.release(v);
+}
+
+/// Stop all voices of 'instr'.  If instr is null, stop all voices.
+void SamplerPrivate::stop_voices(Instrument* instr)
+{
+    int v, die;
+    v = voices.first();
+    while( v != -1 ) {
+	die = v;
+	v = voices.next(v);
+	if( !instr || voices.voice(die).instrument == instr ) {
+	    end_voice(die);
 	}
     }
 }
 
+void SamplerPrivate::update_voice_ports()
+{
+    int v;
+    for( v = voices.first() ; v != -1 ; v = voices.next(v) ) {
+	voices.voice(v).port = port_for_instrument( voices.voice(v).instrument );
+    }
+}
+
+bool SamplerPrivate::push_command(const SeqEvent& ev)
+{
+    QMutexLocker lk( &mutex_commands );
+    int w = command_write.fetchAndAddAcquire(0);
+    int next = (w + 1) % COMMAND_QUEUE_SIZE;
+    if( next == command_read.fetchAndAddAcquire(0) ) {
+	ERRORLOG( "Sampler command queue is full.  Dropping request." );
+	return false;
+    }
+    commands[w] = ev;
+    command_write.fetchAndStoreRelease(next);
+    return true;
+}
+
+void SamplerPrivate::process_commands(int end)
+{
+    int r = command_read.fetchAndAddAcquire(0);
+    while( r != end ) {
+	handle_event( commands[r] );
+	r = (r + 1) % COMMAND_QUEUE_SIZE;
+    }
+    command_read.fetchAndStoreRelease(r);
+}
+
 Sampler::Sampler(T<AudioPortManager>::shared_ptr apm)
 {
     DEBUGLOG( "INIT" );
@@ -121,6 +248,7 @@ Sampler::Sampler(T<AudioPortManager>::shared_ptr apm)
     QString sEmptySampleFilename = DataPath::get_data_path() + "/emptySample.wav";
     d->preview_instrument.reset( new Instrument( sEmptySampleFilename, "preview", new ADSR() ) );
     d->preview_instrument->set_layer( new InstrumentLayer( Sample::load( sEmptySampleFilename ) ), 0 );
+    d->publish( d->edit_instruments() );
 }
 
 
@@ -137,7 +265,7 @@ void Sampler::panic()
 
 int Sampler::get_playing_notes_number()
 {
-    return d->current_notes.size();
+    return d->voices.size();
 }
 
 // Do not use B:b.t or frame info from pos.
@@ -147,23 +275,29 @@ void Sampler::process( SeqScriptConstIterator beg,
 		       const TransportPosition& pos,
 		       uint32_t nFrames )
 {
-    if(d->per_instrument_outs) {
-	for(int k=0 ; k<MAX_INSTRUMENTS ; ++k) {
-	    d->instrument_ports[k]->set_zero_flag(true);
-	}
+    d->reader->enter();
+    int commands_end = d->command_write.fetchAndAddAcquire(0);
+    d->rt_instruments = d->instruments.get();
+    if( d->rt_instruments->serial != d->rt_serial ) {
+	d->rt_serial = d->rt_instruments->serial;
+	d->update_voice_ports();
+    }
+
+    if(d->per_instrument_outs || d->bound_ports) {
+	d->bind_outs(nFrames);
     }
 
     // Max notes limit
-    // If max_notes == -1, this means "unlimited"
-    if ( d->current_notes.size() > (unsigned)d->max_notes ) {
-	QMutexLocker lk( &d->mutex_current_notes );
-	while( d->current_notes.size() > (unsigned)d->max_notes) {
-	    assert(d->max_notes >= 0);
-	    d->current_notes.front().get_instrument()->dequeue();
-	    d->current_notes.pop_front();
-	}
+    // If max_notes == -1, this means "unlimited" (i.e. MAX_VOICES)
+    int max_notes = d->max_notes;
+    d->voices.set_limit( (max_notes < 0) ? d->voices.capacity() : max_notes );
+    while( d->voices.size() > d->voices.limit() ) {
+	d->end_voice( d->voices.first() );
     }
 
+    // Requests from other threads (previews, stop_playing_notes()).
+    d->process_commands( commands_end );
+
     // Handle new events from the sequencer (add/remove notes from the "currently playing"
     // list.
     SeqScriptConstIterator ev;
@@ -172,59 +306,400 @@ void Sampler::process( SeqScriptConstIterator beg,
     }
 
     // Play all of the currently playing notes.
-    SamplerPrivate::NoteList::iterator k, die;
-    QMutexLocker lk( &d->mutex_current_notes );
-    for( k=d->current_notes.begin() ; k != d->current_notes.end() ; /*++k*/ ) {
-	unsigned res = d->render_note( *k, nFrames, pos.frame_rate );
-	if( res == 1 ) { // Note is finished playing
-	    die = k;  ++k;
-	    die->get_instrument()->dequeue();
-	    d->current_notes.erase(die);
+    d->render_voices( nFrames, pos.frame_rate );
+    d->clear_silent_outs( nFrames );
+
+    d->reader->leave();
+}
+
+void Sampler::set_instrument_out(unsigned n, float* left, float* right)
+{
+    if( n >= MAX_INSTRUMENTS ) return;
+    d->out_L[n] = left;
+    d->out_R[n] = right;
+    if( n >= d->out_count ) d->out_count = n + 1;
+}
+
+/**
+ * Point the port of each instrument at the buffers given with
+ * set_instrument_out(), or back at its own buffers.  The buffers
+ * are only good for this cycle, so they are used up.
+ */
+void SamplerPrivate::bind_outs(uint32_t nFrames)
+{
+    std::deque< T<AudioPort>::shared_ptr >& ports = rt_instruments->ports;
+    unsigned nPorts = per_instrument_outs ? rt_instruments->list->get_size() : 0;
+    unsigned k;
+
+    if( nPorts > ports.size() ) nPorts = ports.size();
+    for( k = 0 ; k < nPorts ; ++k ) {
+	if( k < out_count && out_L[k] && out_R[k] ) {
+	    ports[k]->set_buffers( out_L[k], out_R[k], nFrames );
+	} else {
+	    ports[k]->set_buffers( 0, 0, 0 );
+	}
+    }
+    // Ports that were bound last cycle, but aren't now.
+    for( ; k < bound_ports && k < ports.size() ; ++k ) {
+	ports[k]->set_buffers( 0, 0, 0 );
+    }
+    for( k = 0 ; k < out_count ; ++k ) {
+	out_L[k] = out_R[k] = 0;
+    }
+    out_count = 0;
+    bound_ports = nPorts;
+}
+
+/**
+ * The mixer skips ports that nothing rendered to, but an output's
+ * buffer still has whatever was in it.
+ */
+void SamplerPrivate::clear_silent_outs(uint32_t nFrames)
+{
+    std::deque< T<AudioPort>::shared_ptr >& ports = rt_instruments->ports;
+    for( unsigned k = 0 ; k < bound_ports && k < ports.size() ; ++k ) {
+	if( ports[k]->zero_flag() ) {
+	    ports[k]->write_zeros( nFrames );
+	}
+    }
+}
+
+namespace Tritium
+{
+    /// Renders the voices of one instrument port (see render_voices()).
+    class SamplerPortJob : public RenderPool::Job
+    {
+    public:
+	SamplerPortJob(SamplerPrivate& d, uint32_t nFrames, uint32_t frame_rate) :
+	    _d(d),
+	    _nFrames(nFrames),
+	    _frame_rate(frame_rate)
+	    {}
+
+	void operator()(unsigned index) {
+	    int p = _d.busy_ports[index];
+	    _d.render_list( _d.port_first[p], true, _nFrames, _frame_rate );
+	}
+
+    private:
+	SamplerPrivate& _d;
+	uint32_t _nFrames;
+	uint32_t _frame_rate;
+    };
+} // namespace Tritium
+
+/**
+ * The instrument port that notes of 'instr' render to.
+ *
+ * The instrument could be missing from the current drumset.  This
+ * happens when someone is using the prelistening function of the
+ * soundlibrary.  Those notes go to the first port.
+ *
+ * This is a lookup in the instrument list, so each voice keeps
+ * its port (VoicePool::Voice::port).  It is set on note-on, and
+ * process() updates it when the instruments are edited.
+ */
+int SamplerPrivate::port_for_instrument(Instrument* instr)
+{
+    int nInstrument = rt_instruments->list->get_pos( instr );
+    if( nInstrument < 0 ) {
+	nInstrument = 0;
+    }
+    return nInstrument;
+}
+
+void SamplerPrivate::render_voice(int v, uint32_t nFrames, uint32_t frame_rate)
+{
+    if( ! profile_cycle ) {
+	voice_ended[v] = render_note( voices.voice(v), nFrames, frame_rate );
+	return;
+    }
+
+    uint64_t start = ProcessProfiler::now();
+    voice_ended[v] = render_note( voices.voice(v), nFrames, frame_rate );
+    int port = voices.voice(v).port;
+    if( port < MAX_INSTRUMENTS ) {
+	port_ns[port] += ProcessProfiler::now() - start;
+	++port_voices[port];
+    }
+}
+
+/**
+ * \brief Render the playing voices and end the ones that are done.
+ *
+ * Without a render_pool, the voices are rendered one after the
+ * other.
+ *
+ * With a render_pool, the voices are grouped by the instrument
+ * port they render to, and each port is a job for the pool.  The
+ * voices of a port are rendered in voice order by one thread, so
+ * every buffer (and instrument peak) gets the same additions in
+ * the same order as without the pool, and the output is
+ * identical.  Voices are only ended after the pool is done.
+ *
+ * The voices that use the low pass filter are rendered after the
+ * others (see render_list()).
+ *
+ * When profiling, each voice is timed and added to its port.
+ */
+void SamplerPrivate::render_voices(uint32_t nFrames, uint32_t frame_rate)
+{
+    int v, die, p;
+    unsigned k, nPorts = 0;
+
+    profile_cycle = ( profiling.fetchAndAddRelaxed(0) != 0 );
+    profiled_ports = 0;
+    if( profile_cycle ) {
+	profiled_ports = std::min( rt_instruments->list->get_size(), unsigned(MAX_INSTRUMENTS) );
+	for( k = 0 ; k < profiled_ports ; ++k ) {
+	    port_voices[k] = 0;
+	    port_ns[k] = 0;
+	}
+    }
+
+    if( render_pool.get() && voices.size() > 1 ) {
+	for( v = voices.first() ; v != -1 ; v = voices.next(v) ) {
+	    p = voices.voice(v).port;
+	    if( p >= MAX_INSTRUMENTS ) {
+		// No room in port_first.  Render serially.
+		for( k = 0 ; k < nPorts ; ++k ) {
+		    port_first[ busy_ports[k] ] = -1;
+		}
+		nPorts = 0;
+		break;
+	    }
+	    voice_next[v] = -1;
+	    if( port_first[p] == -1 ) {
+		port_first[p] = v;
+		busy_ports[nPorts++] = p;
+	    } else {
+		voice_next[ port_last[p] ] = v;
+	    }
+	    port_last[p] = v;
+	}
+    }
+
+    if( nPorts > 1 ) {
+	SamplerPortJob job( *this, nFrames, frame_rate );
+	render_pool->run( job, nPorts );
+    } else {
+	render_list( voices.first(), false, nFrames, frame_rate );
+    }
+    for( k = 0 ; k < nPorts ; ++k ) {
+	port_first[ busy_ports[k] ] = -1;
+    }
+
+    v = voices.first();
+    while( v != -1 ) {
+	die = v;
+	v = voices.next(v);
+	if( voice_ended[die] == 1 ) { // Note is finished playing
+	    end_voice(die);
+	}
+    }
+}
+
+/**
+ * Render the voices from 'v' on, following voice_next if 'chain'
+ * is set, else all the voices in voice order.
+ *
+ * The voices that go through the low pass filter are set aside and
+ * rendered last by render_filtered().  So every port gets the
+ * unfiltered voices in voice order, then the filtered voices in
+ * voice order, with or without the render_pool.
+ */
+void SamplerPrivate::render_list(int v, bool chain, uint32_t nFrames, uint32_t frame_rate)
+{
+    int first = -1, last = -1;
+
+    while( v != -1 ) {
+	if( voice_filtered(v) ) {
+	    filter_next[v] = -1;
+	    if( first == -1 ) {
+		first = v;
+	    } else {
+		filter_next[last] = v;
+	    }
+	    last = v;
 	} else {
-	    ++k;
+	    render_voice( v, nFrames, frame_rate );
 	}
+	v = chain ? voice_next[v] : voices.next(v);
     }
+    if( first != -1 ) {
+	render_filtered( first, nFrames, frame_rate );
+    }
+}
+
+bool SamplerPrivate::voice_filtered(int v)
+{
+    Instrument* pInstr = voices.voice(v).instrument;
+    return pInstr && pInstr->is_filter_active();
+}
+
+/**
+ * \brief Render the filtered voices from 'v' on, following filter_next.
+ *
+ * The voices are taken FilterBank::VOICES at a time, so that their
+ * filters run side by side in the SIMD lanes.  Without a
+ * render_pool, the list has the filtered voices of all the ports;
+ * with it, only those of one port.
+ */
+void SamplerPrivate::render_filtered(int v, uint32_t nFrames, uint32_t frame_rate)
+{
+    while( v != -1 ) {
+	FilterBank::Group group( filters );
+	while( v != -1 && ! group.full() ) {
+	    Instrument* pInstr = voices.voice(v).instrument;
+	    group.add( v, pInstr->get_filter_cutoff(), pInstr->get_filter_resonance() );
+	    v = filter_next[v];
+	}
+	render_filter_group( group, nFrames, frame_rate );
+    }
+}
+
+/**
+ * \brief Render the voices of 'group' through their filters.
+ *
+ * The voices go in lockstep, one window of up to
+ * VoiceKernels::BLOCK_SIZE frames at a time.  Each voice writes its
+ * input (sample * envelope) to the group, the group is filtered in
+ * one pass, and each voice mixes its output into its port.  A voice
+ * continues in the next window from its silence_offset.
+ *
+ * When profiling, the group's time is split evenly among its voices.
+ */
+void SamplerPrivate::render_filter_group(FilterBank::Group& group, uint32_t nFrames, uint32_t frame_rate)
+{
+    FilterTap taps[FilterBank::VOICES];
+    const unsigned n = group.size();
+    uint64_t start = 0;
+    uint32_t w0, w1;
+    unsigned j;
+    int v, p;
+
+    if( profile_cycle ) {
+	start = ProcessProfiler::now();
+    }
+    for( j = 0 ; j < n ; ++j ) {
+	voice_ended[ group.voice(j) ] = 0;
+	taps[j].group = &group;
+	taps[j].index = j;
+    }
+
+    for( w0 = 0 ; w0 < nFrames ; w0 = w1 ) {
+	w1 = std::min( w0 + uint32_t(VoiceKernels::BLOCK_SIZE), nFrames );
+	group.clear( w1 - w0 );
+	for( j = 0 ; j < n ; ++j ) {
+	    v = group.voice(j);
+	    VoicePool::Voice& voice = voices.voice(v);
+	    taps[j].window = w0;
+	    taps[j].begin = taps[j].end = 0;
+	    if( voice_ended[v] || voice.silence_offset >= w1 ) {
+		continue;
+	    }
+	    voice_ended[v] = render_note( voice, w1, frame_rate, &taps[j] );
+	    if( ! voice_ended[v] && w1 < nFrames ) {
+		voice.silence_offset = w1;
+	    }
+	}
+	group.run( w1 - w0 );
+	for( j = 0 ; j < n ; ++j ) {
+	    if( taps[j].begin < taps[j].end ) {
+		mix_tap( taps[j], voices.voice( group.voice(j) ) );
+	    }
+	}
+    }
+
+    if( profile_cycle ) {
+	uint64_t ns = ( ProcessProfiler::now() - start ) / n;
+	for( j = 0 ; j < n ; ++j ) {
+	    p = voices.voice( group.voice(j) ).port;
+	    if( p < MAX_INSTRUMENTS ) {
+		port_ns[p] += ns;
+		++port_voices[p];
+	    }
+	}
+    }
+}
+
+void SamplerPrivate::mix_tap(const FilterTap& tap, VoicePool::Voice& voice)
+{
+    float tmp_L[VoiceKernels::BLOCK_SIZE];
+    float tmp_R[VoiceKernels::BLOCK_SIZE];
+    const uint32_t n = tap.end - tap.begin;
+
+    Instrument* pInstr = voice.instrument;
+    float fInstrPeak_L = pInstr->get_peak_l(); // this value will be reset to 0 by the mixer..
+    float fInstrPeak_R = pInstr->get_peak_r();
+
+    AudioPort* port = instrument_port( tap.port );
+    if(port->zero_flag()) {
+	port->write_zeros();
+    }
+    tap.group->read( tap.index, tap.begin - tap.window, tmp_L, tmp_R, n );
+    VoiceKernels::mix( tmp_L, tmp_R, 0, tap.cost_L, tap.cost_R,
+		       port->get_buffer(0) + tap.begin,
+		       port->get_buffer(1) + tap.begin,
+		       n, fInstrPeak_L, fInstrPeak_R );
+
+    pInstr->set_peak_l( fInstrPeak_L );
+    pInstr->set_peak_r( fInstrPeak_R );
 }
 
 /// Render a note
 /// Return 0: the note is not ended
 /// Return 1: the note is ended
-int SamplerPrivate::render_note( Note& note, uint32_t nFrames, uint32_t frame_rate )
+int SamplerPrivate::render_note( VoicePool::Voice& voice, uint32_t nFrames, uint32_t frame_rate, FilterTap* tap )
 {
     //infoLog( "[renderNote] instr: " + note.getInstrument()->m_sName );
 
-    T<Instrument>::shared_ptr pInstr = note.get_instrument();
+    Instrument* pInstr = voice.instrument;
     if ( !pInstr ) {
-	ERRORLOG( "NULL instrument" );
+	RT_ERRORLOG( RtLogMessage("NULL instrument") );
 	return 1;
     }
 
     float fLayerGain = 1.0;
     float fLayerPitch = 0.0;
 
-    // scelgo il sample da usare in base alla velocity
-    T<Sample>::shared_ptr pSample;
+    // scelgo il sample da usare in base alla velocity.  The layer
+    // keeps the sample alive (see InstrumentLayer::get_sample_ptr()).
+    InstrumentLayer *pLayer = NULL;
+    Sample *pSample = NULL;
     for ( unsigned nLayer = 0; nLayer < MAX_LAYERS; ++nLayer ) {
-	InstrumentLayer *pLayer = pInstr->get_layer( nLayer );
+	pLayer = pInstr->get_layer( nLayer );
 	if ( pLayer == NULL ) continue;
 
-	if ( pLayer->in_velocity_range(note.get_velocity()) ) {
-	    pSample = pLayer->get_sample();
+	if ( pLayer->in_velocity_range(voice.velocity) ) {
+	    pSample = pLayer->get_sample_ptr();
 	    fLayerGain = pLayer->get_gain();
 	    fLayerPitch = pLayer->get_pitch();
 	    break;
 	}
     }
     if ( !pSample ) {
-	WARNINGLOG(QString( "NULL sample for instrument %1. Note velocity: %2" )
-		   .arg( pInstr->get_name() )
-		   .arg( note.get_velocity() )
-	    );
+	RT_WARNINGLOG( RtLogMessage( "NULL sample for instrument %1. Note velocity: %2" )
+		       << pInstr->get_name()
+		       << voice.velocity );
 	return 1;
     }
 
-    if ( note.m_fSamplePosition >= pSample->get_n_frames() ) {
-	WARNINGLOG( "sample position out of bounds. The layer has been resized during note play?" );
+    if ( voice.sample_position >= pSample->get_total_frames() ) {
+	RT_WARNINGLOG( RtLogMessage("sample position out of bounds. The layer has been resized during note play?") );
+	return 1;
+    }
+
+    // Long samples only have their head in memory.  Start
+    // streaming the rest while the head plays.  If no stream is
+    // available, the note ends with the head.
+    if ( pSample->is_streaming()
+	 && voice.stream == -1
+	 && voice.sample_position < pSample->get_n_frames() ) {
+	voice.stream = streamer->open( pLayer->get_sample() );
+    }
+    unsigned nSampleFrames = ( voice.stream == -1 ) ? pSample->get_n_frames() : pSample->get_total_frames();
+    if ( voice.sample_position >= nSampleFrames ) {
 	return 1;
     }
 
@@ -240,16 +715,16 @@ int SamplerPrivate::render_note( Note& note, uint32_t nFrames, uint32_t frame_ra
 	cost_L = 0.0;
 	cost_R = 0.0;
     } else {	// Precompute some values...
-	cost_L = cost_L * note.get_velocity();		// note velocity
-	cost_L = cost_L * note.get_pan_l();		// note pan
+	cost_L = cost_L * voice.velocity;		// note velocity
+	cost_L = cost_L * voice.pan_l;		// note pan
 	cost_L = cost_L * fLayerGain;				// layer gain
 	cost_L = cost_L * pInstr->get_pan_l();		// instrument pan
 	cost_L = cost_L * pInstr->get_gain();		// instrument gain
 	cost_L = cost_L * 2; // max pan is 0.5
 
 
-	cost_R = cost_R * note.get_velocity();		// note velocity
-	cost_R = cost_R * note.get_pan_r();		// note pan
+	cost_R = cost_R * voice.velocity;		// note velocity
+	cost_R = cost_R * voice.pan_r;		// note pan
 	cost_R = cost_R * fLayerGain;				// layer gain
 	cost_R = cost_R * pInstr->get_pan_r();		// instrument pan
 	cost_R = cost_R * pInstr->get_gain();		// instrument gain
@@ -261,9 +736,7 @@ int SamplerPrivate::render_note( Note& note, uint32_t nFrames, uint32_t frame_ra
     //	constant^12 = 2, so constant = 2^(1/12) = 1.059463.
     //	float nStep = 1.0;1.0594630943593
 
-    float fTotalPitch = note.m_noteKey.m_nOctave * 12 + note.m_noteKey.m_key;
-    fTotalPitch += note.get_pitch();
-    fTotalPitch += fLayerPitch;
+    float fTotalPitch = voice.pitch + fLayerPitch;
 
     //DEBUGLOG( "total pitch: " + to_string( fTotalPitch ) );
 
@@ -272,21 +745,25 @@ int SamplerPrivate::render_note( Note& note, uint32_t nFrames, uint32_t frame_ra
 	// NO RESAMPLE
 	return render_note_no_resample(
 	    pSample,
-	    note,
+	    voice,
+	    nSampleFrames,
 	    nFrames,
 	    cost_L,
-	    cost_R
+	    cost_R,
+	    tap
 	    );
     } else {
 	// RESAMPLE
 	return render_note_resample(
 	    pSample,
-	    note,
+	    voice,
+	    nSampleFrames,
 	    nFrames,
 	    frame_rate,
 	    cost_L,
 	    cost_R,
-	    fLayerPitch
+	    fLayerPitch,
+	    tap
 	    );
     }
 } // SamplerPrivate::render_note()
@@ -294,105 +771,134 @@ int SamplerPrivate::render_note( Note& note, uint32_t nFrames, uint32_t frame_ra
 
 
 
+/// Length of the next sub-block of a voice, starting at nBufferPos.
+/// Sub-blocks never cross the release offset and are at most
+/// VoiceKernels::BLOCK_SIZE frames.
+inline static int voice_block_length( const VoicePool::Voice& voice, int nBufferPos, int nTimes )
+{
+    int nEnd = nBufferPos + VoiceKernels::BLOCK_SIZE;
+    if ( nEnd > nTimes ) {
+	nEnd = nTimes;
+    }
+    if ( voice.release_offset != (uint32_t)-1
+	 && (uint32_t)nBufferPos < voice.release_offset
+	 && voice.release_offset < (uint32_t)nEnd ) {
+	nEnd = voice.release_offset;
+    }
+    return nEnd - nBufferPos;
+}
+
+/// Release the note if nBufferPos is at or past the release offset.
+/// Returns true if the note has ended.
+inline static bool voice_check_release( VoicePool::Voice& voice, int nBufferPos )
+{
+    if( voice.release_offset != (uint32_t)-1
+	&& (uint32_t)nBufferPos >= voice.release_offset ) {
+	if ( voice.adsr.release() == 0 ) {
+	    return true;
+	}
+    }
+    return false;
+}
+
 int SamplerPrivate::render_note_no_resample(
-    T<Sample>::shared_ptr pSample,
-    Note& note,
+    Sample* pSample,
+    VoicePool::Voice& voice,
+    unsigned nSampleFrames,
     int nFrames,
     float cost_L,
-    float cost_R
+    float cost_R,
+    FilterTap* tap
     )
 {
     int retValue = 1; // the note is ended
 
-    int nAvail_bytes = pSample->get_n_frames() - ( int )note.m_fSamplePosition;   // verifico 
+    const int stream = voice.stream;
+    int nAvail_bytes = nSampleFrames - ( int )voice.sample_position;   // verifico 
 
-    if ( nAvail_bytes > nFrames - note.m_nSilenceOffset ) {   // il sample e' piu' grande del buff
+    if ( nAvail_bytes > nFrames - voice.silence_offset ) {   // il sample e' piu' grande del buff
 	// imposto il numero dei bytes disponibili uguale al buffersize
-	nAvail_bytes = nFrames - note.m_nSilenceOffset;
+	nAvail_bytes = nFrames - voice.silence_offset;
 	retValue = 0; // the note is not ended yet
     }
-	
-    //ADSR *pADSR = note.m_pADSR;
 
-    int nInitialBufferPos = note.m_nSilenceOffset;
-    int nInitialSamplePos = ( int )note.m_fSamplePosition;
-    int nSamplePos = nInitialSamplePos;
+    int nInitialBufferPos = voice.silence_offset;
+    int nInitialSamplePos = ( int )voice.sample_position;
     int nTimes = nInitialBufferPos + nAvail_bytes;
-    int nInstrument = instrument_list->get_pos( note.get_instrument() );
-
-    // filter
-    bool bUseLPF = note.get_instrument()->is_filter_active();
-    float fResonance = note.get_instrument()->get_filter_resonance();
-    float fCutoff = note.get_instrument()->get_filter_cutoff();
+    int nInstrument = voice.port;
 
     float *pSample_data_L = pSample->get_data_l();
     float *pSample_data_R = pSample->get_data_r();
 
-    float fInstrPeak_L = note.get_instrument()->get_peak_l(); // this value will be reset to 0 by the mixer..
-    float fInstrPeak_R = note.get_instrument()->get_peak_r(); // this value will be reset to 0 by the mixer..
-
-    float fADSRValue;
-    float fVal_L;
-    float fVal_R;
+    float fInstrPeak_L = voice.instrument->get_peak_l(); // this value will be reset to 0 by the mixer..
+    float fInstrPeak_R = voice.instrument->get_peak_r(); // this value will be reset to 0 by the mixer..
 
-    /*
-     * nInstrument could be -1 if the instrument is not found in the current drumset.
-     * This happens when someone is using the prelistening function of the soundlibrary.
-     */
+    float env[VoiceKernels::BLOCK_SIZE];
 
-    if( nInstrument < 0 ) {
-	nInstrument = 0;
+    // A filtered voice is mixed later, by mix_tap().
+    float *buf_L = 0, *buf_R = 0;
+    if ( ! tap ) {
+	AudioPort* port = instrument_port( nInstrument );
+	if(port->zero_flag()) {
+	    port->write_zeros();
+	}
+	buf_L = port->get_buffer(0);
+	buf_R = port->get_buffer(1);
     }
 
-    if(instrument_ports[nInstrument]->zero_flag()) {
-	instrument_ports[nInstrument]->write_zeros();
-    }
-    float *buf_L = instrument_ports[nInstrument]->get_buffer(0);
-    float *buf_R = instrument_ports[nInstrument]->get_buffer(1);
-    for ( int nBufferPos = nInitialBufferPos; nBufferPos < nTimes; ++nBufferPos ) {
-	if( note.m_nReleaseOffset != (uint32_t)-1
-	    && nBufferPos >= note.m_nReleaseOffset ) {
-	    if ( note.m_adsr.release() == 0 ) {
-		retValue = 1;	// the note is ended
-	    }
+    int nBufferPos = nInitialBufferPos;
+    int nSamplePos = nInitialSamplePos;
+    int nBlock;
+    const float *src_L, *src_R;
+    while ( nBufferPos < nTimes ) {
+	nBlock = voice_block_length( voice, nBufferPos, nTimes );
+	if ( voice_check_release( voice, nBufferPos ) ) {
+	    retValue = 1;	// the note is ended
 	}
 
-	fADSRValue = note.m_adsr.get_value( 1 );
-	fVal_L = pSample_data_L[ nSamplePos ] * fADSRValue;
-	fVal_R = pSample_data_R[ nSamplePos ] * fADSRValue;
+	bool bFlat = voice.adsr.get_values( 1, env, nBlock );
 
-	// Low pass resonant filter
-	if ( bUseLPF ) {
-	    note.m_fBandPassFilterBuffer_L = fResonance * note.m_fBandPassFilterBuffer_L + fCutoff * ( fVal_L - note.m_fLowPassFilterBuffer_L );
-	    note.m_fLowPassFilterBuffer_L += fCutoff * note.m_fBandPassFilterBuffer_L;
-	    fVal_L = note.m_fLowPassFilterBuffer_L;
-
-	    note.m_fBandPassFilterBuffer_R = fResonance * note.m_fBandPassFilterBuffer_R + fCutoff * ( fVal_R - note.m_fLowPassFilterBuffer_R );
-	    note.m_fLowPassFilterBuffer_R += fCutoff * note.m_fBandPassFilterBuffer_R;
-	    fVal_R = note.m_fLowPassFilterBuffer_R;
+	if ( stream == -1 ) {
+	    src_L = &pSample_data_L[ nSamplePos ];
+	    src_R = &pSample_data_R[ nSamplePos ];
+	} else {
+	    streamer->window( stream, nSamplePos, nBlock, &src_L, &src_R );
 	}
 
-	fVal_L = fVal_L * cost_L;
-	fVal_R = fVal_R * cost_R;
-
-	// update instr peak
-	if ( fVal_L > fInstrPeak_L ) {
-	    fInstrPeak_L = fVal_L;
-	}
-	if ( fVal_R > fInstrPeak_R ) {
-	    fInstrPeak_R = fVal_R;
+	if ( tap ) {
+	    tap->group->write( tap->index, nBufferPos - tap->window,
+			       src_L, src_R, env, nBlock );
+	} else if ( bFlat ) {
+	    // Sustaining: the envelope is just a gain.
+	    VoiceKernels::mix( src_L, src_R,
+			       0, cost_L * env[0], cost_R * env[0],
+			       &buf_L[ nBufferPos ], &buf_R[ nBufferPos ],
+			       nBlock, fInstrPeak_L, fInstrPeak_R );
+	} else {
+	    VoiceKernels::mix( src_L, src_R,
+			       env, cost_L, cost_R,
+			       &buf_L[ nBufferPos ], &buf_R[ nBufferPos ],
+			       nBlock, fInstrPeak_L, fInstrPeak_R );
 	}
 
-	// to main mix
-	buf_L[nBufferPos] += fVal_L;
-	buf_R[nBufferPos] += fVal_R;
-
-	++nSamplePos;
+	nBufferPos += nBlock;
+	nSamplePos += nBlock;
+    }
+    if ( nTimes > nInitialBufferPos && voice_check_release( voice, nTimes - 1 ) ) {
+	retValue = 1;
+    }
+    voice.sample_position += nAvail_bytes;
+    voice.silence_offset = 0;
+    if ( tap ) {
+	tap->begin = nInitialBufferPos;
+	tap->end = nTimes;
+	tap->port = nInstrument;
+	tap->cost_L = cost_L;
+	tap->cost_R = cost_R;
+    } else {
+	voice.instrument->set_peak_l( fInstrPeak_L );
+	voice.instrument->set_peak_r( fInstrPeak_R );
     }
-    note.m_fSamplePosition += nAvail_bytes;
-    note.m_nSilenceOffset = 0;
-    note.get_instrument()->set_peak_l( fInstrPeak_L );
-    note.get_instrument()->set_peak_r( fInstrPeak_R );
 
     return retValue;
 }
@@ -400,17 +906,19 @@ int SamplerPrivate::render_note_no_resample(
 
 
 int SamplerPrivate::render_note_resample(
-    T<Sample>::shared_ptr pSample,
-    Note& note,
+    Sample* pSample,
+    VoicePool::Voice& voice,
+    unsigned nSampleFrames,
     int nFrames,
     uint32_t frame_rate,
     float cost_L,
     float cost_R,
-    float fLayerPitch
+    float fLayerPitch,
+    FilterTap* tap
     )
 {
-    float fNotePitch = note.get_pitch() + fLayerPitch;
-    fNotePitch += note.m_noteKey.m_nOctave * 12 + note.m_noteKey.m_key;
+    const int stream = voice.stream;
+    float fNotePitch = voice.pitch + fLayerPitch;
 
     //DEBUGLOG( "pitch: " + to_string( fNotePitch ) );
 
@@ -418,110 +926,121 @@ int SamplerPrivate::render_note_resample(
     float fStep = pow( 1.0594630943593, ( double )fNotePitch );  // i.e. pow( 2, fNotePitch/12.0 )
     fStep *= ( float )pSample->get_sample_rate() / frame_rate; // Adjust for audio driver sample rate
 
-    int nAvail_bytes = ( int )( ( float )( pSample->get_n_frames() - note.m_fSamplePosition ) / fStep );	// verifico il numero di frame disponibili ancora da eseguire
+    int nAvail_bytes = ( int )( ( float )( nSampleFrames - voice.sample_position ) / fStep );	// verifico il numero di frame disponibili ancora da eseguire
 
     int retValue = 1; // the note is ended
-    if ( nAvail_bytes > nFrames - note.m_nSilenceOffset ) {	// il sample e' piu' grande del buffersize
+    if ( nAvail_bytes > nFrames - voice.silence_offset ) {	// il sample e' piu' grande del buffersize
 	// imposto il numero dei bytes disponibili uguale al buffersize
-	nAvail_bytes = nFrames - note.m_nSilenceOffset;
+	nAvail_bytes = nFrames - voice.silence_offset;
 	retValue = 0; // the note is not ended yet
     }
 
-//	ADSR *pADSR = note.m_pADSR;
-
-    int nInitialBufferPos = note.m_nSilenceOffset;
-    float fInitialSamplePos = note.m_fSamplePosition;
-    float fSamplePos = note.m_fSamplePosition;
+    int nInitialBufferPos = voice.silence_offset;
+    float fSamplePos = voice.sample_position;
     int nTimes = nInitialBufferPos + nAvail_bytes;
-    int nInstrument = instrument_list->get_pos( note.get_instrument() );
-
-    // filter
-    bool bUseLPF = note.get_instrument()->is_filter_active();
-    float fResonance = note.get_instrument()->get_filter_resonance();
-    float fCutoff = note.get_instrument()->get_filter_cutoff();
+    int nInstrument = voice.port;
 
     float *pSample_data_L = pSample->get_data_l();
     float *pSample_data_R = pSample->get_data_r();
 
-    float fInstrPeak_L = note.get_instrument()->get_peak_l(); // this value will be reset to 0 by the mixer..
-    float fInstrPeak_R = note.get_instrument()->get_peak_r(); // this value will be reset to 0 by the mixer..
+    float fInstrPeak_L = voice.instrument->get_peak_l(); // this value will be reset to 0 by the mixer..
+    float fInstrPeak_R = voice.instrument->get_peak_r(); // this value will be reset to 0 by the mixer..
 
-    float fADSRValue = 1.0;
-    float fVal_L;
-    float fVal_R;
-    int nSampleFrames = pSample->get_n_frames();
+    float env[VoiceKernels::BLOCK_SIZE];
+    float tmp_L[VoiceKernels::BLOCK_SIZE];
+    float tmp_R[VoiceKernels::BLOCK_SIZE];
 
-    /*
-     * nInstrument could be -1 if the instrument is not found in the current drumset.
-     * This happens when someone is using the prelistening function of the soundlibrary.
-     */
-
-    if( nInstrument < 0 ) {
-	nInstrument = 0;
+    // A filtered voice is mixed later, by mix_tap().
+    float *buf_L = 0, *buf_R = 0;
+    if ( ! tap ) {
+	AudioPort* port = instrument_port( nInstrument );
+	if(port->zero_flag()) {
+	    port->write_zeros();
+	}
+	buf_L = port->get_buffer(0);
+	buf_R = port->get_buffer(1);
     }
 
-    if(instrument_ports[nInstrument]->zero_flag()) {
-	instrument_ports[nInstrument]->write_zeros();
+    // A streamed window holds at most WINDOW_FRAMES sample frames.
+    int nMaxStreamBlock = ( int )( ( SampleStreamer::WINDOW_FRAMES - 3 ) / fStep );
+    if ( nMaxStreamBlock < 1 ) {
+	nMaxStreamBlock = 1;
     }
-    float *buf_L = instrument_ports[nInstrument]->get_buffer(0);
-    float *buf_R = instrument_ports[nInstrument]->get_buffer(1);
-    for ( int nBufferPos = nInitialBufferPos; nBufferPos < nTimes; ++nBufferPos ) {
-	if( note.m_nReleaseOffset != (uint32_t)-1
-	    && nBufferPos >= note.m_nReleaseOffset )
-	{
-	    if ( note.m_adsr.release() == 0 ) {
-		retValue = 1;	// the note is ended
-	    }
+
+    int nBufferPos = nInitialBufferPos;
+    int nBlock;
+    const float *src_L, *src_R;
+    while ( nBufferPos < nTimes ) {
+	nBlock = voice_block_length( voice, nBufferPos, nTimes );
+	if ( voice_check_release( voice, nBufferPos ) ) {
+	    retValue = 1;	// the note is ended
 	}
 
-	int nSamplePos = ( int )fSamplePos;
-	double fDiff = fSamplePos - nSamplePos;
-	if ( ( nSamplePos + 1 ) >= nSampleFrames ) {
-	    fVal_L = linear_interpolation( pSample_data_L[ nSampleFrames-1 ], 0, fDiff );
-	    fVal_R = linear_interpolation( pSample_data_R[ nSampleFrames-1 ], 0, fDiff );
+	if ( stream == -1 ) {
+	    fSamplePos = VoiceKernels::interpolate( pSample_data_L,
+						    pSample_data_R,
+						    nSampleFrames,
+						    fSamplePos,
+						    fStep,
+						    tmp_L,
+						    tmp_R,
+						    nBlock );
 	} else {
-	    fVal_L = linear_interpolation( pSample_data_L[nSamplePos], pSample_data_L[nSamplePos + 1], fDiff );
-	    fVal_R = linear_interpolation( pSample_data_R[nSamplePos], pSample_data_R[nSamplePos + 1], fDiff );
+	    if ( nBlock > nMaxStreamBlock ) {
+		nBlock = nMaxStreamBlock;
+	    }
+	    unsigned nFirst = ( unsigned )fSamplePos;
+	    unsigned nCount = ( unsigned )( fSamplePos + fStep * nBlock ) - nFirst + 2;
+	    if ( nCount > nSampleFrames - nFirst ) {
+		nCount = nSampleFrames - nFirst;
+	    }
+	    if ( nCount > SampleStreamer::WINDOW_FRAMES ) {
+		nCount = SampleStreamer::WINDOW_FRAMES;
+	    }
+	    streamer->window( stream, nFirst, nCount, &src_L, &src_R );
+	    fSamplePos = nFirst + VoiceKernels::interpolate( src_L,
+							     src_R,
+							     nSampleFrames - nFirst,
+							     fSamplePos - nFirst,
+							     fStep,
+							     tmp_L,
+							     tmp_R,
+							     nBlock );
 	}
 
 	// ADSR envelope
-	fADSRValue = note.m_adsr.get_value( fStep );
-	fVal_L = fVal_L * fADSRValue;
-	fVal_R = fVal_R * fADSRValue;
-
-	// Low pass resonant filter
-	if ( bUseLPF ) {
-	    note.m_fBandPassFilterBuffer_L = fResonance * note.m_fBandPassFilterBuffer_L + fCutoff * ( fVal_L - note.m_fLowPassFilterBuffer_L );
-	    note.m_fLowPassFilterBuffer_L += fCutoff * note.m_fBandPassFilterBuffer_L;
-	    fVal_L = note.m_fLowPassFilterBuffer_L;
-
-	    note.m_fBandPassFilterBuffer_R = fResonance * note.m_fBandPassFilterBuffer_R + fCutoff * ( fVal_R - note.m_fLowPassFilterBuffer_R );
-	    note.m_fLowPassFilterBuffer_R += fCutoff * note.m_fBandPassFilterBuffer_R;
-	    fVal_R = note.m_fLowPassFilterBuffer_R;
-	}
-
-
-	fVal_L = fVal_L * cost_L;
-	fVal_R = fVal_R * cost_R;
-
-	// update instr peak
-	if ( fVal_L > fInstrPeak_L ) {
-	    fInstrPeak_L = fVal_L;
-	}
-	if ( fVal_R > fInstrPeak_R ) {
-	    fInstrPeak_R = fVal_R;
+	bool bFlat = voice.adsr.get_values( fStep, env, nBlock );
+
+	if ( tap ) {
+	    tap->group->write( tap->index, nBufferPos - tap->window,
+			       tmp_L, tmp_R, env, nBlock );
+	} else if ( bFlat ) {
+	    VoiceKernels::mix( tmp_L, tmp_R, 0, cost_L * env[0], cost_R * env[0],
+			       &buf_L[ nBufferPos ], &buf_R[ nBufferPos ],
+			       nBlock, fInstrPeak_L, fInstrPeak_R );
+	} else {
+	    VoiceKernels::mix( tmp_L, tmp_R, env, cost_L, cost_R,
+			       &buf_L[ nBufferPos ], &buf_R[ nBufferPos ],
+			       nBlock, fInstrPeak_L, fInstrPeak_R );
 	}
 
-	// to main mix
-	buf_L[nBufferPos] += fVal_L;
-	buf_R[nBufferPos] += fVal_R;
-
-	fSamplePos += fStep;
+	nBufferPos += nBlock;
+    }
+    if ( nTimes > nInitialBufferPos && voice_check_release( voice, nTimes - 1 ) ) {
+	retValue = 1;
+    }
+    voice.sample_position += nAvail_bytes * fStep;
+    voice.silence_offset = 0;
+    if ( tap ) {
+	tap->begin = nInitialBufferPos;
+	tap->end = nTimes;
+	tap->port = nInstrument;
+	tap->cost_L = cost_L;
+	tap->cost_R = cost_R;
+    } else {
+	voice.instrument->set_peak_l( fInstrPeak_L );
+	voice.instrument->set_peak_r( fInstrPeak_R );
     }
-    note.m_fSamplePosition += nAvail_bytes * fStep;
-    note.m_nSilenceOffset = 0;
-    note.get_instrument()->set_peak_l( fInstrPeak_L );
-    note.get_instrument()->set_peak_r( fInstrPeak_R );
 
     return retValue;
 }
@@ -532,10 +1051,10 @@ void SamplerPrivate::note_on( Note& note )
 
     ev.frame = 0;
     ev.type = SeqEvent::NOTE_ON;
-    ev.note = note;
+    ev.set_note( note );
     ev.quantize = false;
 
-    handle_note_on(ev);
+    push_command(ev);
 }
 
 void SamplerPrivate::note_off( Note& note )
@@ -544,43 +1063,28 @@ void SamplerPrivate::note_off( Note& note )
 
     ev.frame = 0;
     ev.type = SeqEvent::NOTE_OFF;
-    ev.note = note;
+    ev.set_note( note );
     ev.quantize = false;
 
-    handle_note_on(ev);
+    push_command(ev);
 }
 
+/**
+ * \brief Stop all notes of 'instrument', or all notes if it is null.
+ *
+ * The notes are stopped by the audio thread at the start of the
+ * next process() cycle.
+ */
 void Sampler::stop_playing_notes( T<Instrument>::shared_ptr instrument )
 {
-    /*
-    // send a note-off event to all notes present in the playing note queue
-    for ( int i = 0; i < d->current_notes.size(); ++i ) {
-    Note *pNote = d->current_notes[ i ];
-    note.m_pADSR->release();
-    }
-    */
-
-    if ( instrument ) { // stop all notes using this instrument
-	SamplerPrivate::NoteList::iterator k, die;
-	for( k=d->current_notes.begin() ; k!=d->current_notes.end() ; /* ++k */ ) {
-	    if( k->get_instrument() == instrument ) {
-		die = k; ++k;
-		QMutexLocker lk( &d->mutex_current_notes );
-		d->current_notes.erase(die);
-		lk.unlock();
-		instrument->dequeue();
-	    } else {
-		++k;
-	    }
-	}
-    } else { // stop all notes
-	SamplerPrivate::NoteList::iterator k;
-	for( k=d->current_notes.begin() ; k!=d->current_notes.end() ; ++k ) {
-	    k->get_instrument()->dequeue();
-	}
-	QMutexLocker lk( &d->mutex_current_notes );
-	d->current_notes.clear();
-    }
+    SeqEvent ev;
+
+    ev.frame = 0;
+    ev.type = SeqEvent::ALL_OFF;
+    ev.instrument = instrument ? instrument->get_handle() : 0;
+    ev.quantize = false;
+
+    d->push_command(ev);
 }
 
 
@@ -588,15 +1092,26 @@ void Sampler::stop_playing_notes( T<Instrument>::shared_ptr instrument )
 /// Preview, uses only the first layer
 void Sampler::preview_sample( T<Sample>::shared_ptr sample, int length )
 {
-    InstrumentLayer *pLayer = d->preview_instrument->get_layer( 0 );
-
-    T<Sample>::shared_ptr pOldSample = pLayer->get_sample();
-    pLayer->set_sample( sample );
+    // The playing layer is not changed: a new one with the old
+    // settings takes its place.
+    InstrumentLayer *pLayer = new InstrumentLayer( sample );
+    InstrumentLayer *pOldLayer = d->preview_instrument->get_layer( 0 );
+    if( pOldLayer ) {
+	pLayer->set_velocity_range( pOldLayer->get_velocity_range() );
+	pLayer->set_pitch( pOldLayer->get_pitch() );
+	pLayer->set_gain( pOldLayer->get_gain() );
+    }
+    d->preview_instrument->set_layer( pLayer, 0 );
 
     Note previewNote( d->preview_instrument, 1.0, 1.0, 0.5, 0.5, 0 );
 
     stop_playing_notes( d->preview_instrument );
     d->note_on( previewNote );
+
+    // The old layer may still be playing.
+    if( pOldLayer ) {
+	d->reaper->defer( pOldLayer, pOldLayer->get_sample_bytes() );
+    }
 }
 
 
@@ -609,15 +1124,87 @@ void Sampler::preview_instrument( T<Instrument>::shared_ptr instr )
 
     old_preview = d->preview_instrument;
     d->preview_instrument = instr;
+    // The audio thread finds it by its handle.
+    d->publish( d->edit_instruments() );
     Note previewNote( d->preview_instrument, 1.0, 1.0, 0.5, 0.5, 0 );
 
     d->note_on( previewNote );	// exclusive note
+
+    // Its voices may still be playing it.
+    if( old_preview ) {
+	d->reaper->defer( old_preview, old_preview->get_sample_bytes(), &Instrument::is_busy );
+    }
+}
+
+namespace
+{
+    bool handle_less(const SamplerPrivate::Instruments::handle_t& a,
+		     const SamplerPrivate::Instruments::handle_t& b)
+    {
+	return a.first < b.first;
+    }
+} // anonymous namespace
+
+void SamplerPrivate::Instruments::index()
+{
+    handles.clear();
+    handles.reserve( MAX_INSTRUMENTS + 1 );
+    Instrument* instr;
+    for( unsigned k = 0 ; k < list->get_size() ; ++k ) {
+	instr = list->get(k).get();
+	handles.push_back( handle_t(instr->get_handle(), instr) );
+    }
+    if( preview ) {
+	handles.push_back( handle_t(preview->get_handle(), preview.get()) );
+    }
+    std::sort( handles.begin(), handles.end(), handle_less );
+}
+
+Instrument* SamplerPrivate::Instruments::find(uint32_t handle) const
+{
+    std::vector<handle_t>::const_iterator it;
+    it = std::lower_bound( handles.begin(), handles.end(),
+			   handle_t(handle, (Instrument*)0), handle_less );
+    if( it == handles.end() || it->first != handle ) {
+	return 0;
+    }
+    return it->second;
+}
+
+void SamplerPrivate::publish(T<Instruments>::shared_ptr set)
+{
+    set->preview = preview_instrument;
+    set->index();
+    instruments.publish(set);
+}
+
+T<SamplerPrivate::Instruments>::shared_ptr SamplerPrivate::edit_instruments()
+{
+    T<Instruments>::shared_ptr set( new Instruments( *instruments.current() ) );
+    set->list.reset( new InstrumentList( *set->list ) );
+    set->serial = instrument_edits.fetchAndAddRelaxed(1) + 1;
+    return set;
+}
+
+void SamplerPrivate::add_ports(Instruments& set, size_t count)
+{
+    T<AudioPort>::shared_ptr port;
+    while( set.ports.size() < count ) {
+	port = port_manager->allocate_port(
+	    QString("Instrument %1").arg(set.ports.size() + 1),
+	    AudioPort::OUTPUT,
+	    AudioPort::STEREO
+	    );
+	if( !port ) break;
+	set.ports.push_back(port);
+    }
 }
 
 /**
  * \brief Method for adding an instrument to the sampler. 
  *
- * Do not do it directly with the instrument list.
+ * Do not do it directly with the instrument list.  Not RT-safe,
+ * but it never blocks process().
  */
 void Sampler::add_instrument(T<Instrument>::shared_ptr instr)
 {
@@ -625,15 +1212,24 @@ void Sampler::add_instrument(T<Instrument>::shared_ptr instr)
 	ERRORLOG("Attempted to add NULL instrument to Sampler.");
 	return;
     }
+    T<SamplerPrivate::Instruments>::shared_ptr set = d->edit_instruments();
+    // Reuse a spare port (see swap_instrument_list()) if there
+    // is one.
+    if( set->ports.size() > set->list->get_size() ) {
+	set->list->add(instr);
+	d->publish(set);
+	return;
+    }
     T<AudioPort>::shared_ptr port;
     port = d->port_manager->allocate_port(
 	instr->get_name(),
 	AudioPort::OUTPUT,
 	AudioPort::STEREO
 	);
-    if(port && instr) {
-	d->instrument_list->add(instr);
-	d->instrument_ports.push_back(port);
+    if(port) {
+	set->list->add(instr);
+	set->ports.push_back(port);
+	d->publish(set);
     }
 }
 
@@ -645,39 +1241,132 @@ void Sampler::add_instrument(T<Instrument>::shared_ptr instr)
 void Sampler::remove_instrument(T<Instrument>::shared_ptr instr)
 {
     if(!instr) return;
-    int pos = d->instrument_list->get_pos(instr);
+    T<SamplerPrivate::Instruments>::shared_ptr set = d->edit_instruments();
+    int pos = set->list->get_pos(instr);
     if(pos == -1) return;
-    d->instrument_list->del(pos);
+    set->list->del(pos);
     std::deque< T<AudioPort>::shared_ptr >::iterator pit;
-    pit = d->instrument_ports.begin() + pos;
-    d->port_manager->release_port(*pit);
-    d->instrument_ports.erase(pit);
+    pit = set->ports.begin() + pos;
+    T<AudioPort>::shared_ptr port = *pit;
+    set->ports.erase(pit);
+    d->publish(set);
+    d->port_manager->release_port(port);
+
+    // Notes that are queued or playing may still refer to it.
+    // The reaper frees it when they are done.
+    d->reaper->defer( instr, instr->get_sample_bytes(), &Instrument::is_busy );
+}
+
+/**
+ * \brief Move the instrument at 'from' to position 'to'.
+ *
+ * The instruments in between shift by one.  The ports stay in
+ * place, so each instrument now renders to the port of its new
+ * position.  Do not do it directly with the instrument list.
+ * Not RT-safe, but it never blocks process().
+ */
+void Sampler::move_instrument(unsigned from, unsigned to)
+{
+    T<SamplerPrivate::Instruments>::shared_ptr set = d->edit_instruments();
+    unsigned size = set->list->get_size();
+    if( from >= size || to >= size || from == to ) return;
+    set->list->move(from, to);
+    d->publish(set);
 }
 
 /**
  * \brief Clears out all instruments.
  *
+ * With keep_ports, the ports stay as spares for the next
+ * add_instrument()'s.
  */
-void Sampler::clear()
+void Sampler::clear(bool keep_ports)
 {
-    std::deque< T<AudioPort>::shared_ptr >& ports = d->instrument_ports;
-    std::deque< T<AudioPort>::shared_ptr >::iterator pit;
+    T<SamplerPrivate::Instruments>::shared_ptr set = d->edit_instruments();
+    InstrumentList old( *set->list );
+    set->list->clear();
+    std::deque< T<AudioPort>::shared_ptr > ports;
+    if( ! keep_ports ) {
+	ports.swap(set->ports);
+    }
+    d->publish(set);
 
+    std::deque< T<AudioPort>::shared_ptr >::iterator pit;
     for(pit = ports.begin() ; pit != ports.end() ; ++pit) {
 	d->port_manager->release_port(*pit);
     }
-    d->instrument_list->clear();
-    d->instrument_ports.clear();
+
+    // Like remove_instrument(), for each of them.
+    T<Instrument>::shared_ptr instr;
+    for( unsigned k = 0 ; k < old.get_size() ; ++k ) {
+	instr = old.get(k);
+	d->reaper->defer( instr, instr->get_sample_bytes(), &Instrument::is_busy );
+    }
 }
 
 /**
  * \brief Direct access to the instruments in the sampler.
  *
- * Do not use this to add instruments to the sampler.
+ * Do not use this to add or remove instruments.  process() may
+ * be reading the list.
  */
 T<InstrumentList>::shared_ptr Sampler::get_instrument_list()
 {
-    return d->instrument_list;
+    return d->instruments.current()->list;
+}
+
+uint32_t Sampler::get_instrument_handle(unsigned pos)
+{
+    uint32_t handle = 0;
+    d->reader->enter();
+    SamplerPrivate::Instruments* set = d->instruments.get();
+    if( pos < set->list->get_size() ) {
+	handle = set->list->get(pos)->get_handle();
+    }
+    d->reader->leave();
+    return handle;
+}
+
+/**
+ * \brief Replace all of the instruments at once.
+ *
+ * All notes are stopped and 'list' becomes the instrument list.
+ * The ports are reused by position, so this is safe to call from
+ * the audio thread (in place of process()) as long as there are
+ * already enough ports (see reserve_instrument_ports()) and no
+ * more than MAX_INSTRUMENTS instruments.  If not, the missing
+ * ports (or handle index) are allocated here.
+ *
+ * Unlike the other edits, this changes the instruments that
+ * process() reads in place.  Only call it from the thread that
+ * calls process().
+ *
+ * Returns the old list.  The caller must make sure that the
+ * instruments are not deleted in the audio thread.
+ */
+T<InstrumentList>::shared_ptr Sampler::swap_instrument_list(T<InstrumentList>::shared_ptr list)
+{
+    d->stop_voices( 0 );
+    SamplerPrivate::Instruments& set = *d->instruments.get();
+    d->add_ports( set, list->get_size() );
+    T<InstrumentList>::shared_ptr old = set.list;
+    set.list = list;
+    set.index();
+    return old;
+}
+
+/**
+ * \brief Make sure there are at least 'count' instrument ports.
+ *
+ * Spare ports stay silent until an instrument uses them.  Not
+ * RT-safe.
+ */
+void Sampler::reserve_instrument_ports(size_t count)
+{
+    T<SamplerPrivate::Instruments>::shared_ptr set = d->edit_instruments();
+    if( set->ports.size() >= count ) return;
+    d->add_ports( *set, count );
+    d->publish(set);
 }
 
 void Sampler::set_max_note_limit(int max)
@@ -690,11 +1379,108 @@ int Sampler::get_max_note_limit()
     return d->max_notes;
 }
 
+/**
+ * \brief Number of times a streaming sample ran out of data.
+ *
+ * If this increases, the disk is too slow for the preload size
+ * (Preferences::m_nSamplePreloadFrames).
+ */
+unsigned Sampler::get_stream_underruns()
+{
+    return d->streamer->underruns();
+}
+
+/**
+ * The loaders (DrumkitLoader, Serialization) convert samples to
+ * this cache's rate, so that the voices don't have to resample
+ * them.  The engine sets the rate when the audio driver starts.
+ */
+T<SampleRateCache>::shared_ptr Sampler::get_sample_rate_cache()
+{
+    return d->sample_rate_cache;
+}
+
+T<Reaper>::shared_ptr Sampler::get_reaper()
+{
+    return d->reaper;
+}
+
+/**
+ * Time the voices of each instrument.  This costs two clock reads
+ * per voice, so it is off by default.
+ */
+void Sampler::set_profiling(bool enabled)
+{
+    d->profiling.fetchAndStoreOrdered( enabled ? 1 : 0 );
+}
+
+bool Sampler::get_profiling()
+{
+    return d->profiling.fetchAndAddAcquire(0) != 0;
+}
+
+/**
+ * The number of instruments timed in the last process() cycle.
+ * This and get_instrument_profile() are for the audio thread,
+ * after process().
+ */
+unsigned Sampler::get_profiled_instruments()
+{
+    return d->profiled_ports;
+}
+
+/**
+ * The number of voices that instrument 'index' (its position in
+ * the instrument list) rendered in the last process() cycle, and
+ * how long it took (ns).
+ */
+void Sampler::get_instrument_profile(unsigned index, unsigned& voices, uint64_t& ns)
+{
+    if( index >= d->profiled_ports ) {
+	voices = 0;
+	ns = 0;
+	return;
+    }
+    voices = d->port_voices[index];
+    ns = d->port_ns[index];
+}
+
+/**
+ * Render the voices of different instruments in parallel, on
+ * 'threads' worker threads plus the audio thread.  0 renders
+ * everything in the audio thread (the default).  If rt_priority >
+ * 0 the workers run SCHED_FIFO at that priority.  If 'pin' is set,
+ * each worker is bound to a CPU.
+ *
+ * The output is the same either way.  Not RT-safe: do not call
+ * while process() may be running.
+ */
+void Sampler::set_render_threads(unsigned threads, int rt_priority, bool pin)
+{
+    d->render_pool.reset();
+    if( threads > 0 ) {
+	d->render_pool.reset( new RenderPool(threads, rt_priority, pin) );
+    }
+}
+
+unsigned Sampler::get_render_threads()
+{
+    return (d->render_pool.get()) ? d->render_pool->threads() : 0;
+}
+
+void Sampler::set_voice_steal_policy(Sampler::steal_policy_t policy)
+{
+    d->steal_policy = policy;
+}
+
+Sampler::steal_policy_t Sampler::get_voice_steal_policy()
+{
+    return d->steal_policy;
+}
+
 void Sampler::set_per_instrument_outs(bool enabled)
 {
-    #warning "Code disabled:"
-    // d->per_instrument_outs = enabled;
-    ERRORLOG("Per instrument outs is not implemented");
+    d->per_instrument_outs = enabled;
 }
 
 bool Sampler::get_per_instrument_outs()
@@ -27,45 +27,206 @@
 #include <Tritium/Note.hpp>
 #include <Tritium/memory.hpp>
 #include <Tritium/InstrumentList.hpp>
+#include <Tritium/SeqEvent.hpp>
+#include <Tritium/SampleRateCache.hpp>
+#include <Tritium/Reaper.hpp>
+#include <Tritium/Logger.hpp>
+#include <Tritium/globals.hpp>
+#include "VoicePool.hpp"
+#include "FilterBank.hpp"
+#include "SampleStreamer.hpp"
+#include "WorkerThread.hpp"
+#include "RenderPool.hpp"
+#include "RtSnapshot.hpp"
 #include <QMutex>
+#include <QAtomicInt>
+#include <vector>
 #include <cassert>
 
 namespace Tritium
 {
     class Instrument;
 
+    /**
+     * Runs a Reaper on a WorkerThread.
+     *
+     * A retire() that finds the ring full can't be retried by the
+     * audio thread without waiting, and it can't free the object
+     * itself.  That is a leak, and a sign that the ring is too
+     * small, so it is logged here rather than in the audio thread.
+     */
+    class ReaperClient : public WorkerThreadClient
+    {
+    public:
+	ReaperClient(T<Reaper>::shared_ptr reaper) :
+	    _reaper(reaper),
+	    _overflows(0)
+	    {}
+
+	bool events_waiting() {
+	    return _reaper->ready() || _reaper->overflows() != _overflows;
+	}
+	int process() {
+	    _reaper->collect();
+	    unsigned overflows = _reaper->overflows();
+	    if( overflows != _overflows ) {
+		WARNINGLOG( QString("Reaper ring full: %1 objects leaked (%2 in all)")
+			    .arg(overflows - _overflows)
+			    .arg(overflows) );
+		_overflows = overflows;
+	    }
+	    return 0;
+	}
+	void shutdown() {}
+
+    private:
+	T<Reaper>::shared_ptr _reaper;
+	unsigned _overflows;   // Already logged
+    };
+
     struct SamplerPrivate
     {
+	/**
+	 * The instruments and their ports, as process() sees them.
+	 * Edits from other threads publish a changed copy (see
+	 * edit_instruments()), so process() never waits for them.
+	 */
+	struct Instruments
+	{
+	    typedef std::pair<uint32_t, Instrument*> handle_t;
+
+	    T<InstrumentList>::shared_ptr list;
+	    std::deque< T<AudioPort>::shared_ptr > ports; // One per instrument, then spares
+	    int serial;   // Different for each edit (see update_voice_ports())
+	    T<Instrument>::shared_ptr preview;
+	    std::vector<handle_t> handles;  // list and preview, sorted by handle
+
+	    Instruments() : serial(0) {}
+
+	    // Rebuild 'handles'.  Doesn't allocate if it was built
+	    // before and there are no more than MAX_INSTRUMENTS.
+	    void index();
+	    // The instrument with Instrument::get_handle() == 'handle',
+	    // or 0.
+	    Instrument* find(uint32_t handle) const;
+	};
+
 	Sampler& parent;
-	typedef std::list<Note> NoteList;
-	QMutex mutex_current_notes;            // Must be locked when adding/removing elements
-	NoteList current_notes;
-	T<InstrumentList>::shared_ptr instrument_list;
+	VoicePool voices;                      // Only touched by the audio thread
+	T<RtReader>::shared_ptr reader;        // process()
+	RtSnapshot<Instruments> instruments;
+	T<Reaper>::shared_ptr reaper;          // Frees what process() lets go of
+	Instruments* rt_instruments;           // Audio thread: this cycle's instruments
+	int rt_serial;                         // Audio thread: serial the voice ports are for
+	QAtomicInt instrument_edits;           // Source of Instruments::serial
 	T<Instrument>::shared_ptr preview_instrument;         // Replaces __preview_instrument
 	T<AudioPortManager>::shared_ptr port_manager;
-	std::deque< T<AudioPort>::shared_ptr > instrument_ports;
+	T<SampleStreamer>::shared_ptr streamer; // Tails of streaming samples
+	T<SampleRateCache>::shared_ptr sample_rate_cache;
+	WorkerThread stream_thread;
+
+	// Parallel rendering (see render_voices()).  If there is no
+	// render_pool, everything is rendered by the audio thread.
+	T<RenderPool>::auto_ptr render_pool;
+	std::vector<int> port_first;   // Port --> first voice to render on it, or -1
+	std::vector<int> port_last;    // Port --> last voice to render on it
+	std::vector<int> voice_next;   // Voice --> next voice on the same port, or -1
+	std::vector<int> voice_ended;  // Voice --> render_note() result
+	std::vector<int> busy_ports;   // Ports with voices this cycle
+
+	// Voices with the low pass filter on (see render_filtered()).
+	FilterBank filters;            // Filter state of each voice
+	std::vector<int> filter_next;  // Voice --> next filtered voice in the same list, or -1
+
+	// Per-instrument profiling (see Sampler::set_profiling()).
+	QAtomicInt profiling;
+	bool profile_cycle;               // Timing the voices this cycle
+	unsigned profiled_ports;          // Ports in the last cycle's profile
+	std::vector<unsigned> port_voices; // Port --> voices rendered
+	std::vector<uint64_t> port_ns;     // Port --> render time (ns)
+
+	// Per-instrument outputs (audio thread).  See bind_outs().
+	std::vector<float*> out_L;     // Instrument --> buffer for this cycle, or 0
+	std::vector<float*> out_R;
+	unsigned out_count;            // Instruments given a buffer
+	unsigned bound_ports;          // Ports that may use external buffers
 
 	// Configuration
 	int max_notes; // Maximum number of notes played at any one time
 	bool per_instrument_outs; // Enable an output for each instrument.
 	bool instrument_outs_prefader;
+	Sampler::steal_policy_t steal_policy;
+
+	// Requests from other threads (previews, stop_playing_notes()).
+	// process() is the only consumer and never locks.  Producers
+	// are serialized with mutex_commands.
+	enum { COMMAND_QUEUE_SIZE = 64 };
+	SeqEvent commands[COMMAND_QUEUE_SIZE];
+	QAtomicInt command_read;
+	QAtomicInt command_write;
+	QMutex mutex_commands;
 
 	SamplerPrivate(Sampler* par, T<AudioPortManager>::shared_ptr apm) :
 	    parent( *par ),
-	    port_manager(apm),
-	    instrument_list( new InstrumentList ),
+	    voices( MAX_VOICES ),
+	    reader( new RtReader ),
+	    instruments( *reader, new_instruments() ),
+	    reaper( new Reaper(reader) ),
+	    rt_instruments( 0 ),
+	    rt_serial( -1 ),
+	    instrument_edits( 0 ),
 	    preview_instrument(),
+	    port_manager(apm),
+	    port_first( MAX_INSTRUMENTS, -1 ),
+	    port_last( MAX_INSTRUMENTS, -1 ),
+	    voice_next( MAX_VOICES, -1 ),
+	    voice_ended( MAX_VOICES, 0 ),
+	    busy_ports( MAX_INSTRUMENTS, 0 ),
+	    filters( MAX_VOICES ),
+	    filter_next( MAX_VOICES, -1 ),
+	    profiling(0),
+	    profile_cycle(false),
+	    profiled_ports(0),
+	    port_voices( MAX_INSTRUMENTS, 0 ),
+	    port_ns( MAX_INSTRUMENTS, 0 ),
+	    out_L( MAX_INSTRUMENTS, (float*)0 ),
+	    out_R( MAX_INSTRUMENTS, (float*)0 ),
+	    out_count(0),
+	    bound_ports(0),
 	    max_notes(-1),
 	    per_instrument_outs(false),
-	    instrument_outs_prefader(false)
+	    instrument_outs_prefader(false),
+	    steal_policy(Sampler::STEAL_OLDEST),
+	    command_read(0),
+	    command_write(0)
 	    {
+		streamer.reset( new SampleStreamer );
+		sample_rate_cache.reset( new SampleRateCache );
+		stream_thread.add_client( streamer );
+		stream_thread.add_client( WorkerThread::pointer_t( new ReaperClient(reaper) ) );
+		stream_thread.start();
 	    }
 
 	~SamplerPrivate() {
+	    stream_thread.shutdown();
+	    stream_thread.wait();
 	    parent.clear();
 	}
 
-	// Add/Remove notes from current_notes based on event 'ev'
+	static T<Instruments>::shared_ptr new_instruments() {
+	    T<Instruments>::shared_ptr set( new Instruments );
+	    set->list.reset( new InstrumentList );
+	    return set;
+	}
+	// A copy of the published instruments to change and
+	// publish.  Not RT-safe.
+	T<Instruments>::shared_ptr edit_instruments();
+	// Index 'set' (with the preview instrument) and publish it.
+	void publish(T<Instruments>::shared_ptr set);
+	// Allocate ports until 'set' has 'count' of them.
+	void add_ports(Instruments& set, size_t count);
+
+	// Start/stop voices based on event 'ev'
 	void handle_event(const SeqEvent& ev);
 
 	// These are utils for handle_event().
@@ -77,23 +238,89 @@ namespace Tritium
 	void note_on(Note& note);
 	void note_off(Note& note);
 
-	// Actually render the specific note(s) to the buffers.
-	int render_note(Note& note, uint32_t nFrames, uint32_t frame_rate);
+	// Voice management (audio thread)
+	int steal_voice(Instrument* incoming);
+	void end_voice(int v);
+	void stop_voices(Instrument* instr);
+	// Look up the port of every voice again, when the
+	// instruments have changed.
+	void update_voice_ports();
+
+	// Queue a request for the audio thread.  Not RT-safe.
+	bool push_command(const SeqEvent& ev);
+	// Handle the queued requests before 'end'.  process() reads
+	// command_write before the instruments, so every request
+	// that it handles finds the instruments that were published
+	// before it was pushed.
+	void process_commands(int end);
+
+	// Point the instrument ports at the per-instrument outputs.
+	void bind_outs(uint32_t nFrames);
+	// Write zeros to the outputs that nothing rendered to.
+	void clear_silent_outs(uint32_t nFrames);
+
+	// Render all playing voices and end the ones that are done.
+	void render_voices(uint32_t nFrames, uint32_t frame_rate);
+	// Port that the notes of an instrument render to.  The voices keep
+	// theirs, so this is only for note-on's and edits.
+	int port_for_instrument(Instrument* instr);
+	AudioPort* instrument_port(int port) {
+	    return rt_instruments->ports[port].get();
+	}
+	// Render voice 'v' (timing it if profile_cycle).
+	void render_voice(int v, uint32_t nFrames, uint32_t frame_rate);
+	// Render the voices from 'v' on, following voice_next
+	// ('chain') or in voice order.
+	void render_list(int v, bool chain, uint32_t nFrames, uint32_t frame_rate);
+	// True if voice 'v' goes through the low pass filter.
+	bool voice_filtered(int v);
+
+	/**
+	 * Where a filtered voice renders in the current window (see
+	 * render_filtered()).  render_note() writes the voice's
+	 * input to the Group instead of mixing it, and fills in
+	 * what to mix the output with.
+	 */
+	struct FilterTap
+	{
+	    FilterBank::Group* group;
+	    unsigned index;         // Voice in the group
+	    uint32_t window;        // First frame of the window
+	    // Set by render_note()
+	    uint32_t begin, end;    // Frames written: [begin, end)
+	    int port;
+	    float cost_L, cost_R;
+	};
+
+	// Render the filtered voices from 'v' on (following
+	// filter_next), a FilterBank::Group at a time.
+	void render_filtered(int v, uint32_t nFrames, uint32_t frame_rate);
+	void render_filter_group(FilterBank::Group& group, uint32_t nFrames, uint32_t frame_rate);
+	// Mix the filter output of 'tap' into its port.
+	void mix_tap(const FilterTap& tap, VoicePool::Voice& voice);
+
+	// Actually render the specific note(s) to the buffers.  With
+	// a 'tap', nFrames is the end of its window.
+	int render_note(VoicePool::Voice& voice, uint32_t nFrames, uint32_t frame_rate, FilterTap* tap = 0);
 	int render_note_no_resample(
-	    T<Sample>::shared_ptr pSample,
-	    Note& note,
+	    Sample* pSample,
+	    VoicePool::Voice& voice,
+	    unsigned nSampleFrames,
 	    int nFrames,
 	    float cost_L,
-	    float cost_R
+	    float cost_R,
+	    FilterTap* tap
 	    );
 	int render_note_resample(
-	    T<Sample>::shared_ptr pSample,
-	    Note& note,
+	    Sample* pSample,
+	    VoicePool::Voice& voice,
+	    unsigned nSampleFrames,
 	    int nFrames,
 	    uint32_t frame_rate,
 	    float cost_L,
 	    float cost_R,
-	    float fLayerPitch
+	    float fLayerPitch,
+	    FilterTap* tap
 	    );
 
     }; // class SamplerPrivate
@@ -20,18 +20,38 @@
  */
 
 #include <Tritium/SeqEvent.hpp>
+#include <Tritium/Instrument.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/has_trivial_copy.hpp>
+#include <boost/type_traits/has_trivial_destructor.hpp>
 
 using namespace Tritium;
 
 // NOTE: SeqEvent is fully defined in the header SeqEvent.hpp
 
+// The audio thread copies and drops SeqEvent's.  That must never
+// touch a reference count or free anything.
+BOOST_STATIC_ASSERT( boost::has_trivial_copy<SeqEvent>::value );
+BOOST_STATIC_ASSERT( boost::has_trivial_destructor<SeqEvent>::value );
+
+void SeqEvent::set_note(const Note& note)
+{
+    T<Instrument>::shared_ptr instr = note.get_instrument();
+    instrument = instr ? instr->get_handle() : 0;
+    velocity = note.get_velocity();
+    pan_l = note.get_pan_l();
+    pan_r = note.get_pan_r();
+    pitch = note.m_noteKey.m_nOctave * 12 + note.m_noteKey.m_key;
+    pitch += note.get_pitch();
+}
+
 bool SeqEvent::operator==(const SeqEvent& o) const
 {
     return ((frame == o.frame)
 	    && (type == o.type)
 	    && (quantize == o.quantize)
-	    && (note.get_instrument() == o.note.get_instrument())
-	    && (note.get_velocity() == o.note.get_velocity()) );
+	    && (instrument == o.instrument)
+	    && (velocity == o.velocity) );
 }
 
 bool SeqEvent::operator!=(const SeqEvent& o) const
@@ -39,8 +59,8 @@ bool SeqEvent::operator!=(const SeqEvent& o) const
     return ((frame != o.frame)
 	    || (type != o.type)
 	    || (quantize != o.quantize)
-	    || (note.get_instrument() != o.note.get_instrument())
-	    || (note.get_velocity() != o.note.get_velocity()) );
+	    || (instrument != o.instrument)
+	    || (velocity != o.velocity) );
 }
 
 bool SeqEvent::operator<(const SeqEvent& o) const
@@ -58,8 +58,8 @@ SeqScript::size_type SeqScript::size() const
 SeqScript::size_type SeqScript::size(SeqScript::frame_type before_frame) const
 {
     SeqScript::size_type cnt = 0;
-    SeqScriptPrivate::iterator cur;
-    for( cur = d->begin() ; (cur != d->end()) && (cur->ev.frame < before_frame) ; ++cur ) {
+    SeqScriptPrivate::iterator cur, end = d->lower_bound(before_frame);
+    for( cur = d->begin() ; cur != end ; ++cur ) {
 	++cnt;
     }
     return cnt;
@@ -127,7 +127,7 @@ void SeqScript::insert_note(const SeqScript::value_type& event, SeqScript::frame
     if( length != unsigned(-1) ) {
 	off.frame += length;
 	off.type = SeqEvent::NOTE_OFF;
-	off.note.set_velocity(0.0);
+	off.velocity = 0.0f;
 	d->insert(off);
     }
 }
@@ -146,7 +146,5 @@ SeqScriptConstIterator SeqScript::end_const() const
 
 SeqScriptConstIterator SeqScript::end_const(SeqScript::frame_type nframes) const
 {
-    SeqScriptPrivate::iterator cur;
-    for( cur = d->begin() ; (cur != d->end()) && (cur->ev.frame < nframes) ; ++cur );
-    return SeqScriptConstIterator(cur);
+    return SeqScriptConstIterator(d->lower_bound(nframes));
 }
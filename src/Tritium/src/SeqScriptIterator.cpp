@@ -106,6 +106,7 @@ namespace Tritium
     _Self& _SeqScriptIterator<E>::operator=(const _SeqScriptIterator<E>& o)
     {
 	(*d) = (*o.d);
+	return (*this);
     }
 
     template class _SeqScriptIterator<SeqEvent>;
@@ -41,31 +41,36 @@ using namespace Tritium;
  * circulation (i.e. they've all been processed).
  *
  * Implementing this will use a pre-allocated vector with an embedded
- * linked-list.  The vector is the pre-allocated block of memory.  We
- * keep track of the next free memory location for that.  The values
- * inside the vector will have a pointer to the "next" element in the
- * linked list.  Thus, we only need to keep track of the head and the
- * tail of the linked list.
+ * skip list.  The vector is the pre-allocated block of memory, and
+ * the unused entries are kept on a free list.  Every node is on
+ * level 0 (an ordinary doubly-linked list) and about 1/4 of the
+ * nodes on each level are also on the next one up.  m_nil is the
+ * head and the tail of every level.
+ *
+ *   - insert() searches from the top level down:  O(log n).
+ *     Events with the same frame stay in the order inserted.
+ *   - remove(iterator) unlinks a node by its prev/next:  O(1).
+ *   - consumed() pops the expired events off the front.
+ *
+ * The nodes store the absolute frame (ev.frame + m_epoch when it
+ * was inserted) and consumed() only advances m_epoch.  The iterator
+ * writes the relative frame back into ev.frame when the event is
+ * accessed.  m_epoch is 64-bit, so it won't wrap.
  *
  **************************************************************
  */
 
 SeqScriptPrivate::SeqScriptPrivate(size_t reserved) :
     m_vec(reserved),
-    m_head(),
-    m_tail(),
+    m_next_free(0),
     m_list_size(0),
-    m_free(reserved)
+    m_free(reserved),
+    m_level(1),
+    m_epoch(0),
+    m_seed(0x9E3779B9)
 {
     QMutexLocker mx(&m_mutex);
-
-    internal_iterator cur;
-    for( cur = m_vec.begin() ; cur != m_vec.end() ; ++cur ) {
-	cur->me = cur;
-    }
-    m_next_free = m_vec.begin();
-    m_head.reset( alloc() );
-    m_tail = m_head;
+    reset_storage();
 }
 
 SeqScriptPrivate::~SeqScriptPrivate()
@@ -93,32 +98,32 @@ void SeqScriptPrivate::reserve(size_t events)
     m_vec.clear();
     m_vec.reserve(events);
     m_vec.insert( m_vec.end(), events, SeqEventWrap() );
-    m_list_size = 0;
-    m_free = m_vec.size();
-
-    internal_iterator cur;
-    for( cur = m_vec.begin() ; cur != m_vec.end() ; ++cur ) {
-	cur->me = cur;
-    }
-    m_next_free = m_vec.begin();
-    m_head.reset(alloc());
-    m_tail = m_head;
+    reset_storage();
 }
 
 void SeqScriptPrivate::insert(const SeqEvent& event)
 {
     QMutexLocker mx(&m_mutex);
     internal_iterator next = alloc();
+    if( ! next ) return;
     next->ev = event;
+    next->abs = m_epoch + event.frame;
     insert(next);    
 }
 
 void SeqScriptPrivate::remove(const SeqEvent& event)
 {
-    iterator cur;
-    for( cur=begin() ; cur!=end() ; ++cur ) {
-	if( event == cur->ev ) {
-	    remove(cur);
+    QMutexLocker mx(&m_mutex);
+    uint64_t abs = m_epoch + event.frame;
+    internal_iterator cur = find_first(abs);
+    internal_iterator tmp;
+    while( (cur != &m_nil) && (cur->abs == abs) ) {
+	tmp = cur;
+	cur = cur->next[0];
+	tmp->ev.frame = event.frame;
+	if( event == tmp->ev ) {
+	    unlink(tmp);
+	    dealloc(tmp);
 	}
     }
 }
@@ -126,114 +131,177 @@ void SeqScriptPrivate::remove(const SeqEvent& event)
 void SeqScriptPrivate::remove(iterator pos)
 {
     QMutexLocker mx(&m_mutex);
-    internal_iterator cur;
+    internal_iterator node = pos.node();
 
-    if( (pos->me) == (m_head->me) ) {
-	m_head = m_head->next;
-	pos->used = false;
-	++m_free;
-	--m_list_size;
-	return;
-    }
-    for(cur = m_vec.begin() ; cur != m_vec.end() ; ++cur ) {
-	if( cur->next == pos->me ) {
-	    break;
-	}
-    }
-    if( cur == m_vec.end() ) {
+    if( (node == 0) || (node == &m_nil) || ! node->used ) {
 	return;
     }
-    if( cur->next == pos->me ) {
-	cur->next = pos->next;
-	pos->used = false;
-	++m_free;
-	--m_list_size;
-    }
+    unlink(node);
+    dealloc(node);
 }
 
 void SeqScriptPrivate::clear()
 {
     QMutexLocker mx(&m_mutex);
-    iterator cur;
-    for( cur = m_head ; cur != m_tail ; ++cur ) {
-	cur->used = false;
-	++m_free;
-	--m_list_size;
+    internal_iterator cur, tmp;
+    cur = m_nil.next[0];
+    while( cur != &m_nil ) {
+	tmp = cur;
+	cur = cur->next[0];
+	dealloc(tmp);
     }
     assert( m_list_size == 0 );
-    m_next_free = m_vec.begin();
-    m_head.reset( alloc() );
-    m_tail = m_head;
+    for( unsigned k=0 ; k<SeqEventWrap::MAX_LEVEL ; ++k ) {
+	m_nil.next[k] = &m_nil;
+	m_nil.prev[k] = &m_nil;
+    }
+    m_level = 1;
+    m_epoch = 0;
 }
 
 SeqScriptPrivate::iterator SeqScriptPrivate::begin()
 {
-    return m_head;
+    return iterator(m_nil.next[0], &m_epoch);
 }
 
 SeqScriptPrivate::iterator SeqScriptPrivate::end()
 {
-    return m_tail;
+    return iterator(&m_nil, &m_epoch);
+}
+
+SeqScriptPrivate::iterator SeqScriptPrivate::lower_bound(SeqScriptPrivate::frame_type frame)
+{
+    return iterator(find_first(m_epoch + frame), &m_epoch);
 }
 
 void SeqScriptPrivate::consumed(SeqScriptPrivate::frame_type before_frame)
 {
     QMutexLocker mx(&m_mutex);
 
-    iterator cur = m_head;
-    while( ((cur->me) != (m_tail->me)) && (cur->ev.frame < before_frame) ) {
-	cur->used = false;
-	++m_free;
-	--m_list_size;
-	++cur;
+    uint64_t until = m_epoch + before_frame;
+    internal_iterator cur = m_nil.next[0];
+    while( (cur != &m_nil) && (cur->abs < until) ) {
+	unlink(cur);
+	dealloc(cur);
+	cur = m_nil.next[0];
     }
-    m_head = cur->me;
+    m_epoch = until;
+}
+
+/**
+ * Puts all of m_vec on the free list and empties the skip list.
+ */
+void SeqScriptPrivate::reset_storage()
+{
+    internal_iterator cur;
+    size_t k;
 
-    for(cur = m_head ; (cur->me) != (m_tail->me) ; ++cur ) {
-	cur->ev.frame -= before_frame;
+    m_next_free = 0;
+    for( k = m_vec.size() ; k > 0 ; --k ) {
+	cur = &m_vec[k-1];
+	cur->used = false;
+	cur->height = 0;
+	cur->next[0] = m_next_free;
+	m_next_free = cur;
+    }
+    for( k=0 ; k<SeqEventWrap::MAX_LEVEL ; ++k ) {
+	m_nil.next[k] = &m_nil;
+	m_nil.prev[k] = &m_nil;
     }
+    m_list_size = 0;
+    m_free = m_vec.size();
+    m_level = 1;
+    m_epoch = 0;
 }
 
 SeqScriptPrivate::internal_iterator SeqScriptPrivate::alloc()
 {
-    internal_iterator rv;
-    if( m_free ) {
-	m_next_free->used = true;
-	rv = m_next_free;
+    internal_iterator rv = m_next_free;
+    if( rv ) {
+	m_next_free = rv->next[0];
+	rv->used = true;
 	--m_free;
-	while( m_free && m_next_free->used == true ) {
-	    ++m_next_free;
-	    if(m_next_free == m_vec.end()) m_next_free = m_vec.begin();
-	}
     } else {
 	assert(false);
     }    
     return rv;
 }
 
+void SeqScriptPrivate::dealloc(SeqScriptPrivate::internal_iterator pos)
+{
+    pos->used = false;
+    pos->height = 0;
+    pos->next[0] = m_next_free;
+    m_next_free = pos;
+    ++m_free;
+    --m_list_size;
+}
+
 void SeqScriptPrivate::insert(SeqScriptPrivate::internal_iterator pos)
 {
-    iterator cur;
-    if( m_list_size == 0 ) {
-	// Insert into empty list
-	pos->next = m_tail->me;
-	m_head = pos;
-	++m_list_size;
-    } else if(  pos->ev < m_head->ev ) {
-	// Insert at front
-	pos->next = m_head->me;
-	m_head = pos;
-	++m_list_size;
-    } else {
-	// Search for insertion point
-	for( cur = m_head ; cur->me != m_tail->me ; ++cur ) {
-	    if( (cur->next == m_tail->me) // Insert at end.
-		|| (pos->ev < cur->next->ev) ) { 
-		pos->next = cur->next;
-		cur->next = pos->me;
-		++m_list_size;
-		break;
-	    }
+    internal_iterator cur = &m_nil;
+    internal_iterator after[SeqEventWrap::MAX_LEVEL];
+    unsigned height = random_height();
+    unsigned k;
+
+    if( height > m_level ) m_level = height;
+
+    // Find the last node on each level that is not after pos.
+    for( k = m_level ; k > 0 ; --k ) {
+	while( (cur->next[k-1] != &m_nil)
+	       && (cur->next[k-1]->abs <= pos->abs) ) {
+	    cur = cur->next[k-1];
+	}
+	after[k-1] = cur;
+    }
+
+    pos->height = height;
+    for( k=0 ; k<height ; ++k ) {
+	pos->prev[k] = after[k];
+	pos->next[k] = after[k]->next[k];
+	after[k]->next[k]->prev[k] = pos;
+	after[k]->next[k] = pos;
+    }
+    ++m_list_size;
+}
+
+void SeqScriptPrivate::unlink(SeqScriptPrivate::internal_iterator pos)
+{
+    unsigned k;
+    for( k=0 ; k<pos->height ; ++k ) {
+	pos->prev[k]->next[k] = pos->next[k];
+	pos->next[k]->prev[k] = pos->prev[k];
+    }
+    while( (m_level > 1) && (m_nil.next[m_level-1] == &m_nil) ) {
+	--m_level;
+    }
+}
+
+SeqScriptPrivate::internal_iterator SeqScriptPrivate::find_first(uint64_t abs)
+{
+    internal_iterator cur = &m_nil;
+    unsigned k;
+    for( k = m_level ; k > 0 ; --k ) {
+	while( (cur->next[k-1] != &m_nil)
+	       && (cur->next[k-1]->abs < abs) ) {
+	    cur = cur->next[k-1];
 	}
     }
+    return cur->next[0];
+}
+
+unsigned SeqScriptPrivate::random_height()
+{
+    // xorshift32 -- cheap and real-time safe.
+    m_seed ^= m_seed << 13;
+    m_seed ^= m_seed >> 17;
+    m_seed ^= m_seed << 5;
+
+    uint32_t r = m_seed;
+    unsigned h = 1;
+    while( (h < SeqEventWrap::MAX_LEVEL) && ((r & 3) == 0) ) {
+	++h;
+	r >>= 2;
+    }
+    return h;
 }
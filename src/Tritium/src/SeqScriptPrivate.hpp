@@ -22,6 +22,7 @@
 #define TRITIUM_SEQSCRIPTPRIVATE_HPP
 
 #include <vector>
+#include <stdint.h>
 #include <Tritium/SeqEvent.hpp>
 #include <QMutex>
 
@@ -30,50 +31,68 @@ namespace Tritium
 
     struct SeqEventWrap
     {
-	typedef std::vector<SeqEventWrap>::iterator internal_iterator;
+	// Levels of the skip list.  With a branching factor of 4,
+	// 8 levels stay O(log n) up to ~64k events.
+	enum { MAX_LEVEL = 8 };
 
 	SeqEvent ev;
-	internal_iterator next;
-	internal_iterator me;
+	uint64_t abs;            // ev.frame + the epoch at insertion
+	SeqEventWrap* next[MAX_LEVEL];
+	SeqEventWrap* prev[MAX_LEVEL];
+	unsigned height;         // Levels this node is linked into
 	bool used;
 
-	SeqEventWrap() : ev(), next(0), used(false) {}
+	SeqEventWrap() : ev(), abs(0), height(0), used(false) {
+	    for( int k=0 ; k<MAX_LEVEL ; ++k ) {
+		next[k] = 0;
+		prev[k] = 0;
+	    }
+	}
     }; // struct SeqEventWrap
 
-    class SeqEventWrapIterator  // a bidirectional, Input iterator
+    class SeqEventWrapIterator  // a forward, Input iterator
     {
     public:
 	typedef SeqEventWrapIterator            _Self;
-	typedef SeqEventWrap::internal_iterator internal_iterator;
+	typedef SeqEventWrap*                   internal_iterator;
 	typedef SeqEventWrap                    value_type;
 	typedef SeqEventWrap*                   pointer;
 	typedef SeqEventWrap&                   reference;
 
-	SeqEventWrapIterator() : m_pos(0) {}
-	//SeqEventWrapIterator(pointer p) : m_pos(p) {}
-	SeqEventWrapIterator(const SeqEventWrapIterator& o) : m_pos(o.m_pos) {}
-	SeqEventWrapIterator(internal_iterator i) : m_pos(i) {}
+	SeqEventWrapIterator() : m_pos(0), m_epoch(0) {}
+	SeqEventWrapIterator(const SeqEventWrapIterator& o) :
+	    m_pos(o.m_pos), m_epoch(o.m_epoch) {}
+	SeqEventWrapIterator(internal_iterator i, const uint64_t* epoch) :
+	    m_pos(i), m_epoch(epoch) {}
 
 	void reset(internal_iterator p) {
 	    m_pos = p;
 	}
 
+	internal_iterator node() const {
+	    return m_pos;
+	}
+
+	// The frames are stored absolute, so that consumed() doesn't
+	// have to rewrite every event.  ev.frame is refreshed when
+	// the event is accessed.
 	reference operator*() {
+	    m_pos->ev.frame = frame_type(m_pos->abs - *m_epoch);
 	    return *m_pos;
 	}
 
 	pointer operator->() {
-	    return &(*m_pos);
+	    return &(operator*());
 	}
 
 	_Self& operator++() {
-	    m_pos = m_pos->next;
+	    m_pos = m_pos->next[0];
 	    return *this;
 	}
 
 	_Self operator++(int) {
 	    _Self tmp = *this;
-	    m_pos = m_pos->next;
+	    m_pos = m_pos->next[0];
 	    return tmp;
 	}
 
@@ -86,24 +105,29 @@ namespace Tritium
 	}
 
     private:
+	typedef SeqEvent::frame_type frame_type;
+
 	internal_iterator m_pos;
+	const uint64_t* m_epoch;
     };  // class SeqEventWrapIterator
 
     class SeqScriptPrivate
     {
     public:
 	typedef std::vector<SeqEventWrap>              internal_sequence_type;
-	typedef internal_sequence_type::iterator       internal_iterator;
-	typedef internal_sequence_type::const_iterator const_internal_iterator;
+	typedef SeqEventWrap*                          internal_iterator;
 	typedef SeqEventWrapIterator                   iterator;
 	typedef SeqEvent::frame_type                   frame_type;
 
     private:
 	internal_sequence_type m_vec;     // Data storage
-	iterator m_head, m_tail;          // Head and tail of linked list
-	internal_iterator m_next_free;    // Pointer to next free location
+	SeqEventWrap m_nil;               // Head and tail of the skip list
+	internal_iterator m_next_free;    // Free list (through next[0])
 	size_t m_list_size;               // Number of elements in list
 	size_t m_free;                    // Amount of free storage avail.
+	unsigned m_level;                 // Highest level in use
+	uint64_t m_epoch;                 // Frames consumed so far
+	uint32_t m_seed;                  // For random node heights
 	QMutex m_mutex;
 
     public:
@@ -128,14 +152,20 @@ namespace Tritium
 	// Iterator access;
 	iterator begin();
 	iterator end();
+	iterator lower_bound(frame_type frame); // First event at or after 'frame'
 
 	// Frame adjustment
 	void consumed(frame_type before_frame);
 
     private:
-	// These two presume that mutex is locked.
+	// These presume that mutex is locked.
+	void reset_storage();
 	internal_iterator alloc();  // Allocates and returns next pos. to be used.
+	void dealloc(internal_iterator pos);
 	void insert(internal_iterator pos); // Inserts an allocated location into the list.
+	void unlink(internal_iterator pos);
+	internal_iterator find_first(uint64_t abs); // First node with abs >= 'abs'
+	unsigned random_height();
     };
 
 } // namespace Tritium
@@ -31,6 +31,7 @@
 #include <Tritium/Pattern.hpp>
 #include <Tritium/EngineInterface.hpp>
 #include <Tritium/Sample.hpp>
+#include <Tritium/SampleRateCache.hpp>
 #include <Tritium/Sampler.hpp>
 #include <Tritium/Mixer.hpp>
 #include <Tritium/Note.hpp>
@@ -1335,6 +1336,8 @@ void SerializationQueue::handle_load_instrument_node(
     QStringList& errors
     )
 {
+    unsigned nPreload = m_engine->get_preferences()->m_nSamplePreloadFrames;
+    T<SampleRateCache>::shared_ptr cache = m_engine->get_sampler()->get_sample_rate_cache();
     QString sId = LocalFileMng::readXmlString( instrumentNode, "id", "" );                      // instrument id
     QString sDrumkit = LocalFileMng::readXmlString( instrumentNode, "drumkit", "" );    // drumkit
     QString sName = LocalFileMng::readXmlString( instrumentNode, "name", "" );          // name
@@ -1409,14 +1412,14 @@ void SerializationQueue::handle_load_instrument_node(
         if ( !drumkitPath.isEmpty() ) {
             sFilename = drumkitPath + "/" + sFilename;
         }
-        T<Sample>::shared_ptr pSample = Sample::load( sFilename );
+        T<Sample>::shared_ptr pSample = cache->load( sFilename, nPreload );
         if ( ! pSample ) {
             // When switching between 0.8.2 and 0.9.0 the default
             // drumkit was changed.  If loading the sample fails, try
             // again by adding ".flac" to the file name.
             sFilename = sFilename.left( sFilename.length() - 4 );
             sFilename += ".flac";
-            pSample = Sample::load( sFilename );
+            pSample = cache->load( sFilename, nPreload );
         }
         if ( ! pSample ) {
             ERRORLOG( "Error loading sample: " + sFilename + " not found" );
@@ -1443,7 +1446,7 @@ void SerializationQueue::handle_load_instrument_node(
             if ( !drumkitPath.isEmpty() ) {
                 sFilename = drumkitPath + "/" + sFilename;
             }
-            T<Sample>::shared_ptr pSample = Sample::load( sFilename );
+            T<Sample>::shared_ptr pSample = cache->load( sFilename, nPreload );
             if ( ! pSample ) {
                 ERRORLOG( "Error loading sample: " + sFilename + " not found" );
                 pInstrument->set_muted( true );
@@ -1566,6 +1569,7 @@ T<Pattern>::shared_ptr SerializationQueue::handle_load_pattern_node_pre094(
         }
         sequenceNode = ( QDomNode ) sequenceNode.nextSiblingElement( "sequence" );
     }
+    if( pPattern ) pPattern->compile_events();
 
     return pPattern;
 }
@@ -1631,6 +1635,7 @@ T<Pattern>::shared_ptr SerializationQueue::handle_load_pattern_node_094(
 
         noteNode = ( QDomNode ) noteNode.nextSiblingElement( "note" );
     }
+    pPattern->compile_events();
 
     return pPattern;
 }
@@ -23,6 +23,7 @@
 #include "version.h"
 
 #include "SongPrivate.hpp"
+#include "SongTimeline.hpp"
 #include "PatternModeList.hpp"
 #include "PatternModeManager.hpp"
 
@@ -31,6 +32,7 @@
 #include <QtCore/QMutexLocker>
 #include <algorithm>
 #include <deque>
+#include <unistd.h> // usleep()
 
 #include <Tritium/ADSR.hpp>
 #include <Tritium/DataPath.hpp>
@@ -78,11 +80,13 @@ namespace Tritium
 	, humanize_velocity_value( 0.0 )
 	, swing_factor( 0.0 )
 	, song_mode( Song::PATTERN_MODE )
+	, revision( 0 )
     {
 	DEBUGLOG( QString( "INIT '%1'" ).arg( name ) );
 	pat_mode.reset( new PatternModeManager );
 	pattern_list.reset( new PatternList );
 	pattern_group_sequence.reset( new Song::pattern_group_t );
+	timeline.reset( new SongTimeline(*pattern_group_sequence, bpm, resolution) );
     }
 
     Song::SongPrivate::~SongPrivate()
@@ -153,6 +157,7 @@ namespace Tritium
     void Song::set_resolution(unsigned r)
     {
 	d->resolution = r;
+	invalidate_timeline();
     }
 
     unsigned Song::get_resolution()
@@ -163,6 +168,7 @@ namespace Tritium
     void Song::set_bpm(float r)
     {
 	d->bpm = r;
+	invalidate_timeline();
     }
 
     float Song::get_bpm()
@@ -173,6 +179,11 @@ namespace Tritium
     void Song::set_modified(bool m)
     {
 	d->is_modified = m;
+	// The editors set this after every edit, including changes
+	// to the pattern groups.
+	if( m ) {
+	    invalidate_timeline();
+	}
     }
 
     bool Song::get_modified()
@@ -180,6 +191,11 @@ namespace Tritium
 	return d->is_modified;
     }
 
+    unsigned Song::get_revision()
+    {
+	return d->revision.fetchAndAddAcquire(0);
+    }
+
     void Song::set_name(const QString& name_p)
     {
 	d->name = name_p;
@@ -218,6 +234,7 @@ namespace Tritium
     void Song::set_pattern_group_vector( T<Song::pattern_group_t>::shared_ptr vect )
     {
 	d->pattern_group_sequence = vect;
+	invalidate_timeline();
     }
 
     void Song::set_notes( const QString& notes )
@@ -319,7 +336,7 @@ namespace Tritium
 	    );
 
 	while( ! bdl.done ) {
-	    sleep(1);
+	    usleep(10000);
 	}
 
 	T<Song>::shared_ptr song;
@@ -335,7 +352,7 @@ namespace Tritium
 	T<Sampler>::shared_ptr sampler = engine->get_sampler();
 	std::deque< T<Mixer::Channel>::shared_ptr > channels;
 
-	sampler->get_instrument_list()->clear();
+	sampler->clear( true );
 
 	while( ! bdl.empty() ) {
 	    switch(bdl.peek_type()) {
@@ -522,17 +539,7 @@ namespace Tritium
      */
     uint32_t Song::song_tick_count()
     {
-	uint32_t count = 0;
-	uint32_t bar = 1;
-	uint32_t tmp;
-
-	tmp = ticks_in_bar(bar);
-	while( tmp != unsigned(-1) ) {
-	    count += tmp;
-	    ++bar;
-	    tmp = ticks_in_bar(bar);
-	}
-	return count;
+	return get_timeline()->tick_count();
     }
 
 
@@ -552,22 +559,12 @@ namespace Tritium
     /**
      * Returns the bar number of the pattern group that contains the given
      * absolute tick.  (Always assuming tick 0 is at 1:1.0000.  Returns -1 if
-     * there is an error (s == 0) or of the tick is beyond the end of the song.
+     * there is an error (s == 0).  If the tick is beyond the end of the
+     * song, returns song_bar_count() + 1.
      */
     uint32_t Song::bar_for_absolute_tick(uint32_t abs_tick)
     {
-	uint32_t tick_count = abs_tick;
-	uint32_t bar_count = 1;
-	uint32_t tmp;
-
-	tmp = ticks_in_bar(bar_count);
-	if( tmp == -1 ) return -1;
-	while( tick_count >= tmp ) {
-	    tick_count -= tmp;
-	    ++bar_count;
-	    tmp = ticks_in_bar(bar_count);
-	}
-	return bar_count;
+	return get_timeline()->bar_for_absolute_tick(abs_tick);
     }
 
 
@@ -577,13 +574,7 @@ namespace Tritium
      */
     uint32_t Song::bar_start_tick(uint32_t bar)
     {
-	if( bar > song_bar_count() ) return -1;
-	uint32_t count = 0, k = 1;
-	while( k < bar ) {
-	    count += ticks_in_bar(k);
-	    ++k;
-	}
-	return count;
+	return get_timeline()->bar_start_tick(bar);
     }
 
 
@@ -593,22 +584,61 @@ namespace Tritium
      */
     uint32_t Song::ticks_in_bar(uint32_t bar)
     {
-	if( bar < 1 ) return -1;
-	if( song_bar_count() < 1 ) return -1;
-	if( bar > song_bar_count() ) return -1;
-
-	T<PatternList>::shared_ptr list = get_pattern_group_vector()->at(bar-1);
-	uint32_t j;
-	uint32_t max_ticks = 0;
-	uint32_t tmp;
-	for( j = 0 ; j < list->get_size() ; ++j ) {
-	    tmp = list->get(j)->get_length();
-	    if( tmp > max_ticks ) {
-		max_ticks = tmp;
-	    }
+	return get_timeline()->ticks_in_bar(bar);
+    }
+
+    /**
+     * Returns the frame (from the start of the song) of the absolute
+     * tick 'abs_tick'.  Fractional ticks are OK.
+     */
+    double Song::frame_for_tick(double abs_tick, uint32_t frame_rate)
+    {
+	return get_timeline()->frame_for_tick(abs_tick, frame_rate);
+    }
+
+    /**
+     * Returns the absolute tick (with the fraction) at 'frame'.
+     */
+    double Song::tick_for_frame(double frame, uint32_t frame_rate)
+    {
+	return get_timeline()->tick_for_frame(frame, frame_rate);
+    }
+
+    /**
+     * Call after changing the pattern groups, the length of a
+     * pattern in them, the tempo or the resolution.
+     * (set_modified(true) does this for you.)  Builds a new
+     * timeline and bumps the revision, so that the sequencer
+     * publishes the song again.
+     */
+    void Song::invalidate_timeline()
+    {
+	T<SongTimeline>::shared_ptr next(
+	    new SongTimeline(*d->pattern_group_sequence, d->bpm, d->resolution)
+	    );
+	{
+	    QMutexLocker lk(&d->timeline_mutex);
+	    d->timeline.swap(next);
 	}
+	d->revision.fetchAndAddOrdered(1);
+    }
 
-	return max_ticks;
+    /**
+     * Returns the timeline that the methods above use.  Adding or
+     * removing a pattern group is noticed even without
+     * invalidate_timeline().  This locks, and may build a new
+     * timeline, so the audio thread uses the one published with
+     * the song instead (see SongSequencer::Snapshot).
+     */
+    T<SongTimeline>::shared_ptr Song::get_timeline()
+    {
+	QMutexLocker lk(&d->timeline_mutex);
+	if( d->timeline->bar_count() != d->pattern_group_sequence->size() ) {
+	    d->timeline.reset(
+		new SongTimeline(*d->pattern_group_sequence, d->bpm, d->resolution)
+		);
+	}
+	return d->timeline;
     }
 
     // PATTERN MODE METHODS
@@ -23,12 +23,17 @@
 
 #include <Tritium/Song.hpp>
 #include <QString>
+#include <QMutex>
+#include <QAtomicInt>
 #include <Tritium/memory.hpp>
+#include <vector>
+#include <stdint.h>
 
 namespace Tritium
 {
     class PatternList;
     class PatternModeManager;
+    class SongTimeline;
 
     /**
      * \brief Internal data/implementation of Tritium::Song.
@@ -59,6 +64,16 @@ namespace Tritium
 
 	T<PatternModeManager>::auto_ptr pat_mode;
 
+	// The published timeline (see Song::get_timeline()).
+	// invalidate_timeline() builds a new one.
+	T<SongTimeline>::shared_ptr timeline;
+	QMutex timeline_mutex;
+
+	// Bumped when the song changes (see Song::get_revision()).
+	// The sequencer copies the song for the audio thread when it
+	// changes.
+	QAtomicInt revision;
+
         SongPrivate(const QString& name,
                     const QString& author,
                     float bpm,
@@ -20,6 +20,7 @@
  */
 
 #include <cassert>
+#include <algorithm>
 #include <QtCore/QMutexLocker>
 
 #include <Tritium/Engine.hpp>
@@ -32,10 +33,27 @@
 #include <Tritium/memory.hpp>
 
 #include "SongSequencer.hpp"
+#include "SongTimeline.hpp"
 
 using namespace Tritium;
 
-SongSequencer::SongSequencer()
+namespace
+{
+    bool event_before_tick(const SongSequencer::Snapshot::Event& ev, uint32_t tick)
+    {
+	return ev.tick < tick;
+    }
+
+    bool event_tick_less(const SongSequencer::Snapshot::Event& a,
+			 const SongSequencer::Snapshot::Event& b)
+    {
+	return a.tick < b.tick;
+    }
+} // anonymous namespace
+
+SongSequencer::SongSequencer() :
+    m_nRevision(0),
+    m_snapshot(m_reader)
 {
 }
 
@@ -47,35 +65,97 @@ void SongSequencer::set_current_song(T<Song>::shared_ptr pSong)
 {
     QMutexLocker mx(&m_mutex);
     m_pSong = pSong;
+    publish();
+}
+
+bool SongSequencer::update()
+{
+    // Engine::unlock() calls this, sometimes from the audio
+    // thread (MIDI actions).  Don't wait if someone else is
+    // publishing, and don't allocate if nothing changed.
+    if( ! m_mutex.tryLock() ) return false;
+    bool changed = m_pSong
+	&& ( m_pSong->get_revision() != unsigned(m_nRevision.fetchAndAddAcquire(0)) );
+    if( changed ) {
+	publish();
+    }
+    m_mutex.unlock();
+    return changed;
+}
+
+bool SongSequencer::stale()
+{
+    QMutexLocker mx(&m_mutex);
+    return m_pSong
+	&& ( m_pSong->get_revision() != unsigned(m_nRevision.fetchAndAddAcquire(0)) );
+}
+
+/**
+ * Copy the song's events for process().  Each bar gets the events
+ * of all of its patterns, sorted by tick.  Events on the same tick
+ * stay in pattern order, then note_map order.
+ */
+void SongSequencer::publish()
+{
+    T<Snapshot>::shared_ptr snap;
+    if( m_pSong ) {
+	m_nRevision.fetchAndStoreOrdered( m_pSong->get_revision() );
+	snap.reset( new Snapshot );
+	snap->timeline = m_pSong->get_timeline();
+	T<Song::pattern_group_t>::shared_ptr groups = m_pSong->get_pattern_group_vector();
+	snap->bars.resize( groups->size() );
+	for( size_t bar = 0 ; bar < groups->size() ; ++bar ) {
+	    T<PatternList>::shared_ptr patterns = groups->at(bar);
+	    Snapshot::bar_t& events = snap->bars[bar];
+	    for( unsigned k = 0 ; k < patterns->get_size() ; ++k ) {
+		const Pattern::event_table_t& table = patterns->get(k)->get_events();
+		Pattern::event_table_t::const_iterator n;
+		for( n = table.begin() ; n != table.end() ; ++n ) {
+		    Snapshot::Event ev;
+		    ev.tick = n->tick;
+		    ev.length = n->note->get_length();
+		    ev.event.type = SeqEvent::NOTE_ON;
+		    ev.event.set_note( *(n->note) );
+		    events.push_back(ev);
+		}
+	    }
+	    std::stable_sort( events.begin(), events.end(), event_tick_less );
+	}
+    }
+    m_snapshot.publish(snap);
+}
+
+T<SongTimeline>::shared_ptr SongSequencer::timeline()
+{
+    T<Snapshot>::shared_ptr snap = m_snapshot.current();
+    if( snap ) return snap->timeline;
+    return T<SongTimeline>::shared_ptr();
 }
 
 // This loads up song events into the SeqScript 'seq'.
+//
+// The events of each bar are sorted by tick (see publish()).
+// Instead of visiting every tick, we play the events on the current
+// tick and then jump straight to the next tick that has an event
+// (or to the start of the next bar).
 #warning "audioEngine_song_sequence_process() does not have any lookahead implemented."
 #warning "audioEngine_song_sequence_process() does not have pattern mode."
 int SongSequencer::process(SeqScript& seq, const TransportPosition& pos, uint32_t nframes, bool& pattern_changed)
 {
-    QMutexLocker mx(&m_mutex);
-
-    if( m_pSong == 0 ) return 0;
-
-	T<Song>::shared_ptr pSong = m_pSong;
 	TransportPosition cur;
 	uint32_t end_frame = pos.frame + nframes;  // 1 past end of this process() cycle
-	uint32_t this_tick;
-	Note* pNote;
+	uint32_t this_tick, next_tick, bar_ticks;
 	SeqEvent ev;
-	uint32_t pat_grp;
-	T<PatternList>::shared_ptr patterns;
-	Pattern::note_map_t::const_iterator n;
-	int k;
+	Snapshot::bar_t::const_iterator n, n_end;
 	uint32_t default_note_length, length;
 
 	pattern_changed = false;
 
-	if( m_pSong == 0 ) {
-		return 0;
-	}
-	if( pos.state != TransportPosition::ROLLING) {
+	m_reader.enter();
+	const Snapshot* song = m_snapshot.get();
+
+	if( song == 0 || pos.state != TransportPosition::ROLLING ) {
+		m_reader.leave();
 		return 0;
 	}
 
@@ -89,28 +169,31 @@ int SongSequencer::process(SeqScript& seq, const TransportPosition& pos, uint32_
 		if( this_tick == 0 ) {
 			pattern_changed = true;
 		}
-		pat_grp = pSong->pattern_group_index_for_bar(pos.bar);
-		patterns = pSong->get_pattern_group_vector()->at(pat_grp);
-
-		for( k=0 ; unsigned(k) < patterns->get_size() ; ++k ) {
-			for( n = patterns->get(k)->note_map.begin() ;
-			     n != patterns->get(k)->note_map.end() ;
-			     ++n ) {
-				if( n->first != this_tick ) continue;
-				pNote = n->second;
-				ev.frame = cur.frame - pos.frame;
-				ev.type = SeqEvent::NOTE_ON;
-				ev.note = *pNote;
-				if( pNote->get_length() < 0 ) {
-					length = default_note_length;
-				} else {
-					length = unsigned(pNote->get_length()) * cur.frames_per_tick();
-				}
-				seq.insert_note(ev, length);
+		bar_ticks = cur.beats_per_bar * cur.ticks_per_beat;
+		next_tick = bar_ticks;
+		if( cur.bar < 1 || cur.bar > song->bars.size() ) {
+			break; // Past the end of the song.
+		}
+		const Snapshot::bar_t& events = song->bars[cur.bar - 1];
+
+		n_end = events.end();
+		n = std::lower_bound(events.begin(), n_end, this_tick, event_before_tick);
+		for( ; (n != n_end) && (n->tick == this_tick) ; ++n ) {
+			ev = n->event;
+			ev.frame = cur.frame - pos.frame;
+			if( n->length < 0 ) {
+				length = default_note_length;
+			} else {
+				length = unsigned(n->length) * cur.frames_per_tick();
 			}
+			seq.insert_note(ev, length);
+		}
+		if( (n != n_end) && (n->tick < next_tick) ) {
+			next_tick = n->tick;
 		}
-		++cur;
+		cur += next_tick - this_tick;
 	}
 
+	m_reader.leave();
 	return 0;
 }
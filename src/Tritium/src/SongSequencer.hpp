@@ -22,29 +22,70 @@
 #define TRITIUM_SONGSEQUENCER_HPP
 
 #include <stdint.h>
+#include <vector>
 #include <QtCore/QMutex>
+#include <QtCore/QAtomicInt>
 #include <Tritium/memory.hpp>
+#include <Tritium/SeqEvent.hpp>
+#include "RtSnapshot.hpp"
 
 namespace Tritium
 {
 
 class Song;
+class SongTimeline;
 struct TransportPosition;
 class SeqScript;
 
+/**
+ * \brief Plays the song's patterns into the SeqScript.
+ *
+ * process() (the audio thread) never reads the Song or its
+ * Patterns.  It reads a Snapshot: a copy of the notes of each bar,
+ * published with an atomic pointer swap.  set_current_song() and
+ * update() build a new one when the song changes, and the old one
+ * is freed outside of the audio thread once process() is done with
+ * it.  Editing the song never blocks process().
+ */
 class SongSequencer
 {
 public:
+    /// What process() plays.  Never changed after it is published.
+    struct Snapshot
+    {
+	struct Event
+	{
+	    uint32_t tick;
+	    int length;      // In ticks, or -1
+	    SeqEvent event;  // NOTE_ON, ready to play
+	};
+	typedef std::vector<Event> bar_t;  // Sorted by tick
+	std::vector<bar_t> bars;           // bars[0] is bar 1
+	T<SongTimeline>::shared_ptr timeline;
+    };
 
     SongSequencer();
     ~SongSequencer();
 
     void set_current_song(T<Song>::shared_ptr pSong);
+    /// Publish the song again if it changed since the last time
+    /// (see Song::get_revision()).  Returns true if it did.
+    bool update();
+    /// The song changed since it was last published.
+    bool stale();
     int process(SeqScript& seq, const TransportPosition& pos, uint32_t nframes, bool& pattern_changed);
+    /// The timeline of the published snapshot.  Not for the audio
+    /// thread.
+    T<SongTimeline>::shared_ptr timeline();
 
 private:
-    QMutex m_mutex;
+    void publish();  // Call with m_mutex locked.
+
+    QMutex m_mutex;                  // Writers
     T<Song>::shared_ptr m_pSong;
+    QAtomicInt m_nRevision;          // Song revision of the last snapshot
+    RtReader m_reader;               // process()
+    RtSnapshot<Snapshot> m_snapshot;
 };  // class SongSequencer
 
 } // namespace Tritium
@@ -0,0 +1,103 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "SongTimeline.hpp"
+
+#include <Tritium/Pattern.hpp>
+#include <algorithm>
+
+using namespace Tritium;
+
+/**
+ * Each bar is as long as its longest pattern.
+ */
+SongTimeline::SongTimeline(const Song::pattern_group_t& groups,
+			   float bpm,
+			   unsigned resolution) :
+    _bpm(bpm),
+    _resolution(resolution)
+{
+    size_t bars = groups.size();
+    _bar_start.resize(bars + 1);
+    _bar_start[0] = 0;
+    uint32_t j, tmp, max_ticks;
+    for( size_t k = 0 ; k < bars ; ++k ) {
+	T<PatternList>::shared_ptr list = groups[k];
+	max_ticks = 0;
+	for( j = 0 ; j < list->get_size() ; ++j ) {
+	    tmp = list->get(j)->get_length();
+	    if( tmp > max_ticks ) {
+		max_ticks = tmp;
+	    }
+	}
+	_bar_start[k+1] = _bar_start[k] + max_ticks;
+    }
+
+    TempoSegment seg;
+    seg.tick = 0;
+    seg.seconds = 0.0;
+    seg.sec_per_tick = 60.0 / double(bpm) / double(resolution);
+    _tempo_map.assign(1, seg);
+}
+
+uint32_t SongTimeline::bar_for_absolute_tick(uint32_t abs_tick) const
+{
+    if( _bar_start.size() < 2 ) return -1;
+
+    // The first bar that ends after abs_tick.
+    std::vector<uint32_t>::const_iterator end;
+    end = std::upper_bound(_bar_start.begin() + 1, _bar_start.end(), abs_tick);
+    return end - _bar_start.begin();
+}
+
+uint32_t SongTimeline::bar_start_tick(uint32_t bar) const
+{
+    if( bar > bar_count() ) return -1;
+    if( bar < 1 ) return 0;
+    return _bar_start[bar-1];
+}
+
+uint32_t SongTimeline::ticks_in_bar(uint32_t bar) const
+{
+    if( bar < 1 ) return -1;
+    if( bar > bar_count() ) return -1;
+    return _bar_start[bar] - _bar_start[bar-1];
+}
+
+double SongTimeline::frame_for_tick(double abs_tick, uint32_t frame_rate) const
+{
+    std::vector<TempoSegment>::const_iterator seg;
+    seg = _tempo_map.end() - 1;
+    while( (seg != _tempo_map.begin()) && (abs_tick < seg->tick) ) --seg;
+
+    double sec = seg->seconds + (abs_tick - seg->tick) * seg->sec_per_tick;
+    return sec * frame_rate;
+}
+
+double SongTimeline::tick_for_frame(double frame, uint32_t frame_rate) const
+{
+    double sec = frame / frame_rate;
+    std::vector<TempoSegment>::const_iterator seg;
+    seg = _tempo_map.end() - 1;
+    while( (seg != _tempo_map.begin()) && (sec < seg->seconds) ) --seg;
+
+    return seg->tick + (sec - seg->seconds) / seg->sec_per_tick;
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+#ifndef TRITIUM_SONGTIMELINE_HPP
+#define TRITIUM_SONGTIMELINE_HPP
+
+#include <Tritium/Song.hpp>
+#include <vector>
+#include <stdint.h>
+
+namespace Tritium
+{
+    /**
+     * \brief Where the bars of a song start, and its tempo.
+     *
+     * Built from the pattern groups by the thread that changes the
+     * song (see Song::invalidate_timeline()) and never changed
+     * after that.  The lookups are const: they don't lock or
+     * allocate, so the audio thread may use a published timeline
+     * (see SongSequencer::Snapshot).
+     */
+    class SongTimeline
+    {
+    public:
+	SongTimeline(const Song::pattern_group_t& groups,
+		     float bpm,
+		     unsigned resolution);
+
+	uint32_t bar_count() const {
+	    return _bar_start.size() - 1;
+	}
+	uint32_t tick_count() const {
+	    return _bar_start.back();
+	}
+	float bpm() const {
+	    return _bpm;
+	}
+	unsigned resolution() const {
+	    return _resolution;
+	}
+
+	// Same as the Song methods of the same name.
+	uint32_t bar_for_absolute_tick(uint32_t abs_tick) const;
+	uint32_t bar_start_tick(uint32_t bar) const;
+	uint32_t ticks_in_bar(uint32_t bar) const;
+	double frame_for_tick(double abs_tick, uint32_t frame_rate) const;
+	double tick_for_frame(double frame, uint32_t frame_rate) const;
+
+    private:
+	/**
+	 * A stretch of the song with a constant tempo.  There is only
+	 * one segment (the song's bpm) until we have a tempo map.
+	 */
+	struct TempoSegment
+	{
+	    uint32_t tick;        ///< First tick of the segment
+	    double seconds;       ///< Time at 'tick'
+	    double sec_per_tick;
+	};
+
+	// _bar_start[k] is the absolute tick where bar k+1 starts and
+	// _bar_start.back() is the length of the song.
+	std::vector<uint32_t> _bar_start;
+	std::vector<TempoSegment> _tempo_map;
+	float _bpm;
+	unsigned _resolution;
+    };
+
+} // namespace Tritium
+
+#endif // TRITIUM_SONGTIMELINE_HPP
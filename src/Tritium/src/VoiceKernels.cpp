@@ -0,0 +1,761 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "VoiceKernels.hpp"
+
+/* The SIMD kernels are compiled with per-function target
+ * attributes, so that the rest of the library does not need
+ * -msse2/-mavx2 and the binary still runs on older CPUs.  This
+ * needs GCC 4.9 or later (or clang).
+ */
+#if (defined(__i386__) || defined(__x86_64__)) \
+    && (defined(__clang__) \
+	|| (defined(__GNUC__) \
+	    && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))))
+#define TRITIUM_VOICEKERNELS_X86
+#include <immintrin.h>
+#endif
+
+namespace Tritium
+{
+namespace VoiceKernels
+{
+
+typedef void (*mix_fn_t)(const float*, const float*, const float*,
+			 float, float, float*, float*, uint32_t,
+			 float&, float&);
+
+// Frames [k, nframes) of pan_mix().  The gain at frame k is
+// g0 + step * (k+1).
+typedef void (*pan_mix_fn_t)(const float*, const float*,
+			     const float*, const float*,
+			     float*, float*, uint32_t, uint32_t, bool);
+
+// Frames [k, nframes) of clip_peak().
+typedef float (*clip_peak_fn_t)(float*, uint32_t, uint32_t, float);
+
+// low_pass() with per-frame coefficient steps (0 if constant).
+typedef void (*low_pass_fn_t)(float*, uint32_t, float*, float*,
+			      const float*, const float*,
+			      const float*, const float*);
+
+void mix_scalar(const float* src_L,
+		const float* src_R,
+		const float* env,
+		float gain_L,
+		float gain_R,
+		float* dst_L,
+		float* dst_R,
+		uint32_t nframes,
+		float& peak_L,
+		float& peak_R)
+{
+    float pk_L = peak_L, pk_R = peak_R;
+    float v_L, v_R;
+    uint32_t k;
+
+    if(env) {
+	for( k=0 ; k<nframes ; ++k ) {
+	    v_L = src_L[k] * env[k] * gain_L;
+	    v_R = src_R[k] * env[k] * gain_R;
+	    if( v_L > pk_L ) pk_L = v_L;
+	    if( v_R > pk_R ) pk_R = v_R;
+	    dst_L[k] += v_L;
+	    dst_R[k] += v_R;
+	}
+    } else {
+	for( k=0 ; k<nframes ; ++k ) {
+	    v_L = src_L[k] * gain_L;
+	    v_R = src_R[k] * gain_R;
+	    if( v_L > pk_L ) pk_L = v_L;
+	    if( v_R > pk_R ) pk_R = v_R;
+	    dst_L[k] += v_L;
+	    dst_R[k] += v_R;
+	}
+    }
+    peak_L = pk_L;
+    peak_R = pk_R;
+}
+
+static bool is_ramp(const float step[4])
+{
+    return step[0] != 0.0f || step[1] != 0.0f
+	|| step[2] != 0.0f || step[3] != 0.0f;
+}
+
+static void pan_mix_scalar(const float* src_L,
+			   const float* src_R,
+			   const float g0[4],
+			   const float step[4],
+			   float* dst_L,
+			   float* dst_R,
+			   uint32_t k,
+			   uint32_t nframes,
+			   bool overwrite)
+{
+    const bool ramp = is_ramp(step);
+    float g[4] = { g0[0], g0[1], g0[2], g0[3] };
+    float n, v_L, v_R;
+    int j;
+
+    for( ; k<nframes ; ++k ) {
+	if(ramp) {
+	    n = float(k + 1);
+	    for( j=0 ; j<4 ; ++j ) {
+		g[j] = g0[j] + step[j] * n;
+	    }
+	}
+	v_L = src_L[k] * g[PAN_LL];
+	v_R = src_L[k] * g[PAN_LR];
+	if(!overwrite) {
+	    v_L = dst_L[k] + v_L;
+	    v_R = dst_R[k] + v_R;
+	}
+	if(src_R) {
+	    v_L = v_L + src_R[k] * g[PAN_RL];
+	    v_R = v_R + src_R[k] * g[PAN_RR];
+	}
+	dst_L[k] = v_L;
+	dst_R[k] = v_R;
+    }
+}
+
+static float clip_peak_scalar(float* buf, uint32_t k, uint32_t nframes, float peak)
+{
+    float v, a;
+    for( ; k<nframes ; ++k ) {
+	v = buf[k];
+	if( v > 1.0f ) {
+	    v = 1.0f;
+	} else if( v < -1.0f ) {
+	    v = -1.0f;
+	}
+	buf[k] = v;
+	a = (v < 0.0f) ? -v : v;
+	if( a > peak ) peak = a;
+    }
+    return peak;
+}
+
+static bool is_ramp(const float* step, int n)
+{
+    for( int j=0 ; j<n ; ++j ) {
+	if( step[j] != 0.0f ) return true;
+    }
+    return false;
+}
+
+static void low_pass_scalar(float* x,
+			    uint32_t nframes,
+			    float* bp,
+			    float* lp,
+			    const float* cut0,
+			    const float* dcut,
+			    const float* res0,
+			    const float* dres)
+{
+    const bool ramp = is_ramp(dcut, FILTER_LANES) || is_ramp(dres, FILTER_LANES);
+    float b[FILTER_LANES], l[FILTER_LANES];
+    float c[FILTER_LANES], r[FILTER_LANES];
+    float n;
+    uint32_t k;
+    int j;
+
+    for( j=0 ; j<FILTER_LANES ; ++j ) {
+	b[j] = bp[j];
+	l[j] = lp[j];
+	c[j] = cut0[j];
+	r[j] = res0[j];
+    }
+    for( k=0 ; k<nframes ; ++k, x += FILTER_LANES ) {
+	if(ramp) {
+	    n = float(k + 1);
+	    for( j=0 ; j<FILTER_LANES ; ++j ) {
+		c[j] = cut0[j] + dcut[j] * n;
+		r[j] = res0[j] + dres[j] * n;
+	    }
+	}
+	for( j=0 ; j<FILTER_LANES ; ++j ) {
+	    b[j] = r[j] * b[j] + c[j] * (x[j] - l[j]);
+	    l[j] += c[j] * b[j];
+	    x[j] = l[j];
+	}
+    }
+    for( j=0 ; j<FILTER_LANES ; ++j ) {
+	bp[j] = b[j];
+	lp[j] = l[j];
+    }
+}
+
+#ifdef TRITIUM_VOICEKERNELS_X86
+
+__attribute__((target("sse2")))
+static void mix_sse2(const float* src_L,
+		     const float* src_R,
+		     const float* env,
+		     float gain_L,
+		     float gain_R,
+		     float* dst_L,
+		     float* dst_R,
+		     uint32_t nframes,
+		     float& peak_L,
+		     float& peak_R)
+{
+    const __m128 g_L = _mm_set1_ps(gain_L);
+    const __m128 g_R = _mm_set1_ps(gain_R);
+    __m128 pk_L = _mm_set1_ps(peak_L);
+    __m128 pk_R = _mm_set1_ps(peak_R);
+    __m128 v_L, v_R, e;
+    uint32_t k = 0;
+
+    for( ; k+4 <= nframes ; k += 4 ) {
+	v_L = _mm_loadu_ps(src_L + k);
+	v_R = _mm_loadu_ps(src_R + k);
+	if(env) {
+	    e = _mm_loadu_ps(env + k);
+	    v_L = _mm_mul_ps(v_L, e);
+	    v_R = _mm_mul_ps(v_R, e);
+	}
+	v_L = _mm_mul_ps(v_L, g_L);
+	v_R = _mm_mul_ps(v_R, g_R);
+	pk_L = _mm_max_ps(pk_L, v_L);
+	pk_R = _mm_max_ps(pk_R, v_R);
+	_mm_storeu_ps(dst_L + k, _mm_add_ps(_mm_loadu_ps(dst_L + k), v_L));
+	_mm_storeu_ps(dst_R + k, _mm_add_ps(_mm_loadu_ps(dst_R + k), v_R));
+    }
+
+    float tmp_L[4], tmp_R[4];
+    _mm_storeu_ps(tmp_L, pk_L);
+    _mm_storeu_ps(tmp_R, pk_R);
+    for( int j=0 ; j<4 ; ++j ) {
+	if( tmp_L[j] > peak_L ) peak_L = tmp_L[j];
+	if( tmp_R[j] > peak_R ) peak_R = tmp_R[j];
+    }
+
+    if( k < nframes ) {
+	mix_scalar( src_L + k, src_R + k, (env) ? (env + k) : 0,
+		    gain_L, gain_R, dst_L + k, dst_R + k,
+		    nframes - k, peak_L, peak_R );
+    }
+}
+
+__attribute__((target("sse2")))
+static void pan_mix_sse2(const float* src_L,
+			 const float* src_R,
+			 const float g0[4],
+			 const float step[4],
+			 float* dst_L,
+			 float* dst_R,
+			 uint32_t k,
+			 uint32_t nframes,
+			 bool overwrite)
+{
+    const bool ramp = is_ramp(step);
+    const __m128 g0_LL = _mm_set1_ps(g0[PAN_LL]);
+    const __m128 g0_LR = _mm_set1_ps(g0[PAN_LR]);
+    const __m128 g0_RL = _mm_set1_ps(g0[PAN_RL]);
+    const __m128 g0_RR = _mm_set1_ps(g0[PAN_RR]);
+    const __m128 s_LL = _mm_set1_ps(step[PAN_LL]);
+    const __m128 s_LR = _mm_set1_ps(step[PAN_LR]);
+    const __m128 s_RL = _mm_set1_ps(step[PAN_RL]);
+    const __m128 s_RR = _mm_set1_ps(step[PAN_RR]);
+    const __m128 four = _mm_set1_ps(4.0f);
+    __m128 g_LL = g0_LL, g_LR = g0_LR, g_RL = g0_RL, g_RR = g0_RR;
+    __m128 n = _mm_setr_ps(float(k + 1), float(k + 2), float(k + 3), float(k + 4));
+    __m128 x, v_L, v_R;
+
+    for( ; k+4 <= nframes ; k += 4 ) {
+	if(ramp) {
+	    g_LL = _mm_add_ps(g0_LL, _mm_mul_ps(s_LL, n));
+	    g_LR = _mm_add_ps(g0_LR, _mm_mul_ps(s_LR, n));
+	    g_RL = _mm_add_ps(g0_RL, _mm_mul_ps(s_RL, n));
+	    g_RR = _mm_add_ps(g0_RR, _mm_mul_ps(s_RR, n));
+	    n = _mm_add_ps(n, four);
+	}
+	x = _mm_loadu_ps(src_L + k);
+	v_L = _mm_mul_ps(x, g_LL);
+	v_R = _mm_mul_ps(x, g_LR);
+	if(!overwrite) {
+	    v_L = _mm_add_ps(_mm_loadu_ps(dst_L + k), v_L);
+	    v_R = _mm_add_ps(_mm_loadu_ps(dst_R + k), v_R);
+	}
+	if(src_R) {
+	    x = _mm_loadu_ps(src_R + k);
+	    v_L = _mm_add_ps(v_L, _mm_mul_ps(x, g_RL));
+	    v_R = _mm_add_ps(v_R, _mm_mul_ps(x, g_RR));
+	}
+	_mm_storeu_ps(dst_L + k, v_L);
+	_mm_storeu_ps(dst_R + k, v_R);
+    }
+
+    if( k < nframes ) {
+	pan_mix_scalar( src_L, src_R, g0, step, dst_L, dst_R,
+			k, nframes, overwrite );
+    }
+}
+
+__attribute__((target("sse2")))
+static float clip_peak_sse2(float* buf, uint32_t k, uint32_t nframes, float peak)
+{
+    const __m128 hi = _mm_set1_ps(1.0f);
+    const __m128 lo = _mm_set1_ps(-1.0f);
+    const __m128 sign = _mm_set1_ps(-0.0f);
+    __m128 pk = _mm_set1_ps(peak);
+    __m128 v;
+
+    for( ; k+4 <= nframes ; k += 4 ) {
+	v = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(buf + k), lo), hi);
+	_mm_storeu_ps(buf + k, v);
+	pk = _mm_max_ps(pk, _mm_andnot_ps(sign, v));
+    }
+
+    float tmp[4];
+    _mm_storeu_ps(tmp, pk);
+    for( int j=0 ; j<4 ; ++j ) {
+	if( tmp[j] > peak ) peak = tmp[j];
+    }
+
+    return clip_peak_scalar(buf, k, nframes, peak);
+}
+
+// The two halves of the lanes are separate vectors.
+__attribute__((target("sse2")))
+static void low_pass_sse2(float* x,
+			  uint32_t nframes,
+			  float* bp,
+			  float* lp,
+			  const float* cut0,
+			  const float* dcut,
+			  const float* res0,
+			  const float* dres)
+{
+    const bool ramp = is_ramp(dcut, FILTER_LANES) || is_ramp(dres, FILTER_LANES);
+    const __m128 c0_a = _mm_loadu_ps(cut0), c0_b = _mm_loadu_ps(cut0 + 4);
+    const __m128 dc_a = _mm_loadu_ps(dcut), dc_b = _mm_loadu_ps(dcut + 4);
+    const __m128 r0_a = _mm_loadu_ps(res0), r0_b = _mm_loadu_ps(res0 + 4);
+    const __m128 dr_a = _mm_loadu_ps(dres), dr_b = _mm_loadu_ps(dres + 4);
+    __m128 b_a = _mm_loadu_ps(bp), b_b = _mm_loadu_ps(bp + 4);
+    __m128 l_a = _mm_loadu_ps(lp), l_b = _mm_loadu_ps(lp + 4);
+    __m128 c_a = c0_a, c_b = c0_b, r_a = r0_a, r_b = r0_b;
+    __m128 n;
+    uint32_t k;
+
+    for( k=0 ; k<nframes ; ++k, x += FILTER_LANES ) {
+	if(ramp) {
+	    n = _mm_set1_ps(float(k + 1));
+	    c_a = _mm_add_ps(c0_a, _mm_mul_ps(dc_a, n));
+	    c_b = _mm_add_ps(c0_b, _mm_mul_ps(dc_b, n));
+	    r_a = _mm_add_ps(r0_a, _mm_mul_ps(dr_a, n));
+	    r_b = _mm_add_ps(r0_b, _mm_mul_ps(dr_b, n));
+	}
+	b_a = _mm_add_ps(_mm_mul_ps(r_a, b_a),
+			 _mm_mul_ps(c_a, _mm_sub_ps(_mm_loadu_ps(x), l_a)));
+	b_b = _mm_add_ps(_mm_mul_ps(r_b, b_b),
+			 _mm_mul_ps(c_b, _mm_sub_ps(_mm_loadu_ps(x + 4), l_b)));
+	l_a = _mm_add_ps(l_a, _mm_mul_ps(c_a, b_a));
+	l_b = _mm_add_ps(l_b, _mm_mul_ps(c_b, b_b));
+	_mm_storeu_ps(x, l_a);
+	_mm_storeu_ps(x + 4, l_b);
+    }
+    _mm_storeu_ps(bp, b_a);
+    _mm_storeu_ps(bp + 4, b_b);
+    _mm_storeu_ps(lp, l_a);
+    _mm_storeu_ps(lp + 4, l_b);
+}
+
+__attribute__((target("avx2")))
+static void mix_avx2(const float* src_L,
+		     const float* src_R,
+		     const float* env,
+		     float gain_L,
+		     float gain_R,
+		     float* dst_L,
+		     float* dst_R,
+		     uint32_t nframes,
+		     float& peak_L,
+		     float& peak_R)
+{
+    const __m256 g_L = _mm256_set1_ps(gain_L);
+    const __m256 g_R = _mm256_set1_ps(gain_R);
+    __m256 pk_L = _mm256_set1_ps(peak_L);
+    __m256 pk_R = _mm256_set1_ps(peak_R);
+    __m256 v_L, v_R, e;
+    uint32_t k = 0;
+
+    for( ; k+8 <= nframes ; k += 8 ) {
+	v_L = _mm256_loadu_ps(src_L + k);
+	v_R = _mm256_loadu_ps(src_R + k);
+	if(env) {
+	    e = _mm256_loadu_ps(env + k);
+	    v_L = _mm256_mul_ps(v_L, e);
+	    v_R = _mm256_mul_ps(v_R, e);
+	}
+	v_L = _mm256_mul_ps(v_L, g_L);
+	v_R = _mm256_mul_ps(v_R, g_R);
+	pk_L = _mm256_max_ps(pk_L, v_L);
+	pk_R = _mm256_max_ps(pk_R, v_R);
+	_mm256_storeu_ps(dst_L + k, _mm256_add_ps(_mm256_loadu_ps(dst_L + k), v_L));
+	_mm256_storeu_ps(dst_R + k, _mm256_add_ps(_mm256_loadu_ps(dst_R + k), v_R));
+    }
+
+    float tmp_L[8], tmp_R[8];
+    _mm256_storeu_ps(tmp_L, pk_L);
+    _mm256_storeu_ps(tmp_R, pk_R);
+    _mm256_zeroupper();
+    for( int j=0 ; j<8 ; ++j ) {
+	if( tmp_L[j] > peak_L ) peak_L = tmp_L[j];
+	if( tmp_R[j] > peak_R ) peak_R = tmp_R[j];
+    }
+
+    if( k < nframes ) {
+	mix_sse2( src_L + k, src_R + k, (env) ? (env + k) : 0,
+		  gain_L, gain_R, dst_L + k, dst_R + k,
+		  nframes - k, peak_L, peak_R );
+    }
+}
+
+__attribute__((target("avx2")))
+static void pan_mix_avx2(const float* src_L,
+			 const float* src_R,
+			 const float g0[4],
+			 const float step[4],
+			 float* dst_L,
+			 float* dst_R,
+			 uint32_t k,
+			 uint32_t nframes,
+			 bool overwrite)
+{
+    const bool ramp = is_ramp(step);
+    const __m256 g0_LL = _mm256_set1_ps(g0[PAN_LL]);
+    const __m256 g0_LR = _mm256_set1_ps(g0[PAN_LR]);
+    const __m256 g0_RL = _mm256_set1_ps(g0[PAN_RL]);
+    const __m256 g0_RR = _mm256_set1_ps(g0[PAN_RR]);
+    const __m256 s_LL = _mm256_set1_ps(step[PAN_LL]);
+    const __m256 s_LR = _mm256_set1_ps(step[PAN_LR]);
+    const __m256 s_RL = _mm256_set1_ps(step[PAN_RL]);
+    const __m256 s_RR = _mm256_set1_ps(step[PAN_RR]);
+    const __m256 eight = _mm256_set1_ps(8.0f);
+    __m256 g_LL = g0_LL, g_LR = g0_LR, g_RL = g0_RL, g_RR = g0_RR;
+    __m256 n = _mm256_setr_ps(float(k + 1), float(k + 2), float(k + 3), float(k + 4),
+			      float(k + 5), float(k + 6), float(k + 7), float(k + 8));
+    __m256 x, v_L, v_R;
+
+    for( ; k+8 <= nframes ; k += 8 ) {
+	if(ramp) {
+	    g_LL = _mm256_add_ps(g0_LL, _mm256_mul_ps(s_LL, n));
+	    g_LR = _mm256_add_ps(g0_LR, _mm256_mul_ps(s_LR, n));
+	    g_RL = _mm256_add_ps(g0_RL, _mm256_mul_ps(s_RL, n));
+	    g_RR = _mm256_add_ps(g0_RR, _mm256_mul_ps(s_RR, n));
+	    n = _mm256_add_ps(n, eight);
+	}
+	x = _mm256_loadu_ps(src_L + k);
+	v_L = _mm256_mul_ps(x, g_LL);
+	v_R = _mm256_mul_ps(x, g_LR);
+	if(!overwrite) {
+	    v_L = _mm256_add_ps(_mm256_loadu_ps(dst_L + k), v_L);
+	    v_R = _mm256_add_ps(_mm256_loadu_ps(dst_R + k), v_R);
+	}
+	if(src_R) {
+	    x = _mm256_loadu_ps(src_R + k);
+	    v_L = _mm256_add_ps(v_L, _mm256_mul_ps(x, g_RL));
+	    v_R = _mm256_add_ps(v_R, _mm256_mul_ps(x, g_RR));
+	}
+	_mm256_storeu_ps(dst_L + k, v_L);
+	_mm256_storeu_ps(dst_R + k, v_R);
+    }
+    _mm256_zeroupper();
+
+    if( k < nframes ) {
+	pan_mix_sse2( src_L, src_R, g0, step, dst_L, dst_R,
+		      k, nframes, overwrite );
+    }
+}
+
+__attribute__((target("avx2")))
+static float clip_peak_avx2(float* buf, uint32_t k, uint32_t nframes, float peak)
+{
+    const __m256 hi = _mm256_set1_ps(1.0f);
+    const __m256 lo = _mm256_set1_ps(-1.0f);
+    const __m256 sign = _mm256_set1_ps(-0.0f);
+    __m256 pk = _mm256_set1_ps(peak);
+    __m256 v;
+
+    for( ; k+8 <= nframes ; k += 8 ) {
+	v = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(buf + k), lo), hi);
+	_mm256_storeu_ps(buf + k, v);
+	pk = _mm256_max_ps(pk, _mm256_andnot_ps(sign, v));
+    }
+
+    float tmp[8];
+    _mm256_storeu_ps(tmp, pk);
+    _mm256_zeroupper();
+    for( int j=0 ; j<8 ; ++j ) {
+	if( tmp[j] > peak ) peak = tmp[j];
+    }
+
+    return clip_peak_sse2(buf, k, nframes, peak);
+}
+
+__attribute__((target("avx2")))
+static void low_pass_avx2(float* x,
+			  uint32_t nframes,
+			  float* bp,
+			  float* lp,
+			  const float* cut0,
+			  const float* dcut,
+			  const float* res0,
+			  const float* dres)
+{
+    const bool ramp = is_ramp(dcut, FILTER_LANES) || is_ramp(dres, FILTER_LANES);
+    const __m256 c0 = _mm256_loadu_ps(cut0);
+    const __m256 dc = _mm256_loadu_ps(dcut);
+    const __m256 r0 = _mm256_loadu_ps(res0);
+    const __m256 dr = _mm256_loadu_ps(dres);
+    __m256 b = _mm256_loadu_ps(bp);
+    __m256 l = _mm256_loadu_ps(lp);
+    __m256 c = c0, r = r0;
+    __m256 n;
+    uint32_t k;
+
+    for( k=0 ; k<nframes ; ++k, x += FILTER_LANES ) {
+	if(ramp) {
+	    n = _mm256_set1_ps(float(k + 1));
+	    c = _mm256_add_ps(c0, _mm256_mul_ps(dc, n));
+	    r = _mm256_add_ps(r0, _mm256_mul_ps(dr, n));
+	}
+	b = _mm256_add_ps(_mm256_mul_ps(r, b),
+			  _mm256_mul_ps(c, _mm256_sub_ps(_mm256_loadu_ps(x), l)));
+	l = _mm256_add_ps(l, _mm256_mul_ps(c, b));
+	_mm256_storeu_ps(x, l);
+    }
+    _mm256_storeu_ps(bp, b);
+    _mm256_storeu_ps(lp, l);
+}
+
+// Flush denormals to zero (MXCSR.FTZ) while a filter runs.
+// Returns the previous MXCSR.
+__attribute__((target("sse2")))
+static unsigned denormals_off()
+{
+    unsigned csr = _mm_getcsr();
+    _mm_setcsr(csr | 0x8000);
+    return csr;
+}
+
+__attribute__((target("sse2")))
+static void denormals_restore(unsigned csr)
+{
+    _mm_setcsr(csr);
+}
+
+#endif // TRITIUM_VOICEKERNELS_X86
+
+static isa_t detect()
+{
+#ifdef TRITIUM_VOICEKERNELS_X86
+    __builtin_cpu_init();
+    if( __builtin_cpu_supports("avx2") ) return AVX2;
+    if( __builtin_cpu_supports("sse2") ) return SSE2;
+#endif
+    return Scalar;
+}
+
+static mix_fn_t mix_for(isa_t i)
+{
+    switch(i) {
+#ifdef TRITIUM_VOICEKERNELS_X86
+    case AVX2: return mix_avx2;
+    case SSE2: return mix_sse2;
+#endif
+    default: return mix_scalar;
+    }
+}
+
+static pan_mix_fn_t pan_mix_for(isa_t i)
+{
+    switch(i) {
+#ifdef TRITIUM_VOICEKERNELS_X86
+    case AVX2: return pan_mix_avx2;
+    case SSE2: return pan_mix_sse2;
+#endif
+    default: return pan_mix_scalar;
+    }
+}
+
+static clip_peak_fn_t clip_peak_for(isa_t i)
+{
+    switch(i) {
+#ifdef TRITIUM_VOICEKERNELS_X86
+    case AVX2: return clip_peak_avx2;
+    case SSE2: return clip_peak_sse2;
+#endif
+    default: return clip_peak_scalar;
+    }
+}
+
+static low_pass_fn_t low_pass_for(isa_t i)
+{
+    switch(i) {
+#ifdef TRITIUM_VOICEKERNELS_X86
+    case AVX2: return low_pass_avx2;
+    case SSE2: return low_pass_sse2;
+#endif
+    default: return low_pass_scalar;
+    }
+}
+
+// These are set when the library is loaded, before any audio
+// thread exists.
+static const isa_t g_detected_isa = detect();
+static isa_t g_isa = g_detected_isa;
+static mix_fn_t g_mix = mix_for(g_detected_isa);
+static pan_mix_fn_t g_pan_mix = pan_mix_for(g_detected_isa);
+static clip_peak_fn_t g_clip_peak = clip_peak_for(g_detected_isa);
+static low_pass_fn_t g_low_pass = low_pass_for(g_detected_isa);
+
+isa_t detected_isa()
+{
+    return g_detected_isa;
+}
+
+isa_t isa()
+{
+    return g_isa;
+}
+
+isa_t set_isa(isa_t i)
+{
+    if( i > g_detected_isa ) i = g_detected_isa;
+    g_isa = i;
+    g_mix = mix_for(i);
+    g_pan_mix = pan_mix_for(i);
+    g_clip_peak = clip_peak_for(i);
+    g_low_pass = low_pass_for(i);
+    return i;
+}
+
+const char* isa_name(isa_t i)
+{
+    switch(i) {
+    case Scalar: return "scalar";
+    case SSE2: return "sse2";
+    case AVX2: return "avx2";
+    }
+    return "unknown";
+}
+
+void mix(const float* src_L,
+	 const float* src_R,
+	 const float* env,
+	 float gain_L,
+	 float gain_R,
+	 float* dst_L,
+	 float* dst_R,
+	 uint32_t nframes,
+	 float& peak_L,
+	 float& peak_R)
+{
+    g_mix(src_L, src_R, env, gain_L, gain_R, dst_L, dst_R,
+	  nframes, peak_L, peak_R);
+}
+
+void pan_mix(const float* src_L,
+	     const float* src_R,
+	     const float from[4],
+	     const float to[4],
+	     float* dst_L,
+	     float* dst_R,
+	     uint32_t nframes,
+	     bool overwrite)
+{
+    if( nframes == 0 ) return;
+    float step[4];
+    for( int j=0 ; j<4 ; ++j ) {
+	step[j] = (to[j] - from[j]) / float(nframes);
+    }
+    g_pan_mix(src_L, src_R, from, step, dst_L, dst_R,
+	      0, nframes, overwrite);
+}
+
+float clip_peak(float* buf, uint32_t nframes)
+{
+    return g_clip_peak(buf, 0, nframes, 0.0f);
+}
+
+void low_pass(float* x,
+	      uint32_t nframes,
+	      float bp[FILTER_LANES],
+	      float lp[FILTER_LANES],
+	      const float from_cut[FILTER_LANES],
+	      const float to_cut[FILTER_LANES],
+	      const float from_res[FILTER_LANES],
+	      const float to_res[FILTER_LANES])
+{
+    if( nframes == 0 ) return;
+    float dcut[FILTER_LANES], dres[FILTER_LANES];
+    for( int j=0 ; j<FILTER_LANES ; ++j ) {
+	dcut[j] = (to_cut[j] - from_cut[j]) / float(nframes);
+	dres[j] = (to_res[j] - from_res[j]) / float(nframes);
+    }
+#ifdef TRITIUM_VOICEKERNELS_X86
+    // On x86-64 the scalar kernel does its float math with SSE
+    // too, so every kernel flushes the same way.
+    if( g_detected_isa != Scalar ) {
+	unsigned csr = denormals_off();
+	g_low_pass(x, nframes, bp, lp, from_cut, dcut, from_res, dres);
+	denormals_restore(csr);
+	return;
+    }
+#endif
+    g_low_pass(x, nframes, bp, lp, from_cut, dcut, from_res, dres);
+}
+
+float interpolate(const float* data_L,
+		  const float* data_R,
+		  int data_frames,
+		  float pos,
+		  float step,
+		  float* dst_L,
+		  float* dst_R,
+		  uint32_t nframes)
+{
+    // This one stays scalar: the reads are at fractional,
+    // non-contiguous positions and a gather does not beat the
+    // plain loop for 2 taps.
+    int n;
+    float diff;
+    for( uint32_t k=0 ; k<nframes ; ++k ) {
+	n = (int)pos;
+	diff = pos - n;
+	if( (n + 1) >= data_frames ) {
+	    dst_L[k] = data_L[data_frames-1] * (1.0f - diff);
+	    dst_R[k] = data_R[data_frames-1] * (1.0f - diff);
+	} else {
+	    dst_L[k] = data_L[n] * (1.0f - diff) + data_L[n+1] * diff;
+	    dst_R[k] = data_R[n] * (1.0f - diff) + data_R[n+1] * diff;
+	}
+	pos += step;
+    }
+    return pos;
+}
+
+} // namespace VoiceKernels
+} // namespace Tritium
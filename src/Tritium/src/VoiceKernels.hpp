@@ -0,0 +1,200 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+#ifndef TRITIUM_VOICEKERNELS_HPP
+#define TRITIUM_VOICEKERNELS_HPP
+
+#include <stdint.h>
+
+namespace Tritium
+{
+    /**
+     * \brief Inner loops used by the Sampler to render a voice.
+     *
+     * The Sampler splits every note into sub-blocks (at the
+     * release offset and at most VoiceKernels::BLOCK_SIZE frames
+     * long).  The recursive parts (ADSR, resonant filter) are
+     * computed per sub-block into scratch buffers, and the
+     * gain/peak/accumulate pass is done here.
+     *
+     * The MixerImpl also uses pan_mix() and clip_peak() for its
+     * mix-down, and the FilterBank uses low_pass().
+     *
+     * Every kernel has a plain C++ implementation, which is the
+     * reference.  On x86 an SSE2 and an AVX2 version are selected
+     * at runtime according to what the CPU supports.  The SIMD
+     * versions do the same multiplies in the same order as the
+     * reference, so their output is identical.
+     */
+    namespace VoiceKernels
+    {
+	/// Maximum length of a sub-block (frames).
+	enum { BLOCK_SIZE = 256 };
+
+	typedef enum {
+	    Scalar = 0,
+	    SSE2,
+	    AVX2
+	} isa_t;
+
+	/// Best instruction set supported by this CPU (and build).
+	isa_t detected_isa();
+
+	/// Instruction set currently used by the kernels.
+	isa_t isa();
+
+	/**
+	 * Force the kernels to a specific instruction set.  If the
+	 * CPU does not support it, the best supported one below it
+	 * is used.  Returns the ISA that was actually selected.
+	 *
+	 * Not RT-safe with respect to a running process() cycle.
+	 * Intended for testing and benchmarking.
+	 */
+	isa_t set_isa(isa_t i);
+
+	const char* isa_name(isa_t i);
+
+	/**
+	 * Apply envelope and gain, accumulate into the output, and
+	 * update the peaks.  For each frame k:
+	 *
+	 *     v = src[k] * env[k] * gain
+	 *     dst[k] += v
+	 *     peak = max(peak, v)
+	 *
+	 * If env is 0, it is treated as 1.0 (i.e. the envelope has
+	 * already been applied to src).
+	 */
+	void mix(const float* src_L,
+		 const float* src_R,
+		 const float* env,
+		 float gain_L,
+		 float gain_R,
+		 float* dst_L,
+		 float* dst_R,
+		 uint32_t nframes,
+		 float& peak_L,
+		 float& peak_R);
+
+	/**
+	 * Linear interpolation of a stereo sample into dst_L/dst_R.
+	 * The position is advanced by 'step' for every frame, the
+	 * same way the Sampler always has.  Reading past the last
+	 * frame interpolates towards zero.
+	 *
+	 * Returns the position after the last frame.
+	 */
+	float interpolate(const float* data_L,
+			  const float* data_R,
+			  int data_frames,
+			  float pos,
+			  float step,
+			  float* dst_L,
+			  float* dst_R,
+			  uint32_t nframes);
+
+	/// Number of signals filtered together by low_pass().
+	enum { FILTER_LANES = 8 };
+
+	/**
+	 * Resonant low pass filter of FILTER_LANES signals at once
+	 * (in place).  x holds the signals interleaved: frame k of
+	 * lane i is x[k * FILTER_LANES + i].  For each frame k and
+	 * lane i:
+	 *
+	 *     bp[i] = res[i] * bp[i] + cut[i] * (x - lp[i])
+	 *     lp[i] += cut[i] * bp[i]
+	 *     x = lp[i]
+	 *
+	 * bp and lp are the filter state, and are updated.  The
+	 * coefficients move linearly from the 'from' to the 'to'
+	 * values over the block, like the gains of pan_mix().
+	 *
+	 * Recursive filters can't be vectorized along the time
+	 * axis, so the lanes are separate voices instead.  On x86
+	 * this runs with denormals flushed to zero, so the state of
+	 * a decaying voice doesn't slow down the CPU.
+	 */
+	void low_pass(float* x,
+		      uint32_t nframes,
+		      float bp[FILTER_LANES],
+		      float lp[FILTER_LANES],
+		      const float from_cut[FILTER_LANES],
+		      const float to_cut[FILTER_LANES],
+		      const float from_res[FILTER_LANES],
+		      const float to_res[FILTER_LANES]);
+
+	/// Index of the gains passed to pan_mix().
+	enum {
+	    PAN_LL = 0,  ///< Left input to left output
+	    PAN_LR,      ///< Left input to right output
+	    PAN_RL,      ///< Right input to left output
+	    PAN_RR       ///< Right input to right output
+	};
+
+	/**
+	 * Mix a mono or stereo input into dst_L/dst_R through a 2x2
+	 * gain matrix (indexed by PAN_LL, etc.).  For each frame k:
+	 *
+	 *     dst_L[k] += src_L[k] * g[PAN_LL] + src_R[k] * g[PAN_RL]
+	 *     dst_R[k] += src_L[k] * g[PAN_LR] + src_R[k] * g[PAN_RR]
+	 *
+	 * The gains move linearly from 'from' to 'to' over the
+	 * block, reaching 'to' on the last frame.  If from == to the
+	 * gains are constant.
+	 *
+	 * src_R may be 0 for a mono input (PAN_RL and PAN_RR are
+	 * ignored).  If 'overwrite' is set, dst is not read, which
+	 * saves clearing it for the first input.  It also lets dst
+	 * be the same buffers as src (in place).
+	 */
+	void pan_mix(const float* src_L,
+		     const float* src_R,
+		     const float from[4],
+		     const float to[4],
+		     float* dst_L,
+		     float* dst_R,
+		     uint32_t nframes,
+		     bool overwrite);
+
+	/**
+	 * Clip buf to [-1.0, 1.0] and return the peak (largest
+	 * absolute value) after clipping.
+	 */
+	float clip_peak(float* buf, uint32_t nframes);
+
+	/// Reference implementation of mix().
+	void mix_scalar(const float* src_L,
+			const float* src_R,
+			const float* env,
+			float gain_L,
+			float gain_R,
+			float* dst_L,
+			float* dst_R,
+			uint32_t nframes,
+			float& peak_L,
+			float& peak_R);
+
+    } // namespace VoiceKernels
+
+} // namespace Tritium
+
+#endif // TRITIUM_VOICEKERNELS_HPP
@@ -0,0 +1,113 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "VoicePool.hpp"
+#include <cassert>
+
+using namespace Tritium;
+
+VoicePool::VoicePool(size_t capacity) :
+    _voices(capacity),
+    _free(-1),
+    _head(-1),
+    _tail(-1),
+    _count(0),
+    _limit(capacity),
+    _serial(0)
+{
+    int k;
+    for( k = int(capacity) - 1 ; k >= 0 ; --k ) {
+	_voices[k].serial = 0;
+	_voices[k].voice.instrument = 0;
+	_voices[k].voice.velocity = 0.0f;
+	_voices[k].voice.pan_l = 0.0f;
+	_voices[k].voice.pan_r = 0.0f;
+	_voices[k].voice.pitch = 0.0f;
+	_voices[k].voice.port = 0;
+	_voices[k].voice.stream = -1;
+	_voices[k].prev = -1;
+	_voices[k].next = _free;
+	_voices[k].active = false;
+	_free = k;
+    }
+}
+
+VoicePool::~VoicePool()
+{
+}
+
+void VoicePool::set_limit(size_t limit)
+{
+    if( limit > _voices.size() ) {
+	limit = _voices.size();
+    }
+    _limit = limit;
+}
+
+int VoicePool::allocate()
+{
+    if( full() || _free == -1 ) {
+	return -1;
+    }
+
+    int v = _free;
+    Slot& slot = _voices[v];
+    _free = slot.next;
+
+    slot.active = true;
+    slot.serial = ++_serial;
+    slot.voice.stream = -1;
+    slot.prev = _tail;
+    slot.next = -1;
+    if( _tail != -1 ) {
+	_voices[_tail].next = v;
+    } else {
+	_head = v;
+    }
+    _tail = v;
+    ++_count;
+
+    return v;
+}
+
+void VoicePool::release(int v)
+{
+    assert( v >= 0 && size_t(v) < _voices.size() );
+    Slot& slot = _voices[v];
+    assert( slot.active );
+
+    if( slot.prev != -1 ) {
+	_voices[slot.prev].next = slot.next;
+    } else {
+	_head = slot.next;
+    }
+    if( slot.next != -1 ) {
+	_voices[slot.next].prev = slot.prev;
+    } else {
+	_tail = slot.prev;
+    }
+    --_count;
+
+    slot.active = false;
+    slot.prev = -1;
+    slot.next = _free;
+    _free = v;
+}
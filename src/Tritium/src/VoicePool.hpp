@@ -0,0 +1,143 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+#ifndef TRITIUM_VOICEPOOL_HPP
+#define TRITIUM_VOICEPOOL_HPP
+
+#include <Tritium/ADSR.hpp>
+#include <vector>
+#include <cstddef>
+#include <stdint.h>
+
+namespace Tritium
+{
+    class Instrument;
+
+    /**
+     * \brief Fixed-capacity storage for the Sampler's playing notes.
+     *
+     * All voices are allocated in the constructor.  After that,
+     * allocate() and release() only relink indices, so they are
+     * safe to use in the audio thread.  A voice keeps its index
+     * for as long as it is playing.
+     *
+     * The active voices are kept in a list ordered by start time
+     * (oldest first), which is the order the Sampler renders them
+     * and the order used to pick a voice to steal.
+     *
+     * The pool is not thread-safe.  It is owned by the audio
+     * thread; other threads must go through the Sampler.
+     */
+    class VoicePool
+    {
+    public:
+	/**
+	 * \brief A playing note.
+	 *
+	 * The first fields are the note as it was played.  The rest
+	 * is the playback state, which the Sampler sets up on
+	 * note-on, so that none of it has to travel in the
+	 * SeqEvent's.
+	 *
+	 * A voice holds no references, so ending one never frees
+	 * anything.  The instrument is kept alive while it is queued
+	 * (see Instrument::enqueue()).
+	 */
+	struct Voice
+	{
+	    Instrument* instrument;
+	    float velocity;
+	    float pan_l;
+	    float pan_r;
+	    float pitch;              // Key plus pitch of the note, in semitones
+	    int port;                 // Instrument port it renders to
+	    int stream;               // SampleStreamer id, or -1
+	    uint32_t silence_offset;  // Frame of this cycle that it starts at
+	    uint32_t release_offset;  // Frame to release it at, or (uint32_t)-1
+	    float sample_position;    // Place in the sample
+	    ADSR adsr;
+	};
+
+	VoicePool(size_t capacity);
+	~VoicePool();
+
+	/// Number of preallocated voices.
+	size_t capacity() const { return _voices.size(); }
+
+	/// Number of voices currently playing.
+	size_t size() const { return _count; }
+
+	/**
+	 * Maximum number of voices that may play at once
+	 * (clamped to capacity()).  Lowering the limit does not
+	 * stop any voices; the caller must release the excess.
+	 */
+	void set_limit(size_t limit);
+	size_t limit() const { return _limit; }
+
+	/// True if allocate() would fail.
+	bool full() const { return _count >= _limit; }
+
+	/**
+	 * Take a voice from the free list and append it to the end
+	 * of the active list.  Returns the voice index, or -1 if
+	 * the pool is full.  The voice is not reset, except for its
+	 * stream.
+	 */
+	int allocate();
+
+	/// Return a voice to the free list.
+	void release(int v);
+
+	Voice& voice(int v) { return _voices[v].voice; }
+	const Voice& voice(int v) const { return _voices[v].voice; }
+
+	/// Start order of the voice (larger is newer).
+	unsigned long serial(int v) const { return _voices[v].serial; }
+
+	/// SampleStreamer id used by the voice (-1 if none).
+	int& stream(int v) { return _voices[v].voice.stream; }
+
+	/// Iterate the active voices, oldest first.  -1 is the end.
+	int first() const { return _head; }
+	int next(int v) const { return _voices[v].next; }
+
+    private:
+	struct Slot
+	{
+	    Voice voice;
+	    unsigned long serial;
+	    int prev;
+	    int next;
+	    bool active;
+	};
+
+	std::vector<Slot> _voices;
+	int _free;   // Head of the free list (linked by 'next')
+	int _head;   // Oldest active voice
+	int _tail;   // Newest active voice
+	size_t _count;
+	size_t _limit;
+	unsigned long _serial;
+    };
+
+} // namespace Tritium
+
+#endif // TRITIUM_VOICEPOOL_HPP
@@ -26,10 +26,13 @@
 #include <Tritium/fx/LadspaFX.hpp>
 #include <Tritium/Logger.hpp>
 #include <Tritium/Engine.hpp>
+#include "../RtSnapshot.hpp"
+#include "LadspaIndex.hpp"
 
 #include <algorithm>
 #include <QDir>
 #include <QLibrary>
+#include <QThread>
 #include <cassert>
 
 #ifdef LRDF_SUPPORT
@@ -41,18 +44,76 @@ using namespace std;
 namespace Tritium
 {
 
+/// Checks the plugin index against the LADSPA paths.
+class Effects::Rescan : public QThread
+{
+public:
+	Rescan( const QString& sIndexFile, const std::vector<QString>& paths )
+		: m_sIndexFile( sIndexFile )
+		, m_paths( paths )
+		, changed( false ) {}
+
+	void run() {
+		LadspaIndex index( m_sIndexFile );
+		index.load();
+		changed = index.scan( m_paths );
+		if ( changed ) {
+			index.save();
+			index.getPlugins( plugins );
+		}
+	}
+
+private:
+	QString m_sIndexFile;
+	std::vector<QString> m_paths;
+
+public:
+	// Results (once it is finished)
+	bool changed;
+	std::vector<LadspaFXInfo*> plugins;
+};
+
+
+
 Effects::Effects(Engine* parent) :
 	m_engine(parent),
 	m_pRootGroup( NULL ),
-	m_pRecentGroup( NULL )
+	m_pRecentGroup( NULL ),
+	m_pRescan( NULL ),
+	m_bSuspended( false ),
+	m_pRackReader( new RtReader ),
+	m_pRack( NULL )
 {
 	assert(parent);
-	getPluginList();
+	m_pRack = new RtSnapshot<Rack>( *m_pRackReader );
+
+	// Start with the plugin index if there is one, and check it
+	// in the background.  Loading every library takes long.
+	m_sIndexFile = m_engine->get_preferences()->getDataDirectory() + "cache/ladspa.index";
+	LadspaIndex index( m_sIndexFile );
+	if ( index.load() ) {
+		index.getPlugins( m_pluginList );
+		m_pRescan = new Rescan( m_sIndexFile, m_engine->get_preferences()->getLadspaPath() );
+		m_pRescan->start( QThread::LowPriority );
+	} else {
+		scanPlugins();
+	}
+	DEBUGLOG( QString( "Loaded %1 LADSPA plugins" ).arg( m_pluginList.size() ) );
+	publishRack();
 }
 
 Effects::~Effects()
 {
 	//DEBUGLOG( "DESTROY" );
+	if ( m_pRescan != NULL ) {
+		m_pRescan->wait();
+		for ( unsigned i = 0; i < m_pRescan->plugins.size(); i++ ) {
+			delete m_pRescan->plugins[i];
+		}
+		delete m_pRescan;
+	}
+	delete m_pRack;
+	delete m_pRackReader;
 	if ( m_pRootGroup != NULL ) delete m_pRootGroup;
 	
 	//DEBUGLOG( "destroying " + to_string( m_pluginList.size() ) + " LADSPA plugins" );
@@ -60,6 +121,9 @@ Effects::~Effects()
 		delete m_pluginList[i];
 	}
 	m_pluginList.clear();
+	for ( unsigned i = 0; i < m_oldPlugins.size(); i++ ) {
+		delete m_oldPlugins[i];
+	}
 }
 
 
@@ -80,6 +144,7 @@ void  Effects::setLadspaFX( T<LadspaFX>::shared_ptr pFX, int nFX )
 	m_engine->lock( RIGHT_HERE );
 
 	m_FXList[ nFX ] = pFX;
+	publishRack();
 	
 	if ( pFX != NULL ) {
 		m_engine->get_preferences()->setMostRecentFX( pFX->getPluginName() );
@@ -91,104 +156,103 @@ void  Effects::setLadspaFX( T<LadspaFX>::shared_ptr pFX, int nFX )
 
 
 
+const Effects::Rack& Effects::acquireRack()
+{
+	m_pRackReader->enter();
+	return *m_pRack->get();
+}
+
+
+
+void Effects::releaseRack()
+{
+	m_pRackReader->leave();
+}
+
+
+
+void Effects::suspendFX()
+{
+	m_bSuspended = true;
+	publishRack();
+	m_pRackReader->synchronize();
+}
+
+
+
+void Effects::resumeFX()
+{
+	m_bSuspended = false;
+	publishRack();
+}
+
+
+
+/// Copy m_FXList for the audio thread (an empty Rack when
+/// suspended).  Call with the engine locked.
+void Effects::publishRack()
+{
+	T<Rack>::shared_ptr rack( new Rack );
+	rack->count = 0;
+	if ( ! m_bSuspended ) {
+		rack->count = std::min( unsigned( m_pluginList.size() ), unsigned( MAX_FX ) );
+		for ( unsigned k = 0; k < MAX_FX; ++k ) {
+			rack->fx[ k ] = m_FXList[ k ];
+		}
+	}
+	m_pRack->publish( rack );
+}
+
+
+
 ///
 /// Loads only usable plugins
 ///
-std::vector<LadspaFXInfo*> Effects::getPluginList()
+const std::vector<LadspaFXInfo*>& Effects::getPluginList()
 {
-	if ( m_pluginList.size() != 0 ) {
-		return m_pluginList;
-	}
+	takeRescan();
+	return m_pluginList;
+}
 
-	vector<QString> ladspaPathVect = m_engine->get_preferences()->getLadspaPath();
-	DEBUGLOG( QString( "PATHS: %1" ).arg( ladspaPathVect.size() ) );
-	for ( vector<QString>::iterator i = ladspaPathVect.begin(); i != ladspaPathVect.end(); i++ ) {
-		QString sPluginDir = *i;
-		DEBUGLOG( "*** [getPluginList] reading directory: " + sPluginDir );
 
-		QDir dir( sPluginDir );
-		if ( !dir.exists() ) {
-			DEBUGLOG( "Directory " + sPluginDir + " not found" );
-			continue;
-		}
 
-		QFileInfoList list = dir.entryInfoList();
-		for ( int i = 0; i < list.size(); ++i ) {
-			QString sPluginName = list.at( i ).fileName();
+/// Index the LADSPA paths now (there was no usable index).
+void Effects::scanPlugins()
+{
+	LadspaIndex index( m_sIndexFile );
+	index.load();
+	if ( index.scan( m_engine->get_preferences()->getLadspaPath() ) ) {
+		index.save();
+	}
+	index.getPlugins( m_pluginList );
+}
 
-			if ( ( sPluginName == "." ) || ( sPluginName == ".." ) ) {
-				continue;
-			}
 
-			// if the file ends with .so or .dll is a plugin, else...
-#ifdef WIN32
-			int pos = sPluginName.indexOf( ".dll" );
-#else
-#ifdef Q_OS_MACX
-			int pos = sPluginName.indexOf( ".dylib" );
-#else
-			int pos = sPluginName.indexOf( ".so" );
-#endif
-#endif
-			if ( pos == -1 ) {
-				continue;
-			}
-			//warningLog( "[getPluginList] Loading: " + sPluginName  );
 
-			QString sAbsPath = QString( "%1/%2" ).arg( sPluginDir ).arg( sPluginName );
+/// Use the result of the background rescan once it is done.
+/// The old plugin infos are kept, since the GUI may point to
+/// them.
+void Effects::takeRescan()
+{
+	if ( m_pRescan == NULL || !m_pRescan->isFinished() ) {
+		return;
+	}
 
-			QLibrary lib( sAbsPath );
-			LADSPA_Descriptor_Function desc_func = ( LADSPA_Descriptor_Function )lib.resolve( "ladspa_descriptor" );
-			if ( desc_func == NULL ) {
-				ERRORLOG( "Error loading the library. (" + sAbsPath + ")" );
-				continue;
-			}
-			const LADSPA_Descriptor * d;
-			if ( desc_func ) {
-				for ( unsigned i = 0; ( d = desc_func ( i ) ) != NULL; i++ ) {
-					LadspaFXInfo* pFX = new LadspaFXInfo( QString::fromLocal8Bit(d->Name) );
-					pFX->m_sFilename = sAbsPath;
-					pFX->m_sLabel = QString::fromLocal8Bit(d->Label);
-					pFX->m_sID = QString::number(d->UniqueID);
-					pFX->m_sMaker = QString::fromLocal8Bit(d->Maker);
-					pFX->m_sCopyright = QString::fromLocal8Bit(d->Copyright);
-
-					//DEBUGLOG( "Loading: " + pFX->m_sLabel );
-
-					for ( unsigned j = 0; j < d->PortCount; j++ ) {
-						LADSPA_PortDescriptor pd = d->PortDescriptors[j];
-						if ( LADSPA_IS_PORT_INPUT( pd ) && LADSPA_IS_PORT_CONTROL( pd ) ) {
-							pFX->m_nICPorts++;
-						} else if ( LADSPA_IS_PORT_INPUT( pd ) && LADSPA_IS_PORT_AUDIO( pd ) ) {
-							pFX->m_nIAPorts++;
-						} else if ( LADSPA_IS_PORT_OUTPUT( pd ) && LADSPA_IS_PORT_CONTROL( pd ) ) {
-							pFX->m_nOCPorts++;
-						} else if ( LADSPA_IS_PORT_OUTPUT( pd ) && LADSPA_IS_PORT_AUDIO( pd ) ) {
-							pFX->m_nOAPorts++;
-						} else {
-//							string sPortName = d->PortNames[ j ];
-							QString sPortName;
-							ERRORLOG( QString( "%1::%2 unknown port type" ).arg( pFX->m_sLabel ).arg( sPortName ) );
-						}
-					}
-					if ( ( pFX->m_nIAPorts == 2 ) && ( pFX->m_nOAPorts == 2 ) ) {	// Stereo plugin
-						m_pluginList.push_back( pFX );
-					} else if ( ( pFX->m_nIAPorts == 1 ) && ( pFX->m_nOAPorts == 1 ) ) {	// Mono plugin
-						m_pluginList.push_back( pFX );
-					} else {	// not supported plugin
-						//WARNINGLOG( "Plugin not supported: " + sPluginName  );
-						delete pFX;
-					}
-				}
-			} else {
-				ERRORLOG( "Error loading: " + sPluginName  );
-			}
-		}
+	if ( m_pRescan->changed && m_pRootGroup == NULL ) {
+		m_oldPlugins.insert( m_oldPlugins.end(), m_pluginList.begin(), m_pluginList.end() );
+		m_pluginList.swap( m_pRescan->plugins );
+		m_pRescan->plugins.clear();
+		INFOLOG( QString( "The LADSPA plugins changed.  Found %1." ).arg( m_pluginList.size() ) );
+		publishRack();
+	} else if ( m_pRescan->changed ) {
+		INFOLOG( "The LADSPA plugins changed.  The new list is used after a restart." );
 	}
 
-	DEBUGLOG( QString( "Loaded %1 LADSPA plugins" ).arg( m_pluginList.size() ) );
-	std::sort( m_pluginList.begin(), m_pluginList.end(), LadspaFXInfo::alphabeticOrder );
-	return m_pluginList;
+	for ( unsigned i = 0; i < m_pRescan->plugins.size(); i++ ) {
+		delete m_pRescan->plugins[i];
+	}
+	delete m_pRescan;
+	m_pRescan = NULL;
 }
 
 
@@ -202,6 +266,7 @@ LadspaFXGroup* Effects::getLadspaFXGroup()
 	if ( m_pRootGroup  ) {
 		return m_pRootGroup;
 	}
+	takeRescan();
 
 	m_pRootGroup = new LadspaFXGroup( "Root" );
 	
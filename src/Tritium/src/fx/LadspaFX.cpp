@@ -246,6 +246,10 @@ T<LadspaFX>::shared_ptr LadspaFX::load( const QString& sLibraryPath, const QStri
 	//pFX->infoLog( "[LadspaFX::load] instantiate " + pFX->getPluginName() );
 	pFX->m_handle = pFX->m_d->instantiate( pFX->m_d, nSampleRate );
 
+	// Keep running for at least 2 seconds of silence (longer if
+	// the tail turns out to have gaps).
+	pFX->m_tail.setMinHold( 2 * nSampleRate );
+
 	for ( unsigned nPort = 0; nPort < pFX->m_d->PortCount; nPort++ ) {
 		LADSPA_PortDescriptor pd = pFX->m_d->PortDescriptors[ nPort ];
 
@@ -423,6 +427,7 @@ void LadspaFX::activate()
 		m_bActivated = true;
 		m_d->activate( m_handle );
 	}
+	m_tail.reset();
 }
 
 
@@ -0,0 +1,270 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "LadspaIndex.hpp"
+
+#ifdef LADSPA_SUPPORT
+
+#include <Tritium/Logger.hpp>
+
+#include <algorithm>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QDateTime>
+#include <QDataStream>
+#include <QLibrary>
+#include <unistd.h> // getpid()
+
+namespace Tritium
+{
+
+namespace
+{
+	const quint32 INDEX_MAGIC = 0x4c445849;	// "LDXI"
+	const quint32 INDEX_VERSION = 1;
+}
+
+LadspaIndex::LadspaIndex( const QString& sFilename )
+	: m_sFilename( sFilename )
+{
+}
+
+
+
+bool LadspaIndex::load()
+{
+	QFile file( m_sFilename );
+	if ( !file.open( QIODevice::ReadOnly ) ) {
+		return false;
+	}
+	QDataStream in( &file );
+	in.setVersion( QDataStream::Qt_4_0 );
+
+	quint32 magic, version, nLibraries;
+	in >> magic >> version >> nLibraries;
+	if ( in.status() != QDataStream::Ok
+	     || magic != INDEX_MAGIC
+	     || version != INDEX_VERSION ) {
+		WARNINGLOG( "Ignoring the LADSPA index " + m_sFilename );
+		return false;
+	}
+
+	library_map_t libraries;
+	for ( quint32 k = 0; k < nLibraries && in.status() == QDataStream::Ok; ++k ) {
+		QString sPath;
+		qint64 size;
+		quint32 mtime, nPlugins;
+		in >> sPath >> size >> mtime >> nPlugins;
+
+		Library& lib = libraries[ sPath ];
+		lib.size = size;
+		lib.mtime = mtime;
+		for ( quint32 j = 0; j < nPlugins && in.status() == QDataStream::Ok; ++j ) {
+			QString sName;
+			quint32 ic, oc, ia, oa;
+			in >> sName;
+			LadspaFXInfo info( sName );
+			in >> info.m_sID >> info.m_sLabel >> info.m_sMaker >> info.m_sCopyright;
+			in >> ic >> oc >> ia >> oa;
+			info.m_sFilename = sPath;
+			info.m_nICPorts = ic;
+			info.m_nOCPorts = oc;
+			info.m_nIAPorts = ia;
+			info.m_nOAPorts = oa;
+			lib.plugins.push_back( info );
+		}
+	}
+	if ( in.status() != QDataStream::Ok ) {
+		WARNINGLOG( "The LADSPA index is truncated: " + m_sFilename );
+		return false;
+	}
+
+	m_libraries.swap( libraries );
+	return true;
+}
+
+
+
+bool LadspaIndex::save()
+{
+	QDir().mkpath( QFileInfo( m_sFilename ).absolutePath() );
+
+	// Write to a temporary file and rename, so that another
+	// process never reads a partial index.
+	QString sTmp = QString( "%1.%2.tmp" ).arg( m_sFilename ).arg( (qulonglong)getpid() );
+	QFile file( sTmp );
+	if ( !file.open( QIODevice::WriteOnly ) ) {
+		WARNINGLOG( "Could not write the LADSPA index " + sTmp );
+		return false;
+	}
+	QDataStream out( &file );
+	out.setVersion( QDataStream::Qt_4_0 );
+
+	out << INDEX_MAGIC << INDEX_VERSION << quint32( m_libraries.size() );
+	for ( library_map_t::iterator k = m_libraries.begin(); k != m_libraries.end(); ++k ) {
+		const Library& lib = k->second;
+		out << k->first << qint64( lib.size ) << quint32( lib.mtime )
+		    << quint32( lib.plugins.size() );
+		for ( size_t j = 0; j < lib.plugins.size(); ++j ) {
+			const LadspaFXInfo& info = lib.plugins[ j ];
+			out << info.m_sName << info.m_sID << info.m_sLabel
+			    << info.m_sMaker << info.m_sCopyright
+			    << quint32( info.m_nICPorts ) << quint32( info.m_nOCPorts )
+			    << quint32( info.m_nIAPorts ) << quint32( info.m_nOAPorts );
+		}
+	}
+	bool ok = ( out.status() == QDataStream::Ok );
+	file.close();
+
+	QFile::remove( m_sFilename );
+	if ( !ok || !QFile::rename( sTmp, m_sFilename ) ) {
+		WARNINGLOG( "Could not write the LADSPA index " + m_sFilename );
+		QFile::remove( sTmp );
+		return false;
+	}
+	return true;
+}
+
+
+
+bool LadspaIndex::scan( const std::vector<QString>& paths )
+{
+	library_map_t found;
+	unsigned nLoaded = 0;
+
+	for ( std::vector<QString>::const_iterator i = paths.begin(); i != paths.end(); ++i ) {
+		QString sPluginDir = *i;
+		QDir dir( sPluginDir );
+		if ( !dir.exists() ) {
+			DEBUGLOG( "Directory " + sPluginDir + " not found" );
+			continue;
+		}
+
+		QFileInfoList list = dir.entryInfoList( QDir::Files );
+		for ( int k = 0; k < list.size(); ++k ) {
+			QString sPluginName = list.at( k ).fileName();
+
+			// if the file ends with .so or .dll is a plugin, else...
+#ifdef WIN32
+			int pos = sPluginName.indexOf( ".dll" );
+#else
+#ifdef Q_OS_MACX
+			int pos = sPluginName.indexOf( ".dylib" );
+#else
+			int pos = sPluginName.indexOf( ".so" );
+#endif
+#endif
+			if ( pos == -1 ) {
+				continue;
+			}
+
+			QString sAbsPath = QString( "%1/%2" ).arg( sPluginDir ).arg( sPluginName );
+			if ( found.find( sAbsPath ) != found.end() ) {
+				continue;
+			}
+
+			Library lib;
+			lib.size = list.at( k ).size();
+			lib.mtime = list.at( k ).lastModified().toTime_t();
+
+			library_map_t::iterator old = m_libraries.find( sAbsPath );
+			if ( old != m_libraries.end()
+			     && old->second.size == lib.size
+			     && old->second.mtime == lib.mtime ) {
+				found[ sAbsPath ] = old->second;
+				continue;
+			}
+
+			loadLibrary( sAbsPath, lib );
+			found[ sAbsPath ] = lib;
+			++nLoaded;
+		}
+	}
+
+	// Changed if a library was (re)loaded or one is gone.
+	bool changed = ( nLoaded > 0 ) || ( found.size() != m_libraries.size() );
+	DEBUGLOG( QString( "Indexed %1 LADSPA libraries (%2 loaded)" )
+		  .arg( found.size() )
+		  .arg( nLoaded ) );
+	m_libraries.swap( found );
+	return changed;
+}
+
+
+
+void LadspaIndex::getPlugins( std::vector<LadspaFXInfo*>& out )
+{
+	for ( library_map_t::iterator k = m_libraries.begin(); k != m_libraries.end(); ++k ) {
+		const std::vector<LadspaFXInfo>& plugins = k->second.plugins;
+		for ( size_t j = 0; j < plugins.size(); ++j ) {
+			out.push_back( new LadspaFXInfo( plugins[ j ] ) );
+		}
+	}
+	std::sort( out.begin(), out.end(), LadspaFXInfo::alphabeticOrder );
+}
+
+
+
+/// Ask the library for its plugins and keep the usable ones.
+void LadspaIndex::loadLibrary( const QString& sAbsPath, Library& lib )
+{
+	QLibrary library( sAbsPath );
+	LADSPA_Descriptor_Function desc_func = ( LADSPA_Descriptor_Function )library.resolve( "ladspa_descriptor" );
+	if ( desc_func == NULL ) {
+		ERRORLOG( "Error loading the library. (" + sAbsPath + ")" );
+		return;
+	}
+
+	const LADSPA_Descriptor * d;
+	for ( unsigned i = 0; ( d = desc_func ( i ) ) != NULL; i++ ) {
+		LadspaFXInfo info( QString::fromLocal8Bit(d->Name) );
+		info.m_sFilename = sAbsPath;
+		info.m_sLabel = QString::fromLocal8Bit(d->Label);
+		info.m_sID = QString::number(d->UniqueID);
+		info.m_sMaker = QString::fromLocal8Bit(d->Maker);
+		info.m_sCopyright = QString::fromLocal8Bit(d->Copyright);
+
+		for ( unsigned j = 0; j < d->PortCount; j++ ) {
+			LADSPA_PortDescriptor pd = d->PortDescriptors[j];
+			if ( LADSPA_IS_PORT_INPUT( pd ) && LADSPA_IS_PORT_CONTROL( pd ) ) {
+				info.m_nICPorts++;
+			} else if ( LADSPA_IS_PORT_INPUT( pd ) && LADSPA_IS_PORT_AUDIO( pd ) ) {
+				info.m_nIAPorts++;
+			} else if ( LADSPA_IS_PORT_OUTPUT( pd ) && LADSPA_IS_PORT_CONTROL( pd ) ) {
+				info.m_nOCPorts++;
+			} else if ( LADSPA_IS_PORT_OUTPUT( pd ) && LADSPA_IS_PORT_AUDIO( pd ) ) {
+				info.m_nOAPorts++;
+			} else {
+				ERRORLOG( QString( "%1 unknown port type" ).arg( info.m_sLabel ) );
+			}
+		}
+		if ( ( info.m_nIAPorts == 2 ) && ( info.m_nOAPorts == 2 ) ) {	// Stereo plugin
+			lib.plugins.push_back( info );
+		} else if ( ( info.m_nIAPorts == 1 ) && ( info.m_nOAPorts == 1 ) ) {	// Mono plugin
+			lib.plugins.push_back( info );
+		}
+	}
+}
+
+};
+
+#endif // LADSPA_SUPPORT
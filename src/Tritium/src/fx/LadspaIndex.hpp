@@ -0,0 +1,86 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+#ifndef TRITIUM_LADSPAINDEX_HPP
+#define TRITIUM_LADSPAINDEX_HPP
+
+#ifdef LADSPA_SUPPORT
+
+#include <Tritium/fx/LadspaFX.hpp>
+#include <QString>
+#include <map>
+#include <vector>
+#include <stdint.h>
+
+namespace Tritium
+{
+
+/**
+ * \brief The LADSPA plugins found on disk, indexed by library.
+ *
+ * Finding the plugins means loading every library in every LADSPA
+ * path and asking it for its descriptors, which is slow when there
+ * are hundreds of them.  The index remembers the plugins of each
+ * library along with its size and modification time, and is saved
+ * to a file.  scan() only loads the libraries that are new or have
+ * changed since they were indexed.
+ *
+ * Only the plugins that Effects can use (mono or stereo) are kept.
+ * Libraries without any are indexed too, so that they aren't loaded
+ * again.  Not thread-safe.
+ */
+class LadspaIndex
+{
+public:
+	LadspaIndex( const QString& sFilename );
+
+	/// Read the index file.  Returns false if there is none (or
+	/// it can't be used).
+	bool load();
+	bool save();
+
+	/// Index the libraries in 'paths'.  Returns true if anything
+	/// changed.
+	bool scan( const std::vector<QString>& paths );
+
+	/// New copies of the indexed plugins, sorted by name.  The
+	/// caller owns them.
+	void getPlugins( std::vector<LadspaFXInfo*>& out );
+
+private:
+	struct Library
+	{
+		int64_t size;
+		uint32_t mtime;
+		std::vector<LadspaFXInfo> plugins;
+	};
+	typedef std::map<QString, Library> library_map_t;
+
+	static void loadLibrary( const QString& sPath, Library& lib );
+
+	QString m_sFilename;
+	library_map_t m_libraries;	///< Absolute path --> plugins
+};
+
+};
+
+#endif // LADSPA_SUPPORT
+
+#endif // TRITIUM_LADSPAINDEX_HPP
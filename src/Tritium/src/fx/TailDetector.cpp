@@ -0,0 +1,120 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include <Tritium/fx/TailDetector.hpp>
+#include <cmath>
+
+namespace Tritium
+{
+
+TailDetector::TailDetector( float fThreshold, uint32_t nMinHold )
+		: m_state( RUNNING )
+		, m_fThreshold( fThreshold )
+		, m_nMinHold( nMinHold )
+		, m_nTail( 0 )
+		, m_nLastAudible( 0 )
+		, m_nSilent( 0 )
+		, m_nLongestGap( 0 )
+		, m_nLongestTail( 0 )
+		, m_nIdleCount( 0 )
+{
+}
+
+
+
+void TailDetector::reset()
+{
+	m_state = RUNNING;
+}
+
+
+
+bool TailDetector::wantProcess( bool bInput )
+{
+	if ( bInput ) {
+		m_state = RUNNING;
+		return true;
+	}
+	if ( m_state == RUNNING ) {
+		m_state = TAIL;
+		m_nTail = 0;
+		m_nLastAudible = 0;
+		m_nSilent = 0;
+	}
+	return m_state != IDLE;
+}
+
+
+
+void TailDetector::processed( float fPeak, uint32_t nFrames )
+{
+	if ( m_state != TAIL ) {
+		return;
+	}
+
+	m_nTail += nFrames;
+	if ( fPeak < m_fThreshold ) {
+		m_nSilent += nFrames;
+		if ( m_nSilent >= getHold() ) {
+			if ( m_nLastAudible > m_nLongestTail ) {
+				m_nLongestTail = m_nLastAudible;
+			}
+			m_state = IDLE;
+			++m_nIdleCount;
+		}
+		return;
+	}
+
+	// Sound after a gap: it could be an echo, so wait longer.
+	if ( m_nSilent > m_nLongestGap ) {
+		m_nLongestGap = m_nSilent;
+	}
+	m_nSilent = 0;
+	m_nLastAudible = m_nTail;
+}
+
+
+
+uint32_t TailDetector::getHold() const
+{
+	uint32_t nHold = 2 * m_nLongestGap;
+	if ( nHold < m_nMinHold ) {
+		nHold = m_nMinHold;
+	}
+	return ( nHold > 0 ) ? nHold : 1;
+}
+
+
+
+float TailDetector::peak( const float* buf, uint32_t nFrames )
+{
+	float fPeak = 0.0f;
+	float v;
+	for ( uint32_t k = 0; k < nFrames; ++k ) {
+		v = fabsf( buf[ k ] );
+		if ( v > fPeak ) {
+			fPeak = v;
+		}
+	}
+	return fPeak;
+}
+
+};
@@ -126,6 +126,18 @@ TransportPosition::State H2Transport::get_state()
     return TransportPosition::STOPPED;
 }
 
+void H2Transport::set_frame_rate(uint32_t frame_rate)
+{
+    SimpleTransportMaster* stm = dynamic_cast<SimpleTransportMaster*>(d->xport.get());
+    if( stm ) stm->set_frame_rate(frame_rate);
+}
+
+void H2Transport::set_timeline(T<SongTimeline>::shared_ptr timeline)
+{
+    SimpleTransportMaster* stm = dynamic_cast<SimpleTransportMaster*>(d->xport.get());
+    if( stm ) stm->set_timeline(timeline);
+}
+
 bool H2Transport::setJackTimeMaster(T<JackClient>::shared_ptr parent, bool if_none_already)
 {
     bool rv;
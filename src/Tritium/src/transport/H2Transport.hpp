@@ -28,6 +28,7 @@ namespace Tritium
     class Engine;
     class H2TransportPrivate;
     class Song;
+    class SongTimeline;
     class JackClient;
 
     /**
@@ -78,6 +79,11 @@ namespace Tritium
         // * set current transport model
         // * possibly set parameters on transport models.
 
+	// Frame rate of the internal transport master.
+	void set_frame_rate(uint32_t frame_rate);
+	// Timeline of the internal transport master.
+	void set_timeline(T<SongTimeline>::shared_ptr timeline);
+
         H2Transport(Engine* parent);
         virtual ~H2Transport();
 
@@ -22,6 +22,8 @@
 #include <Tritium/Transport.hpp>
 #include <Tritium/TransportPosition.hpp>
 #include "SimpleTransportMaster.hpp"
+#include "../SongTimeline.hpp"
+#include "../RtSnapshot.hpp"
 
 #include <Tritium/Song.hpp>
 
@@ -44,9 +46,16 @@ public:
     TransportPosition pos;
     QMutex pos_mutex;
     T<Song>::shared_ptr song;
+    uint32_t frame_rate;
+    // processed_frames() reads the published timeline, never the
+    // Song.
+    RtReader reader;
+    RtSnapshot<SongTimeline> timeline;
 };
 
-SimpleTransportMasterPrivate::SimpleTransportMasterPrivate()
+SimpleTransportMasterPrivate::SimpleTransportMasterPrivate() :
+    frame_rate(48000),
+    timeline(reader)
 {
     set_current_song(song);
 }
@@ -62,16 +71,17 @@ int SimpleTransportMaster::locate(uint32_t frame)
 
     d->pos.ticks_per_beat = d->song->get_resolution();
     d->pos.beats_per_minute = d->song->get_bpm();
-    double frames_per_tick =
-        double(d->pos.frame_rate)
-        * 60.0
-        / d->pos.beats_per_minute
-        / double(d->pos.ticks_per_beat);
-    uint32_t abs_tick = round( double(frame) / frames_per_tick );
-
-    d->pos.bbt_offset = round(fmod(frame, frames_per_tick));
+    // (The epsilon keeps a frame that is exactly on a tick from
+    // rounding down to the tick before.)
+    uint32_t abs_tick = ::floor( d->song->tick_for_frame(frame, d->pos.frame_rate) + 1e-6 );
+
+    d->pos.bbt_offset = frame - d->song->frame_for_tick(abs_tick, d->pos.frame_rate);
     d->pos.bar = d->song->bar_for_absolute_tick(abs_tick);
     d->pos.bar_start_tick = d->song->bar_start_tick(d->pos.bar);
+    if( (d->pos.bar >= 1) && (d->pos.bar <= int32_t(d->song->song_bar_count())) ) {
+        d->pos.beats_per_bar = d->song->ticks_in_bar(d->pos.bar)
+            / d->pos.ticks_per_beat;
+    }
     d->pos.beat = 1 + (abs_tick - d->pos.bar_start_tick) / d->pos.ticks_per_beat;
     d->pos.tick = (abs_tick - d->pos.bar_start_tick) % d->pos.ticks_per_beat;
     d->pos.frame = frame;
@@ -108,12 +118,7 @@ int SimpleTransportMaster::locate(uint32_t bar, uint32_t beat, uint32_t tick)
             + tick;
     }
 
-    d->pos.frame =
-        double(abs_tick)
-        * d->pos.frame_rate
-        * 60.0
-        / double(d->pos.ticks_per_beat)
-        / d->pos.beats_per_minute;
+    d->pos.frame = ::round( d->song->frame_for_tick(abs_tick, d->pos.frame_rate) );
 
     d->pos.new_position = true;
 
@@ -162,18 +167,26 @@ void SimpleTransportMaster::processed_frames(uint32_t nFrames)
     d->pos.new_position = false;
     d->pos.normalize(target);
 
-    if( old_bar != d->pos.bar ) {
-	uint32_t song_bars = d->song->song_bar_count();
+    d->reader.enter();
+    const SongTimeline* tl = d->timeline.get();
+    if( tl == 0 ) {
+	d->reader.leave();
+	return;
+    }
+
+    uint32_t song_bars = tl->bar_count();
+    if( (old_bar != d->pos.bar) && (song_bars > 0) ) {
 	if( d->pos.bar > song_bars ) {
 	    d->pos.bar = 1 + ((d->pos.bar - 1) % song_bars);
-	    d->pos.bar_start_tick = d->song->bar_start_tick(d->pos.bar); 
+	    d->pos.bar_start_tick = tl->bar_start_tick(d->pos.bar);
 	}
-        d->pos.beats_per_bar = d->song->ticks_in_bar(d->pos.bar)
+        d->pos.beats_per_bar = tl->ticks_in_bar(d->pos.bar)
             / d->pos.ticks_per_beat;
     }
     // After all the calculations... *now* the new tempo
     // takes effect (for the next cycle).
-    d->pos.beats_per_minute = d->song->get_bpm();
+    d->pos.beats_per_minute = tl->bpm();
+    d->reader.leave();
 }
 
 void SimpleTransportMaster::set_current_song(T<Song>::shared_ptr s)
@@ -181,6 +194,18 @@ void SimpleTransportMaster::set_current_song(T<Song>::shared_ptr s)
     d->set_current_song(s);
 }
 
+void SimpleTransportMaster::set_frame_rate(uint32_t frame_rate)
+{
+    QMutexLocker lk(&d->pos_mutex);
+    d->frame_rate = frame_rate;
+    d->pos.frame_rate = frame_rate;
+}
+
+void SimpleTransportMaster::set_timeline(T<SongTimeline>::shared_ptr timeline)
+{
+    d->timeline.publish(timeline);
+}
+
 uint32_t SimpleTransportMaster::get_current_frame(void)
 {
     return d->pos.frame;
@@ -190,12 +215,13 @@ void SimpleTransportMasterPrivate::set_current_song(T<Song>::shared_ptr s)
 {
     QMutexLocker lk(&pos_mutex);
     song = s;
+    timeline.publish( s ? s->get_timeline() : T<SongTimeline>::shared_ptr() );
 
     #warning "Still have a hard-coded frame rate"
     if( song ) {
         pos.state = TransportPosition::STOPPED;
         pos.frame = 0;
-        pos.frame_rate = 48000;
+        pos.frame_rate = frame_rate;
         pos.bar = 1;
         pos.beat = 1;
         pos.tick = 0;
@@ -208,7 +234,7 @@ void SimpleTransportMasterPrivate::set_current_song(T<Song>::shared_ptr s)
     } else {
         pos.state = TransportPosition::STOPPED;
         pos.frame = 0;
-        pos.frame_rate = 48000;
+        pos.frame_rate = frame_rate;
         pos.bar = 1;
         pos.beat = 1;
         pos.tick = 0;
@@ -27,6 +27,7 @@ namespace Tritium
 {
     struct TransportPosition;
     class SimpleTransportMasterPrivate;
+    class SongTimeline;
 
     /**
      * This defines a very simple transport master for Tritium.
@@ -54,6 +55,15 @@ namespace Tritium
         virtual uint32_t get_current_frame(void);
 	virtual TransportPosition::State get_state();
 
+        // Frame rate of the audio output (default 48000).
+        void set_frame_rate(uint32_t frame_rate);
+
+        // The song's timeline, as processed_frames() sees it.
+        // set_current_song() sets the song's current one.  Call it
+        // again with each new timeline of the song (see
+        // SongSequencer::timeline()).
+        void set_timeline(T<SongTimeline>::shared_ptr timeline);
+
     private:
         SimpleTransportMasterPrivate* d;
     };
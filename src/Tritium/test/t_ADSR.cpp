@@ -0,0 +1,150 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * t_ADSR.cpp
+ *
+ * Tests the block envelope generator.
+ */
+
+#include <Tritium/ADSR.hpp>
+#include <cmath>
+#include <vector>
+
+// CHANGE THIS TO MATCH YOUR FILE:
+#define THIS_NAMESPACE t_ADSR
+#include "test_macros.hpp"
+
+using namespace Tritium;
+
+namespace THIS_NAMESPACE
+{
+    struct Fixture
+    {
+	/// attack 100, decay 200, sustain 0.5, release 1000
+	ADSR adsr;
+
+	Fixture() : adsr( 100, 200, 0.5, 1000 ) {}
+    };
+
+    bool close(float a, float b) {
+	return fabs(a - b) < 1.0e-5;
+    }
+
+} // namespace THIS_NAMESPACE
+
+TEST_BEGIN( Fixture );
+
+TEST_CASE( 010_segments )
+{
+    std::vector<float> env(400);
+    bool flat = adsr.get_values( 1, &env[0], env.size() );
+    CK( ! flat );
+
+    // Attack: 101 frames from 0 to 1
+    CK( env[0] == 0.0f );
+    for( unsigned k=1 ; k<=100 ; ++k ) {
+	CK( env[k] > env[k-1] );
+    }
+    CK( close(env[100], 1.0f) );
+
+    // Decay: 201 frames from 1 to sustain.
+    CK( env[101] == 1.0f );
+    for( unsigned k=102 ; k<=301 ; ++k ) {
+	CK( env[k] < env[k-1] );
+    }
+    CK( close(env[301], 0.5f) );
+
+    // Sustain
+    for( unsigned k=302 ; k<400 ; ++k ) {
+	CK( env[k] == 0.5f );
+    }
+    CK( adsr.get_values( 1, &env[0], 64 ) );
+    CK( env[0] == 0.5f && env[63] == 0.5f );
+}
+
+TEST_CASE( 020_blocks_match_frames )
+{
+    ADSR other( adsr );
+    std::vector<float> env(1000);
+    float v;
+    unsigned k, n;
+
+    for( k=0 ; k<env.size() ; k += n ) {
+	n = 1 + (k % 37);
+	if( k + n > env.size() ) n = env.size() - k;
+	adsr.get_values( 0.75, &env[k], n );
+    }
+    for( k=0 ; k<env.size() ; ++k ) {
+	v = other.get_value( 0.75 );
+	CK( v == env[k] );
+    }
+}
+
+TEST_CASE( 030_release )
+{
+    std::vector<float> env(2000);
+    adsr.get_values( 1, &env[0], 50 );
+    float last = env[49];
+
+    CK( adsr.release() == last );
+    CK( adsr.release() == 1 );
+
+    // Continues from where it was and falls to 0.
+    adsr.get_values( 1, &env[0], env.size() );
+    CK( env[0] == last );
+    for( unsigned k=1 ; k<=1000 ; ++k ) {
+	CK( env[k] < env[k-1] );
+    }
+    CK( close(env[1000], 0.0f) );
+    CK( env[1001] == 0.0f );
+    CK( adsr.release() == 0 );
+}
+
+TEST_CASE( 040_zero_lengths )
+{
+    ADSR a( 0, 0, 0.25, 0 );
+    float env[8];
+    a.get_values( 1, env, 8 );
+    CK( env[0] == 1.0f );
+    CK( env[1] == 0.25f );
+    CK( env[7] == 0.25f );
+
+    // A short release is stretched to avoid clicks.
+    a.release();
+    a.get_values( 1, env, 8 );
+    CK( env[0] == 0.25f );
+    CK( env[7] > 0.0f );
+}
+
+TEST_CASE( 050_params_before_start )
+{
+    // Instruments set the parameters after the ADSR is made.
+    ADSR a;
+    a.__attack = 0;
+    a.__decay = 0;
+    a.__sustain = 0.75;
+    float env[4];
+    a.get_values( 1, env, 4 );
+    CK( env[3] == 0.75f );
+}
+
+TEST_END()
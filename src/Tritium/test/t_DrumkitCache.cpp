@@ -0,0 +1,232 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * t_DrumkitCache.cpp
+ *
+ * Tests the LV2 plugin's drumkit cache (src/sampler), which serves
+ * program changes.
+ */
+
+#include "../../sampler/DrumkitCache.hpp"
+#include <Tritium/Engine.hpp>
+#include <Tritium/Preferences.hpp>
+#include <Tritium/Presets.hpp>
+#include <Tritium/InstrumentList.hpp>
+#include <Tritium/Logger.hpp>
+#include <unistd.h> // usleep()
+
+// CHANGE THIS TO MATCH YOUR FILE:
+#define THIS_NAMESPACE t_DrumkitCache
+#include "test_macros.hpp"
+#include "test_config.hpp"
+
+using namespace Tritium;
+using Composite::Plugin::DrumkitCache;
+
+namespace THIS_NAMESPACE
+{
+    const char drumkit_dir[] = TEST_DATA_DIR "/t_Serialization-drumkit";
+
+    /**
+     * The cache tells kits apart by their URI.  'k' extra "/."
+     * give a different URI for the same kit, so that every kit has
+     * the same size.
+     */
+    QString kit_uri(int k)
+    {
+	QString uri(drumkit_dir);
+	for( int j=0 ; j<k ; ++j ) {
+	    uri += "/.";
+	}
+	return uri + "/drumkit.xml";
+    }
+
+    struct Fixture
+    {
+	T<Engine>::auto_ptr engine;
+	T<DrumkitCache>::auto_ptr cache;
+
+	Fixture() {
+	    Logger::create_instance();
+	    T<Preferences>::shared_ptr prefs(new Preferences);
+	    engine.reset( new Engine(prefs) );
+	    cache.reset( new DrumkitCache(engine.get()) );
+	}
+	~Fixture() {
+	    cache.reset();
+	    engine.reset();
+	    delete Logger::get_instance();
+	}
+
+	/// Programs 0..count-1 of bank 0 get kit_uri(0..count-1).
+	void set_programs(int count) {
+	    Presets presets;
+	    for( int k=0 ; k<count ; ++k ) {
+		presets.set_program(0, 0, k, kit_uri(k));
+	    }
+	    cache->set_presets(presets);
+	}
+
+	/// Wait for the worker (about 10 seconds at most).
+	bool wait_loaded(uint8_t prog, bool loaded) {
+	    for( int k=0 ; k<1000 ; ++k ) {
+		if( cache->is_loaded(0, prog) == loaded ) return true;
+		usleep(10000);
+	    }
+	    return false;
+	}
+
+	/// Cycle like the audio thread until a requested kit is ready.
+	DrumkitCache::Kit* wait_pending() {
+	    DrumkitCache::Kit* kit;
+	    for( int k=0 ; k<1000 ; ++k ) {
+		cache->cycle();
+		kit = cache->take_pending();
+		if( kit ) return kit;
+		usleep(10000);
+	    }
+	    return 0;
+	}
+
+	/// Request a loaded kit and make it the current one.
+	DrumkitCache::Kit* hit(uint8_t prog) {
+	    cache->cycle();
+	    cache->request(0, prog);
+	    return cache->take_pending();
+	}
+    };
+
+} // namespace THIS_NAMESPACE
+
+TEST_BEGIN( Fixture );
+
+TEST_CASE( 010_hit_miss )
+{
+    set_programs(3);
+    DrumkitCache::Kit* kit = cache->load_now(kit_uri(0));
+    BOOST_REQUIRE( kit != 0 );
+    CK( kit->uri == kit_uri(0) );
+    CK( kit->instruments->get_size() > 0 );
+    size_t bytes = kit->bytes;
+    CK( bytes > 0 );
+    CK( cache->memory_used() == bytes );
+    CK( cache->is_loaded(0, 0) );
+
+    // A miss.  Nothing loads it while the worker is stopped.
+    CK( ! cache->is_loaded(0, 1) );
+    cache->request(0, 1);
+    cache->cycle();
+    CK( cache->take_pending() == 0 );
+
+    cache->start();
+    kit = wait_pending();
+    BOOST_REQUIRE( kit != 0 );
+    CK( kit->uri == kit_uri(1) );
+
+    // The rest is preloaded.
+    CK( wait_loaded(2, true) );
+    cache->stop();
+    CK( cache->memory_used() == 3 * bytes );
+
+    // A hit is ready in the same cycle, and only once.
+    kit = hit(2);
+    BOOST_REQUIRE( kit != 0 );
+    CK( kit->uri == kit_uri(2) );
+    CK( hit(2) == 0 );
+
+    // Programs without a preset are ignored.
+    CK( hit(9) == 0 );
+    CK( ! cache->is_loaded(0, 9) );
+}
+
+TEST_CASE( 020_eviction_order )
+{
+    set_programs(4);
+    DrumkitCache::Kit* kit = cache->load_now(kit_uri(0));
+    BOOST_REQUIRE( kit != 0 );
+    size_t bytes = kit->bytes;
+    CK( cache->load_now(kit_uri(1)) != 0 );
+    CK( cache->load_now(kit_uri(2)) != 0 );
+
+    // Use them in the order 1, 0, 2.  2 is the current kit.
+    CK( hit(1) != 0 );
+    CK( hit(0) != 0 );
+    CK( hit(2) != 0 );
+
+    // Room for 3 kits.  Loading 3 evicts the least recently used
+    // kit (1).
+    cache->set_memory_limit( 3 * bytes + bytes / 2 );
+    cache->cycle();
+    cache->request(0, 3);
+    cache->start();
+    kit = wait_pending();
+    BOOST_REQUIRE( kit != 0 );
+    CK( kit->uri == kit_uri(3) );
+    CK( wait_loaded(1, false) );
+    CK( cache->is_loaded(0, 0) );
+    CK( cache->is_loaded(0, 2) );
+    CK( cache->is_loaded(0, 3) );
+
+    // Now 0 is the oldest.  The current kit (3) is never evicted.
+    cache->cycle();
+    cache->request(0, 1);
+    CK( wait_loaded(1, true) );
+    CK( wait_loaded(0, false) );
+    CK( cache->is_loaded(0, 2) );
+    CK( cache->is_loaded(0, 3) );
+    cache->stop();
+    CK( cache->memory_used() == 3 * bytes );
+}
+
+TEST_CASE( 030_retire_referenced )
+{
+    set_programs(3);
+    DrumkitCache::Kit* kit = cache->load_now(kit_uri(0));
+    BOOST_REQUIRE( kit != 0 );
+    size_t bytes = kit->bytes;
+    T<InstrumentList>::weak_ptr first = kit->instruments;
+    CK( cache->load_now(kit_uri(1)) != 0 );  // The current kit
+
+    // Room for 2 kits.  Loading 2 evicts 0.  The audio thread may
+    // have read it in this cycle, so it is not freed until it did
+    // two more.
+    cache->set_memory_limit( 2 * bytes + bytes / 2 );
+    cache->cycle();
+    cache->request(0, 2);
+    cache->start();
+    CK( wait_loaded(2, true) );
+    CK( wait_loaded(0, false) );
+    usleep(100000);
+    CK( ! first.expired() );
+
+    cache->cycle();
+    usleep(100000);
+    CK( ! first.expired() );
+
+    cache->cycle();
+    for( int k=0 ; k<1000 && ! first.expired() ; ++k ) {
+	usleep(10000);
+    }
+    CK( first.expired() );
+}
+
+TEST_END()
@@ -0,0 +1,176 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * t_DrumkitLoader.cpp
+ *
+ * Tests the parallel sample loader used by Engine::loadDrumkit().
+ */
+
+#include "../src/DrumkitLoader.hpp"
+#include <Tritium/Engine.hpp>
+#include <Tritium/Preferences.hpp>
+#include <Tritium/Instrument.hpp>
+#include <Tritium/InstrumentLayer.hpp>
+#include <Tritium/InstrumentList.hpp>
+#include <Tritium/ADSR.hpp>
+#include <Tritium/Sample.hpp>
+#include <Tritium/SoundLibrary.hpp>
+#include <Tritium/LocalFileMng.hpp>
+#include <Tritium/Logger.hpp>
+#include <Tritium/memory.hpp>
+
+// CHANGE THIS TO MATCH YOUR FILE:
+#define THIS_NAMESPACE t_DrumkitLoader
+#include "test_macros.hpp"
+#include "test_config.hpp"
+
+using namespace Tritium;
+
+namespace THIS_NAMESPACE
+{
+    const char drumkit_dir[] = TEST_DATA_DIR "/t_Serialization-drumkit";
+    const char sine_wav_file[] =
+	TEST_DATA_DIR "/samples/sine_480.46875_hz.wav";
+    const char missing_file[] =
+	TEST_DATA_DIR "/samples/really_unlikely_filename.wav";
+
+    struct Fixture
+    {
+	T<Engine>::auto_ptr engine;
+
+	Fixture() {
+	    Logger::create_instance();
+	    T<Preferences>::shared_ptr prefs(new Preferences);
+	    engine.reset( new Engine(prefs) );
+	}
+	~Fixture() {
+	    engine.reset();
+	    delete Logger::get_instance();
+	}
+
+	/// An instrument whose layers only have file names.
+	T<Instrument>::shared_ptr placeholder(const char* file, unsigned layers) {
+	    T<Instrument>::shared_ptr I(
+		new Instrument( "1", "Placeholder", new ADSR() )
+		);
+	    for( unsigned k=0 ; k<layers ; ++k ) {
+		T<Sample>::shared_ptr s( new Sample(0, file, 0) );
+		InstrumentLayer *L = new InstrumentLayer(s);
+		L->set_velocity_range( float(k) / layers, float(k+1) / layers );
+		L->set_gain( 0.5f );
+		I->set_layer( L, k );
+	    }
+	    return I;
+	}
+    };
+
+} // namespace THIS_NAMESPACE
+
+TEST_BEGIN( Fixture );
+
+TEST_CASE( 010_load_placeholders )
+{
+    DrumkitLoader loader( engine.get(), 4 );
+    T<Instrument>::shared_ptr a = placeholder(sine_wav_file, 3);
+    T<Instrument>::shared_ptr b = placeholder(sine_wav_file, 1);
+
+    CK( loader.add(a) == 0 );
+    CK( loader.add(b) == 1 );
+    loader.load();
+    CK( loader.errors() == 0 );
+
+    InstrumentLayer* layers[MAX_LAYERS];
+    loader.take_layers( 0, layers );
+    for( unsigned k=0 ; k<MAX_LAYERS ; ++k ) {
+	if( k < 3 ) {
+	    BOOST_REQUIRE( layers[k] );
+	    CK( layers[k] != a->get_layer(k) );
+	    CK( layers[k]->get_sample()->get_n_frames() == 24576 );
+	    CK( layers[k]->get_gain() == 0.5f );
+	    CK( layers[k]->get_min_velocity() == a->get_layer(k)->get_min_velocity() );
+	    CK( layers[k]->get_max_velocity() == a->get_layer(k)->get_max_velocity() );
+	} else {
+	    CK( layers[k] == 0 );
+	}
+    }
+
+    // Swap them in; the placeholder's layers come back out.
+    T<Instrument>::shared_ptr live = Instrument::create_empty();
+    delete live->swap_from_placeholder( a, layers );
+    CK( live->get_name() == "Placeholder" );
+    CK( live->get_layer(0)->get_sample()->get_n_frames() == 24576 );
+    for( unsigned k=0 ; k<MAX_LAYERS ; ++k ) {
+	CK( layers[k] == 0 );
+    }
+
+    loader.take_layers( 1, layers );
+    BOOST_REQUIRE( layers[0] );
+    CK( layers[0]->get_sample()->get_n_frames() == 24576 );
+    delete layers[0];
+}
+
+TEST_CASE( 020_missing_sample )
+{
+    DrumkitLoader loader( engine.get(), 2 );
+    loader.add( placeholder(missing_file, 2) );
+    loader.load();
+    CK( loader.errors() == 2 );
+
+    InstrumentLayer* layers[MAX_LAYERS];
+    loader.take_layers( 0, layers );
+    for( unsigned k=0 ; k<MAX_LAYERS ; ++k ) {
+	CK( layers[k] == 0 );
+    }
+}
+
+TEST_CASE( 030_decoded_samples_are_shared )
+{
+    LocalFileMng mgr( engine.get() );
+    T<Drumkit>::shared_ptr dk = mgr.loadDrumkit( drumkit_dir );
+    BOOST_REQUIRE( dk );
+    T<InstrumentList>::shared_ptr list = dk->getInstrumentList();
+    BOOST_REQUIRE( list->get_size() > 0 );
+
+    DrumkitLoader loader( engine.get() );
+    for( unsigned k=0 ; k<list->get_size() ; ++k ) {
+	loader.add( list->get(k) );
+    }
+    loader.load();
+    CK( loader.errors() == 0 );
+
+    InstrumentLayer* layers[MAX_LAYERS];
+    for( unsigned k=0 ; k<list->get_size() ; ++k ) {
+	loader.take_layers( k, layers );
+	for( unsigned j=0 ; j<MAX_LAYERS ; ++j ) {
+	    InstrumentLayer *orig = list->get(k)->get_layer(j);
+	    if( orig && orig->get_sample() ) {
+		BOOST_REQUIRE( layers[j] );
+		CK( layers[j]->get_sample() == orig->get_sample() );
+	    } else {
+		CK( layers[j] == 0 );
+	    }
+	    delete layers[j];
+	}
+    }
+}
+
+TEST_END()
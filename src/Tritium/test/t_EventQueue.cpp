@@ -0,0 +1,200 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * t_EventQueue.cpp
+ *
+ * Tests the queue that the engine uses to talk to the GUI.
+ */
+
+#include <Tritium/EventQueue.hpp>
+#include <QThread>
+#include <vector>
+
+// CHANGE THIS TO MATCH YOUR FILE:
+#define THIS_NAMESPACE t_EventQueue
+#include "test_macros.hpp"
+
+using namespace Tritium;
+
+namespace THIS_NAMESPACE
+{
+    const int PRODUCERS = 4;
+    const int EVENTS_EACH = 5000;
+
+    /// Pushes EVENTS_EACH events, with value (id, sequence).
+    class Producer : public QThread
+    {
+    public:
+	Producer(EventQueue& q, int id) : _q(q), _id(id) {}
+
+	void run() {
+	    Event ev( EVENT_NOTEON );
+	    ev.instrument = _id;
+	    for( int k=0 ; k<EVENTS_EACH ; ++k ) {
+		ev.value = k;
+		while( ! _q.push_event(ev) ) {
+		    yieldCurrentThread();
+		}
+	    }
+	}
+
+    private:
+	EventQueue& _q;
+	int _id;
+    };
+
+    struct Fixture
+    {
+	EventQueue q;
+
+	Fixture() : q(8) {}
+    };
+
+} // namespace THIS_NAMESPACE
+
+TEST_BEGIN( Fixture );
+
+TEST_CASE( 010_fifo_and_payload )
+{
+    CK( q.get_capacity() == 8 );
+    CK( q.pop_event().type == EVENT_NONE );
+
+    Event ev( EVENT_PROGRESS, 42 );
+    ev.fvalue = 0.5f;
+    ev.instrument = 3;
+    CK( q.push_event(ev) );
+    CK( q.push_event(EVENT_STATE, 2) );
+
+    Event out = q.pop_event();
+    CK( out.type == EVENT_PROGRESS );
+    CK( out.value == 42 );
+    CK( out.fvalue == 0.5f );
+    CK( out.instrument == 3 );
+    CK( out.count == 1 );
+    CK( out.time != 0 );
+
+    Event out2 = q.pop_event();
+    CK( out2.type == EVENT_STATE );
+    CK( out2.value == 2 );
+    CK( out2.instrument == -1 );
+    CK( out2.time >= out.time );
+    CK( q.pop_event().type == EVENT_NONE );
+}
+
+TEST_CASE( 020_full_queue_drops_new_events )
+{
+    int k;
+    for( k=0 ; k<8 ; ++k ) {
+	CK( q.push_event(EVENT_PROGRESS, k) );
+    }
+    CK( ! q.push_event(EVENT_PROGRESS, 8) );
+    CK( ! q.push_event(EVENT_ERROR, 9) );
+    CK( q.get_dropped() == 2 );
+    CK( q.get_dropped(EVENT_PROGRESS) == 1 );
+    CK( q.get_dropped(EVENT_ERROR) == 1 );
+    CK( q.get_dropped(EVENT_STATE) == 0 );
+
+    // The unread events are kept.
+    for( k=0 ; k<8 ; ++k ) {
+	Event ev = q.pop_event();
+	CK( ev.type == EVENT_PROGRESS );
+	CK( ev.value == k );
+    }
+    CK( q.pop_event().type == EVENT_NONE );
+
+    // ...and it works after wrapping around.
+    for( k=0 ; k<20 ; ++k ) {
+	CK( q.push_event(EVENT_STATE, k) );
+	CK( q.pop_event().value == k );
+    }
+}
+
+TEST_CASE( 030_activity_is_coalesced )
+{
+    int k;
+    for( k=0 ; k<100 ; ++k ) {
+	CK( q.push_event(EVENT_MIDI_ACTIVITY, -1) );
+    }
+    CK( q.push_event(EVENT_STATE, 1) );
+    for( k=0 ; k<5 ; ++k ) {
+	q.push_event(EVENT_MIDI_ACTIVITY, -1);
+    }
+
+    Event ev = q.pop_event();
+    CK( ev.type == EVENT_MIDI_ACTIVITY );
+    CK( ev.count == 105 );
+    CK( q.pop_event().type == EVENT_STATE );
+    CK( q.pop_event().type == EVENT_NONE );
+
+    // After a pop, the next one is queued again.
+    q.push_event(EVENT_MIDI_ACTIVITY, -1);
+    ev = q.pop_event();
+    CK( ev.type == EVENT_MIDI_ACTIVITY );
+    CK( ev.count == 1 );
+    CK( q.get_dropped() == 0 );
+
+    // If there's no room, all of them are dropped.
+    for( k=0 ; k<8 ; ++k ) {
+	q.push_event(EVENT_PROGRESS, k);
+    }
+    CK( ! q.push_event(EVENT_MIDI_ACTIVITY, -1) );
+    CK( q.get_dropped(EVENT_MIDI_ACTIVITY) == 1 );
+    for( k=0 ; k<8 ; ++k ) {
+	q.pop_event();
+    }
+    CK( q.push_event(EVENT_MIDI_ACTIVITY, -1) );
+    CK( q.pop_event().count == 1 );
+}
+
+TEST_CASE( 040_many_producers )
+{
+    EventQueue big(64);
+    std::vector<Producer*> producers;
+    std::vector<int> next(PRODUCERS, 0);
+    int k, received = 0;
+    bool in_order = true;
+
+    for( k=0 ; k<PRODUCERS ; ++k ) {
+	producers.push_back( new Producer(big, k) );
+	producers[k]->start();
+    }
+
+    while( received < PRODUCERS * EVENTS_EACH ) {
+	Event ev = big.pop_event();
+	if( ev.type == EVENT_NONE ) continue;
+	BOOST_REQUIRE( ev.type == EVENT_NOTEON );
+	BOOST_REQUIRE( ev.instrument >= 0 && ev.instrument < PRODUCERS );
+	if( ev.value != next[ev.instrument] ) in_order = false;
+	next[ev.instrument] = ev.value + 1;
+	++received;
+    }
+
+    for( k=0 ; k<PRODUCERS ; ++k ) {
+	producers[k]->wait();
+	delete producers[k];
+    }
+    CK( in_order );
+    CK( big.pop_event().type == EVENT_NONE );
+    CK( big.get_dropped() == unsigned(big.get_dropped(EVENT_NOTEON)) );
+}
+
+TEST_END()
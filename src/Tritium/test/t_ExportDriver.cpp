@@ -0,0 +1,215 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * t_ExportDriver.cpp
+ *
+ * Tests the offline export driver with a fake process callback.
+ */
+
+#include "../src/IO/ExportDriver.hpp"
+#include <Tritium/Engine.hpp>
+#include <Tritium/Preferences.hpp>
+#include <Tritium/ExportSettings.hpp>
+#include <Tritium/Logger.hpp>
+#include <Tritium/memory.hpp>
+#include <sndfile.h>
+#include <unistd.h>
+#include <cstdio>
+#include <vector>
+
+// CHANGE THIS TO MATCH YOUR FILE:
+#define THIS_NAMESPACE t_ExportDriver
+#include "test_macros.hpp"
+
+using namespace Tritium;
+
+namespace THIS_NAMESPACE
+{
+    const char out_file[] = "t_ExportDriver.out";
+
+    /// Writes 'level' to the left and -level to the right for the
+    /// first 'loud' frames, then silence.
+    struct Tone
+    {
+	ExportDriver* driver;
+	uint32_t frames;
+	uint32_t last;
+	uint32_t loud;
+	float level;
+
+	Tone() : driver(0), frames(0), last(0), loud(0), level(0.5f) {}
+    };
+
+    int tone_process(uint32_t nFrames, void* arg)
+    {
+	Tone* t = static_cast<Tone*>(arg);
+	float* L = t->driver->getOut_L();
+	float* R = t->driver->getOut_R();
+	for( uint32_t k=0 ; k<nFrames ; ++k ) {
+	    L[k] = (t->frames + k < t->loud) ? t->level : 0.0f;
+	    R[k] = -L[k];
+	}
+	t->frames += nFrames;
+	t->last = nFrames;
+	return 0;
+    }
+
+    struct Fixture
+    {
+	T<Engine>::auto_ptr engine;
+	Tone tone;
+
+	Fixture() {
+	    Logger::create_instance();
+	    T<Preferences>::shared_ptr prefs(new Preferences);
+	    engine.reset( new Engine(prefs) );
+	}
+	~Fixture() {
+	    engine.reset();
+	    delete Logger::get_instance();
+	    remove(out_file);
+	}
+
+	ExportSettings settings(unsigned block, float tail) {
+	    ExportSettings s(out_file);
+	    s.sample_rate = 44100;
+	    s.block_size = block;
+	    s.tail_seconds = tail;
+	    return s;
+	}
+
+	/// Render 'song_frames' and wait for the file.  Returns
+	/// true if the file could not be written.
+	bool run(const ExportSettings& s, uint32_t song_frames) {
+	    ExportDriver drv( engine.get(), tone_process, &tone, s, song_frames );
+	    tone.driver = &drv;
+	    BOOST_REQUIRE( drv.init(s.block_size) == 0 );
+	    BOOST_REQUIRE( drv.connect() == 0 );
+	    int waited = 0;
+	    while( ! drv.finished() && waited < 10000 ) {
+		usleep(1000);
+		++waited;
+	    }
+	    BOOST_REQUIRE( drv.finished() );
+	    drv.disconnect();
+	    tone.driver = 0;
+	    return drv.failed();
+	}
+
+	/// Read back the exported file (interleaved).
+	std::vector<float> read_back(SF_INFO& info) {
+	    std::vector<float> data;
+	    SNDFILE* f = sf_open(out_file, SFM_READ, &info);
+	    BOOST_REQUIRE( f );
+	    data.resize(info.frames * info.channels);
+	    if( info.frames ) {
+		sf_readf_float(f, &data[0], info.frames);
+	    }
+	    sf_close(f);
+	    return data;
+	}
+    };
+
+} // namespace THIS_NAMESPACE
+
+TEST_BEGIN( Fixture );
+
+TEST_CASE( 010_song_length )
+{
+    ExportSettings s = settings(4096, 0.0f);
+    tone.loud = 100000;
+    CK( ! run(s, 10000) );
+
+    CK( tone.frames == 10000 );
+    CK( tone.last == 10000 - 8192 );
+
+    SF_INFO info;
+    std::vector<float> data = read_back(info);
+    CK( info.frames == 10000 );
+    CK( info.channels == 2 );
+    CK( info.samplerate == 44100 );
+    CK( info.format == (SF_FORMAT_WAV | SF_FORMAT_PCM_16) );
+    CK( data[0] > 0.49f && data[0] < 0.51f );
+    CK( data[1] < -0.49f && data[1] > -0.51f );
+    CK( data[2*9999] > 0.49f );
+}
+
+TEST_CASE( 020_tail_until_silent )
+{
+    ExportSettings s = settings(4096, 10.0f);
+    s.sample_format = ExportSettings::FLOAT;
+    tone.loud = 9000;
+    tone.level = 1.5f;
+    CK( ! run(s, 5000) );
+
+    // Song: 4096 + 904.  Tail: 4096 (loud until 9000), then a
+    // silent block that is not written.
+    SF_INFO info;
+    std::vector<float> data = read_back(info);
+    CK( info.format == (SF_FORMAT_WAV | SF_FORMAT_FLOAT) );
+    CK( info.frames == 5000 + 4096 );
+    CK( tone.frames == 5000 + 4096 * 2 );
+    CK( data[0] == 1.5f );   // Float isn't clipped
+    CK( data[2*8999 + 1] == -1.5f );
+    CK( data[2*9000] == 0.0f );
+}
+
+TEST_CASE( 030_tail_limit )
+{
+    ExportSettings s = settings(1024, 0.1f);
+    s.sample_format = ExportSettings::PCM_24;
+    tone.loud = 1000000;
+    tone.level = 1.5f;
+    CK( ! run(s, 3000) );
+
+    SF_INFO info;
+    std::vector<float> data = read_back(info);
+    CK( info.format == (SF_FORMAT_WAV | SF_FORMAT_PCM_24) );
+    CK( info.frames == 3000 + 4410 );
+    CK( data[0] <= 1.0f );   // Integer formats are clipped
+    CK( data[0] > 0.99f );
+}
+
+TEST_CASE( 040_formats )
+{
+    ExportSettings s("song.FLAC");
+    CK( s.format == ExportSettings::FLAC );
+    CK( ExportDriver::sf_format(s) == (SF_FORMAT_FLAC | SF_FORMAT_PCM_16) );
+    s.sample_format = ExportSettings::FLOAT;
+    CK( ExportDriver::sf_format(s) == (SF_FORMAT_FLAC | SF_FORMAT_PCM_24) );
+    s = ExportSettings("song.wav");
+    CK( s.format == ExportSettings::WAV );
+    s.sample_format = ExportSettings::FLOAT;
+    CK( ExportDriver::sf_format(s) == (SF_FORMAT_WAV | SF_FORMAT_FLOAT) );
+}
+
+TEST_CASE( 050_bad_file )
+{
+    ExportSettings s = settings(4096, 0.0f);
+    s.filename = "/really/unlikely/directory/t_ExportDriver.wav";
+    tone.loud = 100000;
+    CK( run(s, 100000) );
+    // Gives up without rendering the whole song.
+    CK( tone.frames < 100000 );
+}
+
+TEST_END()
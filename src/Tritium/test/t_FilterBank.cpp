@@ -0,0 +1,174 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * t_FilterBank.cpp
+ *
+ * Tests the Sampler's voice filters.
+ */
+
+#include "../src/FilterBank.hpp"
+#include <vector>
+#include <cstdlib>
+
+// CHANGE THIS TO MATCH YOUR FILE:
+#define THIS_NAMESPACE t_FilterBank
+#include "test_macros.hpp"
+
+using namespace Tritium;
+
+namespace THIS_NAMESPACE
+{
+    const uint32_t N = VoiceKernels::BLOCK_SIZE;
+
+    struct Fixture
+    {
+	FilterBank bank;
+	std::vector<float> in_L, in_R, env;
+
+	Fixture() : bank(16), in_L(N), in_R(N), env(N) {
+	    srand(4321);
+	    for( uint32_t k=0 ; k<N ; ++k ) {
+		in_L[k] = float(rand()) / RAND_MAX * 2.0f - 1.0f;
+		in_R[k] = float(rand()) / RAND_MAX * 2.0f - 1.0f;
+		env[k] = 0.5f;
+	    }
+	}
+
+	/// The Sampler's old per-voice filter of in * env.
+	void reference(const std::vector<float>& in, float cut, float res,
+		       float& bp, float& lp, std::vector<float>& out) {
+	    out.resize(N);
+	    for( uint32_t k=0 ; k<N ; ++k ) {
+		bp = res * bp + cut * ( in[k] * env[k] - lp );
+		lp += cut * bp;
+		out[k] = lp;
+	    }
+	}
+
+	/// Filter one window of voice v (alone in a group).
+	void window(int v, float cut, float res,
+		    std::vector<float>& out_L, std::vector<float>& out_R) {
+	    FilterBank::Group g(bank);
+	    unsigned j = g.add(v, cut, res);
+	    g.clear(N);
+	    g.write(j, 0, &in_L[0], &in_R[0], &env[0], N);
+	    g.run(N);
+	    out_L.resize(N);
+	    out_R.resize(N);
+	    g.read(j, 0, &out_L[0], &out_R[0], N);
+	}
+    };
+
+} // namespace THIS_NAMESPACE
+
+TEST_BEGIN( Fixture );
+
+TEST_CASE( 010_same_as_voice_filter )
+{
+    FilterBank::Group g(bank);
+    std::vector<float> ref_L, ref_R;
+    float out_L[N], out_R[N];
+    unsigned j;
+
+    g.clear(N);
+    for( j=0 ; j<FilterBank::VOICES ; ++j ) {
+	CK( ! g.full() );
+	CK( g.add(3 + j, 0.2f * (j + 1), 0.5f) == j );
+	g.write(j, 10, &in_L[0], &in_R[0], &env[0], N - 10);
+    }
+    CK( g.full() );
+    CK( g.size() == unsigned(FilterBank::VOICES) );
+    g.run(N);
+
+    for( j=0 ; j<FilterBank::VOICES ; ++j ) {
+	float bp = 0.0f, lp = 0.0f;
+	reference(in_L, 0.2f * (j + 1), 0.5f, bp, lp, ref_L);
+	bp = lp = 0.0f;
+	reference(in_R, 0.2f * (j + 1), 0.5f, bp, lp, ref_R);
+
+	g.read(j, 0, out_L, out_R, N);
+	CK( out_L[9] == 0.0f );
+	bool same = true;
+	for( uint32_t k=10 ; k<N ; ++k ) {
+	    if( out_L[k] != ref_L[k-10] ) same = false;
+	    if( out_R[k] != ref_R[k-10] ) same = false;
+	}
+	CK( same );
+    }
+}
+
+TEST_CASE( 020_state_is_kept )
+{
+    std::vector<float> ref_L, ref_R, out_L, out_R;
+    float bp_L = 0.0f, lp_L = 0.0f, bp_R = 0.0f, lp_R = 0.0f;
+
+    // Two cycles in separate groups continue the same filter.
+    reference(in_L, 0.3f, 0.7f, bp_L, lp_L, ref_L);
+    reference(in_R, 0.3f, 0.7f, bp_R, lp_R, ref_R);
+    window(5, 0.3f, 0.7f, out_L, out_R);
+    CK( out_L == ref_L );
+    CK( out_R == ref_R );
+
+    reference(in_L, 0.3f, 0.7f, bp_L, lp_L, ref_L);
+    reference(in_R, 0.3f, 0.7f, bp_R, lp_R, ref_R);
+    window(5, 0.3f, 0.7f, out_L, out_R);
+    CK( out_L == ref_L );
+    CK( out_R == ref_R );
+
+    // A new note starts from silence.
+    bank.reset(5);
+    bp_L = lp_L = bp_R = lp_R = 0.0f;
+    reference(in_L, 0.3f, 0.7f, bp_L, lp_L, ref_L);
+    window(5, 0.3f, 0.7f, out_L, out_R);
+    CK( out_L == ref_L );
+}
+
+TEST_CASE( 030_coefficients_glide )
+{
+    std::vector<float> ref_L, out_L, out_R;
+    std::vector<float> sound(env), silence(N, 0.0f);
+    float bp = 0.0f, lp = 0.0f;
+    reference(in_L, 0.9f, 0.0f, bp, lp, ref_L);
+
+    // The first window sets the coefficients.  Silence keeps the
+    // state at zero.
+    env = silence;
+    window(2, 0.1f, 0.0f, out_L, out_R);
+    window(3, 0.1f, 0.0f, out_L, out_R);
+
+    // Cutoff 0.1 --> 0.9 takes 0.8 / SLEW frames, so the next
+    // window is not the new filter yet...
+    env = sound;
+    window(3, 0.9f, 0.0f, out_L, out_R);
+    CK( out_L != ref_L );
+
+    // ...but it gets there.
+    env = silence;
+    for( uint32_t k=0 ; k<uint32_t(0.8f / FilterBank::SLEW) ; k+=N ) {
+	window(2, 0.9f, 0.0f, out_L, out_R);
+    }
+    env = sound;
+    window(2, 0.9f, 0.0f, out_L, out_R);
+    CK( out_L == ref_L );
+}
+
+TEST_END()
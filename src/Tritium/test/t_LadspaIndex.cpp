@@ -0,0 +1,191 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * t_LadspaIndex.cpp
+ *
+ * Tests the LADSPA plugin index with the library built from
+ * t_LadspaIndex_plugin.cpp.
+ */
+
+#include "../src/fx/LadspaIndex.hpp"
+#include <Tritium/fx/LadspaFX.hpp>
+#include <Tritium/Logger.hpp>
+#include <QDir>
+#include <QFile>
+#include <vector>
+
+// CHANGE THIS TO MATCH YOUR FILE:
+#define THIS_NAMESPACE t_LadspaIndex
+#include "test_macros.hpp"
+#include "test_config.hpp"
+
+using namespace Tritium;
+
+namespace THIS_NAMESPACE
+{
+    const char plugin_file[] = TEST_BIN_DIR "/t_LadspaIndex_plugin.so";
+    const char plugin_dir[] = TEST_BIN_DIR "/t_LadspaIndex-plugins";
+    const char index_file[] = TEST_BIN_DIR "/t_LadspaIndex.index";
+
+    struct Fixture
+    {
+	QString lib;
+	std::vector<QString> paths;
+	std::vector<LadspaFXInfo*> plugins;
+
+	Fixture() : lib( QString(plugin_dir) + "/t_LadspaIndex_plugin.so" ) {
+	    Logger::create_instance();
+	    QDir().mkpath(plugin_dir);
+	    QFile::remove(lib);
+	    QFile::remove(index_file);
+	    QFile::copy(plugin_file, lib);
+	    paths.push_back(plugin_dir);
+	}
+	~Fixture() {
+	    clear();
+	    QFile::remove(lib);
+	    QFile::remove(index_file);
+	    QDir().rmdir(plugin_dir);
+	    delete Logger::get_instance();
+	}
+
+	void clear() {
+	    for( size_t k=0 ; k<plugins.size() ; ++k ) {
+		delete plugins[k];
+	    }
+	    plugins.clear();
+	}
+
+	/// Refill 'plugins' from the index.
+	void get(LadspaIndex& index) {
+	    clear();
+	    index.getPlugins(plugins);
+	}
+
+	/// The plugins of t_LadspaIndex_plugin.cpp, sorted by name.
+	void check_plugins() {
+	    BOOST_REQUIRE( plugins.size() == 2 );
+
+	    LadspaFXInfo* mono = plugins[0];
+	    CK( mono->m_sName == "Test Mono" );
+	    CK( mono->m_sLabel == "t_mono" );
+	    CK( mono->m_sID == "9002" );
+	    CK( mono->m_sMaker == "Tritium" );
+	    CK( mono->m_sCopyright == "GPL" );
+	    CK( mono->m_sFilename == lib );
+	    CK( mono->m_nIAPorts == 1 );
+	    CK( mono->m_nOAPorts == 1 );
+	    CK( mono->m_nICPorts == 0 );
+	    CK( mono->m_nOCPorts == 1 );
+
+	    LadspaFXInfo* stereo = plugins[1];
+	    CK( stereo->m_sName == "Test Stereo" );
+	    CK( stereo->m_sLabel == "t_stereo" );
+	    CK( stereo->m_sID == "9001" );
+	    CK( stereo->m_sFilename == lib );
+	    CK( stereo->m_nIAPorts == 2 );
+	    CK( stereo->m_nOAPorts == 2 );
+	    CK( stereo->m_nICPorts == 1 );
+	    CK( stereo->m_nOCPorts == 0 );
+	}
+    };
+
+} // namespace THIS_NAMESPACE
+
+TEST_BEGIN( Fixture );
+
+TEST_CASE( 010_scan )
+{
+    LadspaIndex index(index_file);
+    CK( ! index.load() );
+    CK( index.scan(paths) );
+    get(index);
+    check_plugins();
+
+    // Nothing changed.
+    CK( ! index.scan(paths) );
+    get(index);
+    check_plugins();
+}
+
+TEST_CASE( 020_round_trip )
+{
+    {
+	LadspaIndex index(index_file);
+	CK( index.scan(paths) );
+	CK( index.save() );
+    }
+
+    LadspaIndex index(index_file);
+    CK( index.load() );
+    get(index);
+    check_plugins();
+
+    // The library is not loaded again.
+    CK( ! index.scan(paths) );
+    get(index);
+    check_plugins();
+}
+
+TEST_CASE( 030_changed_library )
+{
+    {
+	LadspaIndex index(index_file);
+	CK( index.scan(paths) );
+	CK( index.save() );
+    }
+
+    // A new build of the library (a different size).
+    QFile f(lib);
+    BOOST_REQUIRE( f.open(QIODevice::Append) );
+    f.write("\0\0\0\0", 4);
+    f.close();
+
+    LadspaIndex index(index_file);
+    CK( index.load() );
+    CK( index.scan(paths) );
+    get(index);
+    check_plugins();
+    CK( ! index.scan(paths) );
+
+    // A removed library.
+    QFile::remove(lib);
+    CK( index.scan(paths) );
+    get(index);
+    CK( plugins.empty() );
+}
+
+TEST_CASE( 040_bad_index )
+{
+    QFile f(index_file);
+    BOOST_REQUIRE( f.open(QIODevice::WriteOnly) );
+    f.write("not an index");
+    f.close();
+
+    LadspaIndex index(index_file);
+    CK( ! index.load() );
+    CK( index.scan(paths) );
+    get(index);
+    check_plugins();
+}
+
+TEST_END()
@@ -0,0 +1,83 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * t_LadspaIndex_plugin.cpp
+ *
+ * A LADSPA library for t_LadspaIndex to index.  It only has
+ * descriptors: the plugins are never instantiated.
+ */
+
+#include <Tritium/fx/ladspa.h>
+#include <cstddef>
+
+namespace
+{
+    const LADSPA_PortDescriptor stereo_ports[] = {
+	LADSPA_PORT_INPUT | LADSPA_PORT_AUDIO,
+	LADSPA_PORT_INPUT | LADSPA_PORT_AUDIO,
+	LADSPA_PORT_OUTPUT | LADSPA_PORT_AUDIO,
+	LADSPA_PORT_OUTPUT | LADSPA_PORT_AUDIO,
+	LADSPA_PORT_INPUT | LADSPA_PORT_CONTROL,
+    };
+
+    const LADSPA_PortDescriptor mono_ports[] = {
+	LADSPA_PORT_INPUT | LADSPA_PORT_AUDIO,
+	LADSPA_PORT_OUTPUT | LADSPA_PORT_AUDIO,
+	LADSPA_PORT_OUTPUT | LADSPA_PORT_CONTROL,
+    };
+
+    // Not mono or stereo, so the index leaves it out.
+    const LADSPA_PortDescriptor generator_ports[] = {
+	LADSPA_PORT_OUTPUT | LADSPA_PORT_AUDIO,
+    };
+
+    LADSPA_Descriptor make(unsigned long id,
+			   const char* label,
+			   const char* name,
+			   unsigned long port_count,
+			   const LADSPA_PortDescriptor* ports)
+    {
+	LADSPA_Descriptor d = LADSPA_Descriptor();
+	d.UniqueID = id;
+	d.Label = label;
+	d.Name = name;
+	d.Maker = "Tritium";
+	d.Copyright = "GPL";
+	d.PortCount = port_count;
+	d.PortDescriptors = ports;
+	return d;
+    }
+
+    const LADSPA_Descriptor descriptors[] = {
+	make(9001, "t_stereo", "Test Stereo", 5, stereo_ports),
+	make(9002, "t_mono", "Test Mono", 3, mono_ports),
+	make(9003, "t_generator", "Test Generator", 1, generator_ports),
+    };
+} // anonymous namespace
+
+extern "C" const LADSPA_Descriptor* ladspa_descriptor(unsigned long index)
+{
+    if( index < sizeof(descriptors) / sizeof(descriptors[0]) ) {
+	return &descriptors[index];
+    }
+    return NULL;
+}
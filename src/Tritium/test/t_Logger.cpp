@@ -0,0 +1,107 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * t_Logger.cpp
+ *
+ * Tests logging from real-time threads.
+ */
+
+#include <Tritium/Logger.hpp>
+#include <cstring>
+
+// CHANGE THIS TO MATCH YOUR FILE:
+#define THIS_NAMESPACE t_Logger
+#include "test_macros.hpp"
+
+using namespace Tritium;
+
+namespace THIS_NAMESPACE
+{
+    struct Fixture
+    {
+	unsigned old_level;
+
+	Fixture() {
+	    Logger::create_instance();
+	    old_level = Logger::get_log_level();
+	}
+	~Fixture() {
+	    Logger::set_log_level(old_level);
+	    delete Logger::get_instance();
+	}
+    };
+
+} // namespace THIS_NAMESPACE
+
+TEST_BEGIN( Fixture );
+
+TEST_CASE( 010_message_arguments )
+{
+    const char fmt[] = "%1 %2 %3 %4";
+    RtLogMessage m(fmt);
+    m << -3 << 7u << 0.25 << "abc" << "ignored";
+
+    CK( m.format == fmt );
+    BOOST_REQUIRE( m.nargs == 4 );
+    CK( m.args[0].type == RtLogMessage::Int );
+    CK( m.args[0].i == -3 );
+    CK( m.args[1].type == RtLogMessage::UInt );
+    CK( m.args[1].u == 7 );
+    CK( m.args[2].type == RtLogMessage::Double );
+    CK( m.args[2].d == 0.25 );
+    CK( m.args[3].type == RtLogMessage::String );
+    CK( 0 == strcmp(m.args[3].s, "abc") );
+
+    // Floats are doubles, and long strings are cut.
+    char long_string[RtLogMessage::MAX_STRING * 2];
+    memset( long_string, 'x', sizeof(long_string) );
+    long_string[sizeof(long_string) - 1] = 0;
+    RtLogMessage n("%1 %2");
+    n << 1.5f << long_string;
+    CK( n.args[0].type == RtLogMessage::Double );
+    CK( n.args[0].d == 1.5 );
+    CK( strlen(n.args[1].s) == RtLogMessage::MAX_STRING - 1 );
+}
+
+TEST_CASE( 020_rate_limit )
+{
+    Logger::set_log_level( Logger::Error );
+    unsigned suppressed = Logger::get_instance()->get_rt_suppressed();
+
+    // Below the log level: not even counted.
+    for( int k=0 ; k<100 ; ++k ) {
+	RT_WARNINGLOG( RtLogMessage("t_Logger: not logged %1") << k );
+    }
+    CK( Logger::get_instance()->get_rt_suppressed() == suppressed );
+
+    // One call site, many times.  Only a few per second get
+    // through.  (Allow for crossing into the next second.)
+    for( int k=0 ; k<100 ; ++k ) {
+	RT_ERRORLOG( RtLogMessage("t_Logger: rate limited %1") << k );
+    }
+    unsigned n = Logger::get_instance()->get_rt_suppressed() - suppressed;
+    CK( n >= 80 );
+    CK( n <= 90 );
+    CK( Logger::get_instance()->get_rt_dropped() == 0 );
+}
+
+TEST_END()
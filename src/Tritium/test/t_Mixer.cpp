@@ -27,6 +27,7 @@
 #include <Tritium/MixerImpl.hpp>
 #include <Tritium/AudioPort.hpp>
 #include <cstring>
+#include <cmath>
 #include <QString>
 
 // CHANGE THIS TO MATCH YOUR FILE:
@@ -259,4 +260,117 @@ TEST_CASE( 040_channel_methods )
 
 }
 
+TEST_CASE( 050_gain_ramp )
+{
+    T<AudioPort>::shared_ptr mono;
+    mono = m->allocate_port("mono", AudioPort::OUTPUT, AudioPort::MONO);
+    T<Mixer::Channel>::shared_ptr chan = m->channel(0);
+
+    float left[256], right[256];
+    float peak_L, peak_R;
+    size_t k, N=256;
+
+    // The first cycle is not ramped.
+    float* buf;
+    m->pre_process(N);
+    buf = mono->get_buffer();
+    for(k=0 ; k<N ; ++k) {
+	buf[k] = 0.5f;
+    }
+    m->mix_down(N, left, right, &peak_L, &peak_R);
+    for(k=0 ; k<N ; ++k) {
+	CK( left[k] == 0.5f );
+	CK( right[k] == 0.5f );
+    }
+    CK( peak_L == 0.5f );
+    CK( peak_R == 0.5f );
+
+    // A gain change is ramped over the next cycle...
+    chan->gain(0.0f);
+    m->pre_process(N);
+    buf = mono->get_buffer();
+    for(k=0 ; k<N ; ++k) {
+	buf[k] = 0.5f;
+    }
+    m->mix_down(N, left, right);
+    CK( left[0] < 0.5f );
+    CK( left[0] > 0.49f );
+    for(k=1 ; k<N ; ++k) {
+	CK( left[k] < left[k-1] );
+	CK( right[k] == left[k] );
+    }
+    CK( ::fabs(left[N-1]) < 1.0e-6f );
+
+    // ...and then it stays there.
+    m->pre_process(N);
+    buf = mono->get_buffer();
+    for(k=0 ; k<N ; ++k) {
+	buf[k] = 0.5f;
+    }
+    m->mix_down(N, left, right);
+    for(k=0 ; k<N ; ++k) {
+	CK( left[k] == 0.0f );
+	CK( right[k] == 0.0f );
+    }
+
+    m->release_port(mono);
+}
+
+TEST_CASE( 060_external_buffers )
+{
+    T<AudioPort>::shared_ptr stereo;
+    stereo = m->allocate_port("stereo", AudioPort::OUTPUT, AudioPort::STEREO);
+    T<Mixer::Channel>::shared_ptr chan = m->channel(0);
+    chan->gain(0.5f);
+
+    float out_L[256], out_R[256];
+    float left[256], right[256];
+    size_t k, N=256;
+
+    // Writes go straight to the external buffers...
+    stereo->set_buffers(out_L, out_R, N);
+    CK( stereo->size() == N );
+    memset(out_L, ~0, sizeof(out_L));
+    stereo->write_zeros();
+    for(k=0 ; k<N ; ++k) {
+	CK( out_L[k] == 0.0f );
+    }
+
+    m->pre_process(N);
+    CK( stereo->get_buffer(0) == out_L );
+    CK( stereo->get_buffer(1) == out_R );
+    for(k=0 ; k<N ; ++k) {
+	out_L[k] = 0.2f;
+	out_R[k] = 0.4f;
+    }
+
+    // ...and are left alone when they are pre-fader.
+    CK( m->post_fader_outs() == false );
+    m->mix_down(N, left, right);
+    for(k=0 ; k<N ; ++k) {
+	CK( left[k] == 0.1f );
+	CK( right[k] == 0.2f );
+	CK( out_L[k] == 0.2f );
+	CK( out_R[k] == 0.4f );
+    }
+
+    // Post-fader, they get the same gains as the mix.
+    m->post_fader_outs(true);
+    m->pre_process(N);
+    stereo->get_buffer();
+    m->mix_down(N, left, right);
+    for(k=0 ; k<N ; ++k) {
+	CK( out_L[k] == left[k] );
+	CK( out_R[k] == right[k] );
+	CK( out_L[k] == 0.1f );
+    }
+
+    // Back to its own buffers.
+    stereo->set_buffers(0, 0, 0);
+    CK( stereo->get_buffer() != out_L );
+    CK( stereo->size() > N );
+
+    m->release_port(stereo);
+}
+
 TEST_END()
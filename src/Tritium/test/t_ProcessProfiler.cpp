@@ -0,0 +1,222 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * t_ProcessProfiler.cpp
+ *
+ * Tests the timing of the engine's process() cycle.
+ */
+
+#include "../src/ProcessProfiler.hpp"
+#include <Tritium/ProcessProfile.hpp>
+#include <cmath>
+
+// CHANGE THIS TO MATCH YOUR FILE:
+#define THIS_NAMESPACE t_ProcessProfiler
+#include "test_macros.hpp"
+
+using namespace Tritium;
+
+namespace THIS_NAMESPACE
+{
+    const uint64_t us = 1000;
+    const uint64_t period = 5333 * us; // 256 frames @ 48 kHz
+
+    struct Fixture
+    {
+	ProcessProfiler prof;
+	uint64_t clock;
+
+	Fixture() : clock(1000000 * us) {}
+
+	/// A cycle where every stage takes 'stage' ns.
+	void cycle(uint64_t stage, unsigned voices = 0) {
+	    prof.begin_cycle( clock );
+	    for( int k = ProcessProfile::INPUT ; k < ProcessProfile::TOTAL ; ++k ) {
+		clock += stage;
+		prof.mark( ProcessProfile::stage_t(k), clock );
+	    }
+	    prof.end_cycle( period, voices, 0, clock );
+	    clock += period;
+	}
+
+	bool close(float a, float b) {
+	    return std::fabs(a - b) <= 1e-6f + 1e-4f * std::fabs(b);
+	}
+    };
+
+} // namespace THIS_NAMESPACE
+
+TEST_BEGIN( Fixture );
+
+TEST_CASE( 010_histogram_bins )
+{
+    CK( ProcessProfiler::bin(0) == 0 );
+    CK( ProcessProfiler::bin(999) == 0 );
+    CK( ProcessProfiler::bin(1000) == 1 );
+    CK( ProcessProfiler::bin(1189) == 1 );   // 2^(1/4) us = 1189.2 ns
+    CK( ProcessProfiler::bin(1190) == 2 );
+    CK( ProcessProfiler::bin(2 * us) == 5 );
+    CK( ProcessProfiler::bin(1024 * us) == 41 );
+    CK( ProcessProfiler::bin(1000000 * us) == ProcessProfile::HISTOGRAM_BINS - 1 );
+
+    // Each bin ends where the next starts.
+    for( unsigned k = 1 ; k < 60 ; ++k ) {
+	uint64_t end = uint64_t( ProcessProfile::bin_end(k) * 1000000.0 );
+	CK( ProcessProfiler::bin(end - 2) == k );
+	CK( ProcessProfiler::bin(end + 2) == k + 1 );
+    }
+    CK( close(ProcessProfile::bin_end(0), 0.001f) );
+    CK( close(ProcessProfile::bin_end(4), 0.002f) );
+}
+
+TEST_CASE( 020_stages )
+{
+    ProcessProfile p;
+    prof.get(p);
+    CK( p.cycles == 0 );
+    CK( p.window == 0 );
+    CK( p.stages[ProcessProfile::TOTAL].mean == 0.0f );
+
+    cycle( 100 * us, 12 );
+    cycle( 300 * us, 12 );
+    prof.get(p);
+    CK( p.cycles == 2 );
+    CK( p.window == 2 );
+    CK( p.voices == 12 );
+    CK( p.overruns == 0 );
+    CK( close(p.period, 5.333f) );
+    for( int k = ProcessProfile::INPUT ; k < ProcessProfile::TOTAL ; ++k ) {
+	const ProcessProfile::Stage& s = p.stages[k];
+	CK( close(s.last, 0.3f) );
+	CK( close(s.mean, 0.2f) );
+	CK( close(s.max, 0.3f) );
+	unsigned sum = 0;
+	for( unsigned b = 0 ; b < ProcessProfile::HISTOGRAM_BINS ; ++b ) {
+	    sum += s.histogram[b];
+	}
+	CK( sum == 2 );
+	CK( s.histogram[ ProcessProfiler::bin(100 * us) ] == 1 );
+    }
+    const ProcessProfile::Stage& total = p.stages[ProcessProfile::TOTAL];
+    CK( close(total.last, 1.5f) );
+    CK( close(total.mean, 1.0f) );
+    CK( close(total.max, 1.5f) );
+}
+
+TEST_CASE( 030_percentiles )
+{
+    // 990 fast cycles, 9 slow, and one very slow.
+    for( int k = 0 ; k < 990 ; ++k ) cycle( 10 * us );
+    for( int k = 0 ; k < 9 ; ++k ) cycle( 500 * us );
+    cycle( 2000 * us );
+
+    ProcessProfile p;
+    prof.get(p);
+    CK( p.window == 1000 );
+    CK( p.overruns == 1 ); // 5 * 2000 us > 5333 us
+
+    const ProcessProfile::Stage& s = p.stages[ProcessProfile::SAMPLER];
+    float fast = ProcessProfile::bin_end( ProcessProfiler::bin(10 * us) );
+    float slow = ProcessProfile::bin_end( ProcessProfiler::bin(500 * us) );
+    CK( close(s.p50, fast) );
+    CK( close(s.p99, fast) );
+    CK( close(s.p999, slow) );
+    CK( close(s.max, 2.0f) );
+
+    // Percentiles are never more than the max.
+    prof.reset();
+    cycle( 10 * us );
+    prof.get(p);
+    CK( p.stages[ProcessProfile::SAMPLER].p999 == p.stages[ProcessProfile::SAMPLER].max );
+}
+
+TEST_CASE( 040_window_rolls )
+{
+    const unsigned W = ProcessProfile::WINDOW_CYCLES;
+    ProcessProfile p;
+
+    cycle( 3000 * us ); // Slow
+    for( unsigned k = 1 ; k < W ; ++k ) cycle( 10 * us );
+    prof.get(p);
+    CK( p.window == W );
+    CK( close(p.stages[ProcessProfile::FX].max, 3.0f) );
+
+    // The slow cycle is in the older half until it is replaced.
+    for( unsigned k = 0 ; k < W ; ++k ) cycle( 10 * us );
+    prof.get(p);
+    CK( p.window == 2 * W );
+    CK( close(p.stages[ProcessProfile::FX].max, 3.0f) );
+
+    cycle( 10 * us );
+    prof.get(p);
+    CK( p.window == W + 1 );
+    CK( close(p.stages[ProcessProfile::FX].max, 0.01f) );
+    CK( p.cycles == 2 * W + 1 );
+    CK( p.overruns == 1 );
+}
+
+TEST_CASE( 050_instruments )
+{
+    prof.begin_cycle( clock );
+    prof.set_instrument( 0, 2, 40 * us );
+    prof.set_instrument( 1, 0, 0 );
+    prof.set_instrument( 2, 5, 90 * us );
+    prof.end_cycle( period, 7, 3, clock + 200 * us );
+    clock += period;
+
+    ProcessProfile p;
+    prof.get(p);
+    BOOST_REQUIRE( p.instruments.size() == 3 );
+    CK( p.instruments[0].voices == 2 );
+    CK( close(p.instruments[0].render, 0.04f) );
+    CK( p.instruments[1].voices == 0 );
+    CK( p.instruments[2].voices == 5 );
+    CK( close(p.instruments[2].render, 0.09f) );
+    CK( close(p.stages[ProcessProfile::TOTAL].last, 0.2f) );
+
+    prof.begin_cycle( clock );
+    prof.set_instrument( 0, 1, 10 * us );
+    prof.end_cycle( period, 1, 1, clock + 50 * us );
+    prof.get(p);
+    BOOST_REQUIRE( p.instruments.size() == 1 );
+    CK( close(p.instruments[0].render, 0.01f) );
+    CK( close(p.instruments[0].max, 0.04f) );
+}
+
+TEST_CASE( 060_reset )
+{
+    for( int k = 0 ; k < 10 ; ++k ) cycle( 2000 * us );
+    prof.reset();
+
+    ProcessProfile p;
+    prof.get(p);
+    CK( p.cycles == 10 ); // Until the next cycle
+
+    cycle( 10 * us );
+    prof.get(p);
+    CK( p.cycles == 1 );
+    CK( p.window == 1 );
+    CK( p.overruns == 0 );
+    CK( close(p.stages[ProcessProfile::TOTAL].max, 0.05f) );
+}
+
+TEST_END()
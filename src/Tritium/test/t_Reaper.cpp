@@ -0,0 +1,172 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * t_Reaper.cpp
+ *
+ * Tests the Reaper, which frees objects for the audio thread.
+ */
+
+#include <Tritium/Reaper.hpp>
+#include "../src/RtSnapshot.hpp"
+
+// CHANGE THIS TO MATCH YOUR FILE:
+#define THIS_NAMESPACE t_Reaper
+#include "test_macros.hpp"
+
+using namespace Tritium;
+
+namespace THIS_NAMESPACE
+{
+    /// Counts the instances that are alive.
+    struct Tracked
+    {
+	static int alive;
+	bool playing;
+	Tracked() : playing(false) { ++alive; }
+	~Tracked() { --alive; }
+
+	static bool is_playing(void* p) {
+	    return static_cast<Tracked*>(p)->playing;
+	}
+    };
+
+    int Tracked::alive = 0;
+
+    struct Fixture
+    {
+	T<RtReader>::shared_ptr reader;
+	T<Reaper>::auto_ptr reaper;
+
+	Fixture() : reader( new RtReader ) {
+	    Tracked::alive = 0;
+	    reaper.reset( new Reaper(reader, 4) );
+	}
+    };
+
+} // namespace THIS_NAMESPACE
+
+TEST_BEGIN( Fixture );
+
+TEST_CASE( 010_retire )
+{
+    T<Tracked>::shared_ptr a( new Tracked );
+    CK( ! reaper->ready() );
+
+    // The audio thread lets go of both.  Nothing is freed yet.
+    reader->enter();
+    CK( reaper->retire( a, 100 ) );
+    a.reset();
+    CK( reaper->retire( new Tracked, 20 ) );
+    reader->leave();
+    CK( Tracked::alive == 2 );
+
+    CK( reaper->ready() );
+    CK( reaper->collect() == 2 );
+    CK( Tracked::alive == 0 );
+    CK( reaper->freed() == 2 );
+    CK( reaper->freed_bytes() == 120 );
+    CK( reaper->pending() == 0 );
+    CK( ! reaper->ready() );
+}
+
+TEST_CASE( 020_defer_waits_for_reader )
+{
+    reader->enter();
+    reaper->defer( new Tracked, 100 );
+    CK( reaper->pending() == 1 );
+    CK( reaper->pending_bytes() == 100 );
+    CK( ! reaper->ready() );
+    CK( reaper->collect() == 0 );
+    CK( Tracked::alive == 1 );
+    reader->leave();
+
+    CK( reaper->ready() );
+    CK( reaper->collect() == 1 );
+    CK( Tracked::alive == 0 );
+    CK( reaper->pending() == 0 );
+    CK( reaper->pending_bytes() == 0 );
+    CK( reaper->freed_bytes() == 100 );
+}
+
+TEST_CASE( 030_defer_waits_for_last_reference )
+{
+    T<Tracked>::shared_ptr a( new Tracked );
+    T<Tracked>::shared_ptr voice = a;  // e.g. a note that's still playing
+    reaper->defer( a, 10 );
+    a.reset();
+    CK( ! reaper->ready() );
+    CK( reaper->collect() == 0 );
+
+    voice.reset();
+    CK( Tracked::alive == 1 );
+    CK( reaper->ready() );
+    CK( reaper->collect() == 1 );
+    CK( Tracked::alive == 0 );
+}
+
+TEST_CASE( 035_defer_waits_while_busy )
+{
+    T<Tracked>::shared_ptr a( new Tracked );
+    a->playing = true;  // e.g. a voice has a plain pointer to it
+    reaper->defer( a, 10, &Tracked::is_playing );
+    Tracked* voice = a.get();
+    a.reset();
+    CK( ! reaper->ready() );
+    CK( reaper->collect() == 0 );
+    CK( reaper->pending() == 1 );
+
+    voice->playing = false;
+    CK( reaper->ready() );
+    CK( reaper->collect() == 1 );
+    CK( Tracked::alive == 0 );
+}
+
+TEST_CASE( 040_full_ring )
+{
+    Tracked* extra = new Tracked;
+    for( int k=0 ; k<4 ; ++k ) {
+	CK( reaper->retire( new Tracked ) );
+    }
+    CK( ! reaper->retire( extra ) );
+    CK( reaper->overflows() == 1 );
+    delete extra;
+
+    CK( reaper->collect() == 4 );
+    CK( Tracked::alive == 0 );
+    CK( reaper->retire( new Tracked ) );
+}
+
+TEST_CASE( 050_destructor_frees_everything )
+{
+    T<Tracked>::shared_ptr a( new Tracked );
+    reader->enter();
+    reaper->retire( new Tracked );
+    reaper->defer( new Tracked );
+    reaper->defer( a );
+    a.reset();
+    reader->leave();
+    CK( Tracked::alive == 3 );
+    reaper.reset();
+    CK( Tracked::alive == 0 );
+}
+
+TEST_END()
@@ -0,0 +1,260 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * t_RenderPool.cpp
+ *
+ * Tests the worker pool used for parallel rendering, and that the
+ * Sampler renders the same with and without it.
+ */
+
+#include "../src/RenderPool.hpp"
+#include <Tritium/Sampler.hpp>
+#include <Tritium/MixerImpl.hpp>
+#include <Tritium/AudioPortManager.hpp>
+#include <Tritium/Instrument.hpp>
+#include <Tritium/InstrumentLayer.hpp>
+#include <Tritium/InstrumentList.hpp>
+#include <Tritium/ADSR.hpp>
+#include <Tritium/Note.hpp>
+#include <Tritium/Sample.hpp>
+#include <Tritium/SeqEvent.hpp>
+#include <Tritium/SeqScript.hpp>
+#include <Tritium/SeqScriptIterator.hpp>
+#include <Tritium/TransportPosition.hpp>
+#include <Tritium/Logger.hpp>
+#include <Tritium/memory.hpp>
+#include <QAtomicInt>
+#include <vector>
+
+// CHANGE THIS TO MATCH YOUR FILE:
+#define THIS_NAMESPACE t_RenderPool
+#include "test_macros.hpp"
+#include "test_config.hpp"
+
+using namespace Tritium;
+
+namespace THIS_NAMESPACE
+{
+    const char sine_wav_file[] =
+	TEST_DATA_DIR "/samples/sine_480.46875_hz.wav";
+
+    /// Counts how many times each index was run.
+    class CountJob : public RenderPool::Job
+    {
+    public:
+	std::vector<QAtomicInt> count;
+
+	CountJob(unsigned n) : count(n) {
+	    for( unsigned k=0 ; k<n ; ++k ) count[k] = 0;
+	}
+	void operator()(unsigned index) {
+	    count[index].fetchAndAddOrdered(1);
+	}
+	bool each_once() {
+	    for( unsigned k=0 ; k<count.size() ; ++k ) {
+		if( int(count[k]) != 1 ) return false;
+	    }
+	    return true;
+	}
+    };
+
+    /// A Sampler with its own Mixer and instruments.
+    struct Rig
+    {
+	T<MixerImpl>::shared_ptr mixer;
+	T<Sampler>::shared_ptr sampler;
+	std::vector< T<Instrument>::shared_ptr > instruments;
+	SeqScript seq;
+
+	Rig(T<Sample>::shared_ptr sample, unsigned count) {
+	    mixer.reset( new MixerImpl() );
+	    sampler.reset( new Sampler(
+			       boost::dynamic_pointer_cast<AudioPortManager>(mixer) ) );
+	    for( unsigned k=0 ; k<count ; ++k ) {
+		T<Instrument>::shared_ptr I(
+		    new Instrument( QString::number(k), "Sine", new ADSR() )
+		    );
+		I->set_layer( new InstrumentLayer(sample), 0 );
+		I->get_layer(0)->set_pitch( float(k % 3) ); // Some resample
+		I->set_gain( 1.0f / (k + 1) );
+		if( k % 3 != 1 ) {
+		    I->set_filter_active( true );
+		    I->set_filter_cutoff( 0.2f + 0.05f * k );
+		    I->set_filter_resonance( 0.6f );
+		}
+		sampler->add_instrument(I);
+		instruments.push_back(I);
+	    }
+	}
+
+	void note(unsigned instr, uint32_t frame, float velocity) {
+	    SeqEvent ev;
+	    ev.frame = frame;
+	    ev.type = SeqEvent::NOTE_ON;
+	    ev.set_note( Note( instruments[instr], velocity ) );
+	    seq.insert_note( ev, 5000 );
+	}
+
+	void cycle(uint32_t nframes, float* left, float* right) {
+	    TransportPosition pos;
+	    pos.frame_rate = 48000;
+	    mixer->pre_process(nframes);
+	    sampler->process( seq.begin_const(), seq.end_const(nframes),
+			      pos, nframes );
+	    mixer->mix_down(nframes, left, right);
+	    seq.consumed(nframes);
+	}
+    };
+
+    struct Fixture
+    {
+	Fixture() {
+	    Logger::create_instance();
+	}
+	~Fixture() {
+	    delete Logger::get_instance();
+	}
+    };
+
+} // namespace THIS_NAMESPACE
+
+TEST_BEGIN( Fixture );
+
+TEST_CASE( 010_every_index_once )
+{
+    RenderPool pool(3);
+    CK( pool.threads() == 3 );
+
+    CountJob job(1000);
+    pool.run(job, 1000);
+    CK( job.each_once() );
+
+    CountJob none(1);
+    pool.run(none, 0);
+    CK( int(none.count[0]) == 0 );
+}
+
+TEST_CASE( 020_many_runs )
+{
+    RenderPool pool(4);
+    for( unsigned n=1 ; n<200 ; ++n ) {
+	CountJob job(n % 7 + 1);
+	pool.run(job, n % 7 + 1);
+	CK( job.each_once() );
+    }
+}
+
+TEST_CASE( 030_no_workers )
+{
+    RenderPool pool(0);
+    CK( pool.threads() == 0 );
+    CountJob job(10);
+    pool.run(job, 10);
+    CK( job.each_once() );
+}
+
+TEST_CASE( 040_sampler_same_as_serial )
+{
+    T<Sample>::shared_ptr sample = Sample::load( sine_wav_file );
+    BOOST_REQUIRE( sample );
+
+    const unsigned INSTRUMENTS = 12;
+    Rig serial( sample, INSTRUMENTS );
+    Rig parallel( sample, INSTRUMENTS );
+    parallel.sampler->set_render_threads( 3 );
+    CK( parallel.sampler->get_render_threads() == 3 );
+    CK( serial.sampler->get_render_threads() == 0 );
+
+    for( unsigned k=0 ; k<48 ; ++k ) {
+	unsigned instr = (k * 5) % INSTRUMENTS;
+	uint32_t frame = k * 173;
+	float velocity = 0.3f + 0.7f * (k % 4) / 4.0f;
+	serial.note( instr, frame, velocity );
+	parallel.note( instr, frame, velocity );
+    }
+
+    const uint32_t N = 512;
+    std::vector<float> s_L(N), s_R(N), p_L(N), p_R(N);
+    bool same = true, sound = false;
+    for( unsigned cycle=0 ; cycle<40 ; ++cycle ) {
+	if( cycle == 20 ) {
+	    // The filters glide to the new cutoff.
+	    serial.instruments[0]->set_filter_cutoff( 0.9f );
+	    parallel.instruments[0]->set_filter_cutoff( 0.9f );
+	}
+	serial.cycle( N, &s_L[0], &s_R[0] );
+	parallel.cycle( N, &p_L[0], &p_R[0] );
+	for( uint32_t k=0 ; k<N ; ++k ) {
+	    if( s_L[k] != p_L[k] || s_R[k] != p_R[k] ) same = false;
+	    if( s_L[k] != 0.0f ) sound = true;
+	}
+	CK( serial.sampler->get_playing_notes_number()
+	    == parallel.sampler->get_playing_notes_number() );
+    }
+    CK( sound );
+    CK( same );
+    for( unsigned k=0 ; k<INSTRUMENTS ; ++k ) {
+	CK( serial.instruments[k]->get_peak_l() == parallel.instruments[k]->get_peak_l() );
+    }
+}
+
+TEST_CASE( 050_move_instrument )
+{
+    T<Sample>::shared_ptr sample = Sample::load( sine_wav_file );
+    BOOST_REQUIRE( sample );
+
+    Rig rig( sample, 3 );
+    rig.sampler->move_instrument( 0, 2 );
+    T<InstrumentList>::shared_ptr list = rig.sampler->get_instrument_list();
+    CK( list->get(0) == rig.instruments[1] );
+    CK( list->get(1) == rig.instruments[2] );
+    CK( list->get(2) == rig.instruments[0] );
+    for( unsigned k=0 ; k<3 ; ++k ) {
+	CK( list->get_pos( list->get(k) ) == int(k) );
+    }
+
+    // A playing voice follows its instrument to the new port.
+    const uint32_t N = 256;
+    std::vector<float> L(3 * N), R(3 * N), mix_L(N), mix_R(N);
+    rig.sampler->set_per_instrument_outs( true );
+    rig.note( 0, 0, 1.0f );
+    for( unsigned cycle=0 ; cycle<2 ; ++cycle ) {
+	if( cycle == 1 ) {
+	    rig.sampler->move_instrument( 2, 0 );
+	}
+	for( unsigned k=0 ; k<3 ; ++k ) {
+	    rig.sampler->set_instrument_out( k, &L[k * N], &R[k * N] );
+	}
+	rig.cycle( N, &mix_L[0], &mix_R[0] );
+
+	unsigned port = ( cycle == 0 ) ? 2 : 0;
+	for( unsigned k=0 ; k<3 ; ++k ) {
+	    bool sound = false;
+	    for( uint32_t j=0 ; j<N ; ++j ) {
+		if( L[k * N + j] != 0.0f ) sound = true;
+	    }
+	    CK( sound == ( k == port ) );
+	}
+    }
+}
+
+TEST_END()
@@ -0,0 +1,162 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * t_RtSnapshot.cpp
+ *
+ * Tests the read-copy-update snapshots that the engine publishes
+ * to the audio thread.
+ */
+
+#include "../src/RtSnapshot.hpp"
+#include <QThread>
+
+// CHANGE THIS TO MATCH YOUR FILE:
+#define THIS_NAMESPACE t_RtSnapshot
+#include "test_macros.hpp"
+
+using namespace Tritium;
+
+namespace THIS_NAMESPACE
+{
+    /// Counts the instances that are alive.
+    struct Tracked
+    {
+	static QAtomicInt alive;
+	int value;
+
+	Tracked(int v) : value(v) { alive.fetchAndAddOrdered(1); }
+	~Tracked() { alive.fetchAndAddOrdered(-1); }
+    };
+
+    QAtomicInt Tracked::alive(0);
+
+    /// Reads the snapshot in short sections until told to stop.
+    class Reader : public QThread
+    {
+    public:
+	Reader(RtReader& r, RtSnapshot<Tracked>& s) :
+	    _r(r), _s(s), _kill(0), bad(0) {}
+
+	void run() {
+	    while( ! _kill.fetchAndAddAcquire(0) ) {
+		_r.enter();
+		Tracked* t = _s.get();
+		int v = t->value;
+		for( int k=0 ; k<100 ; ++k ) {
+		    if( t->value != v || Tracked::alive.fetchAndAddAcquire(0) <= 0 ) {
+			bad.fetchAndAddOrdered(1);
+		    }
+		}
+		_r.leave();
+	    }
+	}
+
+	void kill() { _kill.fetchAndStoreOrdered(1); }
+
+    private:
+	RtReader& _r;
+	RtSnapshot<Tracked>& _s;
+	QAtomicInt _kill;
+
+    public:
+	QAtomicInt bad;
+    };
+
+    struct Fixture
+    {
+	RtReader reader;
+	RtSnapshot<Tracked> snap;
+
+	Fixture() : snap(reader, T<Tracked>::shared_ptr(new Tracked(1))) {}
+    };
+
+} // namespace THIS_NAMESPACE
+
+TEST_BEGIN( Fixture );
+
+TEST_CASE( 010_publish )
+{
+    CK( Tracked::alive == 1 );
+    CK( snap.get()->value == 1 );
+    CK( snap.current()->value == 1 );
+
+    // No reader inside a section: the old one goes right away.
+    snap.publish( T<Tracked>::shared_ptr(new Tracked(2)) );
+    CK( snap.get()->value == 2 );
+    CK( snap.current()->value == 2 );
+    CK( snap.retired() == 0 );
+    CK( Tracked::alive == 1 );
+
+    snap.publish( T<Tracked>::shared_ptr() );
+    CK( snap.get() == 0 );
+    CK( Tracked::alive == 0 );
+}
+
+TEST_CASE( 020_retired_while_reading )
+{
+    reader.enter();
+    Tracked* t = snap.get();
+    snap.publish( T<Tracked>::shared_ptr(new Tracked(2)) );
+    snap.publish( T<Tracked>::shared_ptr(new Tracked(3)) );
+
+    // Both old ones are kept: the reader may still use them.
+    CK( snap.retired() == 2 );
+    CK( Tracked::alive == 3 );
+    CK( t->value == 1 );
+    reader.leave();
+
+    snap.collect();
+    CK( snap.retired() == 0 );
+    CK( Tracked::alive == 1 );
+
+    // A section that started after the publish doesn't hold it.
+    snap.publish( T<Tracked>::shared_ptr(new Tracked(4)) );
+    reader.enter();
+    snap.collect();
+    CK( snap.retired() == 0 );
+    CK( snap.get()->value == 4 );
+    reader.leave();
+}
+
+TEST_CASE( 030_synchronize )
+{
+    reader.synchronize();  // Not in a section: doesn't wait
+
+    Reader r(reader, snap);
+    r.start();
+    for( int k=2 ; k<2000 ; ++k ) {
+	snap.publish( T<Tracked>::shared_ptr(new Tracked(k)) );
+	if( k % 100 == 0 ) {
+	    reader.synchronize();  // Returns while the reader runs
+	}
+    }
+    r.kill();
+    r.wait();
+    CK( r.bad == 0 );
+
+    snap.collect();
+    CK( snap.retired() == 0 );
+    CK( Tracked::alive == 1 );
+    CK( snap.get()->value == 1999 );
+}
+
+TEST_END()
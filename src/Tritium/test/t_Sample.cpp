@@ -298,4 +298,28 @@ TEST_CASE( 030_triangle_waves )
     BOOST_MESSAGE(10.0*log10(e_max));
 }
 
+TEST_CASE( 030_preload )
+{
+    unsigned long k;
+    T<Sample>::shared_ptr head = Sample::load(sine_wav_file, 1024);
+
+    CK(head);
+    CK(head->is_streaming());
+    CK(head->get_n_frames() == 1024);
+    CK(head->get_total_frames() == ((unsigned)sample_count));
+    CK(head->get_sample_rate() == sample_rate);
+    for( k=0 ; k<head->get_n_frames() ; ++k ) {
+	CK( head->get_data_l()[k] == sine_wav->get_data_l()[k] );
+	CK( head->get_data_r()[k] == sine_wav->get_data_r()[k] );
+    }
+
+    // Samples shorter than the preload are loaded whole.
+    T<Sample>::shared_ptr whole = Sample::load(sine_flac_file, sample_count);
+    CK(whole);
+    CK( ! whole->is_streaming() );
+    CK(whole->get_n_frames() == ((unsigned)sample_count));
+    CK(whole->get_total_frames() == ((unsigned)sample_count));
+    CK( ! sine_wav->is_streaming() );
+}
+
 TEST_END()
@@ -0,0 +1,251 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * t_SampleRateCache.cpp
+ *
+ * Tests the conversion of samples to the engine's sample rate.
+ */
+
+#include <Tritium/SampleRateCache.hpp>
+#include <Tritium/Sample.hpp>
+#include <Tritium/memory.hpp>
+#include <QDir>
+#include <QFileInfo>
+#include <QStringList>
+#include <cmath>
+
+// CHANGE THIS TO MATCH YOUR FILE:
+#define THIS_NAMESPACE t_SampleRateCache
+#include "test_macros.hpp"
+#include "test_config.hpp"
+
+using namespace Tritium;
+
+namespace THIS_NAMESPACE
+{
+    const char sine_wav_file[] =
+	TEST_DATA_DIR "/samples/sine_480.46875_hz.wav";
+
+    // sine_wav_file
+    const double signal_frequency = 480.46875;
+    const unsigned file_rate = 96000;
+    const unsigned file_frames = 24576;
+
+    struct Fixture
+    {
+	SampleRateCache cache;
+
+	/// A stereo sine wave, 'seconds' long.
+	T<Sample>::shared_ptr sine(double freq, unsigned rate, double seconds) {
+	    unsigned frames = unsigned(rate * seconds);
+	    float *L = new float[frames];
+	    float *R = new float[frames];
+	    for( unsigned k=0 ; k<frames ; ++k ) {
+		L[k] = R[k] = float( sin(2.0 * M_PI * freq * k / rate) );
+	    }
+	    return T<Sample>::shared_ptr( new Sample(frames, "sine", rate, L, R) );
+	}
+
+	/// Largest difference from a sine at 'freq', away from the ends.
+	double sine_error(T<Sample>::shared_ptr s, double freq) {
+	    double e_max = 0.0;
+	    unsigned rate = s->get_sample_rate();
+	    for( unsigned k = s->get_n_frames()/4 ; k < 3*s->get_n_frames()/4 ; ++k ) {
+		double want = sin(2.0 * M_PI * freq * k / rate);
+		double e = fabs( s->get_data_l()[k] - want );
+		if( e > e_max ) e_max = e;
+		e = fabs( s->get_data_r()[k] - want );
+		if( e > e_max ) e_max = e;
+	    }
+	    return e_max;
+	}
+
+	/// RMS of the left channel, away from the ends.
+	double rms(T<Sample>::shared_ptr s) {
+	    double sum = 0.0;
+	    unsigned n = 0;
+	    for( unsigned k = s->get_n_frames()/4 ; k < 3*s->get_n_frames()/4 ; ++k, ++n ) {
+		sum += double(s->get_data_l()[k]) * s->get_data_l()[k];
+	    }
+	    return sqrt(sum / n);
+	}
+    };
+
+} // namespace THIS_NAMESPACE
+
+TEST_BEGIN( Fixture );
+
+TEST_CASE( 010_upsample )
+{
+    T<Sample>::shared_ptr in = sine(1000.0, 44100, 0.5);
+    T<Sample>::shared_ptr out = SampleRateCache::resample(in, 48000);
+    BOOST_REQUIRE( out );
+    CK( out != in );
+    CK( out->get_sample_rate() == 48000 );
+    CK( out->get_n_frames() == 24000 );
+    CK( out->get_filename() == in->get_filename() );
+    CK( sine_error(out, 1000.0) < 1.0e-3 );
+}
+
+TEST_CASE( 020_downsample )
+{
+    T<Sample>::shared_ptr in = sine(1000.0, 48000, 0.5);
+    T<Sample>::shared_ptr out = SampleRateCache::resample(in, 44100);
+    BOOST_REQUIRE( out );
+    CK( out->get_sample_rate() == 44100 );
+    CK( out->get_n_frames() == 22050 );
+    CK( sine_error(out, 1000.0) < 1.0e-3 );
+}
+
+TEST_CASE( 030_no_aliasing )
+{
+    // 20 kHz is above the Nyquist frequency at 32 kHz.  Linear
+    // interpolation would fold it down to 12 kHz.
+    T<Sample>::shared_ptr in = sine(20000.0, 48000, 0.5);
+    T<Sample>::shared_ptr out = SampleRateCache::resample(in, 32000);
+    BOOST_REQUIRE( out );
+    CK( rms(in) > 0.5 );
+    CK( rms(out) < 1.0e-3 );
+}
+
+TEST_CASE( 040_same_rate )
+{
+    T<Sample>::shared_ptr in = sine(1000.0, 48000, 0.1);
+    CK( SampleRateCache::resample(in, 48000) == in );
+    CK( SampleRateCache::resample(in, 0) == in );
+
+    CK( cache.get_sample_rate() == 0 );
+    CK( cache.matches(in) );
+    cache.set_sample_rate(44100);
+    CK( ! cache.matches(in) );
+    cache.set_sample_rate(48000);
+    CK( cache.matches(in) );
+}
+
+TEST_CASE( 050_load )
+{
+    // No rate: same as Sample::load()
+    T<Sample>::shared_ptr s = cache.load(sine_wav_file);
+    BOOST_REQUIRE( s );
+    CK( s->get_sample_rate() == file_rate );
+    CK( s->get_n_frames() == file_frames );
+
+    cache.set_sample_rate(48000);
+    s = cache.load(sine_wav_file);
+    BOOST_REQUIRE( s );
+    CK( s->get_sample_rate() == 48000 );
+    CK( s->get_n_frames() == file_frames / 2 );
+    CK( s->get_filename() == sine_wav_file );
+    CK( sine_error(s, signal_frequency) < 1.0e-3 );
+
+    // Loaded once while it's in use.
+    CK( cache.load(sine_wav_file) == s );
+
+    // A new rate converts it again.
+    cache.set_sample_rate(44100);
+    T<Sample>::shared_ptr t = cache.load(sine_wav_file);
+    BOOST_REQUIRE( t );
+    CK( t != s );
+    CK( t->get_sample_rate() == 44100 );
+    CK( t->get_n_frames() == 11290 );
+}
+
+TEST_CASE( 060_streaming_not_converted )
+{
+    cache.set_sample_rate(48000);
+    T<Sample>::shared_ptr s = cache.load(sine_wav_file, 1024);
+    BOOST_REQUIRE( s );
+    CK( s->is_streaming() );
+    CK( s->get_sample_rate() == file_rate );
+    CK( cache.matches(s) );
+}
+
+TEST_CASE( 070_disk_cache )
+{
+    QDir dir( QDir::tempPath() + "/t_SampleRateCache" );
+    QStringList old = dir.entryList(QDir::Files);
+    for( int k=0 ; k<old.size() ; ++k ) {
+	dir.remove(old[k]);
+    }
+
+    cache.set_sample_rate(48000);
+    cache.set_disk_cache( dir.absolutePath() );
+    T<Sample>::shared_ptr s = cache.load(sine_wav_file);
+    BOOST_REQUIRE( s );
+    CK( s->is_mapped() );
+    CK( s->get_sample_rate() == 48000 );
+    CK( dir.entryList(QDir::Files).size() == 1 );
+
+    // A new cache (next session) reads it back.
+    SampleRateCache other;
+    other.set_sample_rate(48000);
+    other.set_disk_cache( dir.absolutePath() );
+    T<Sample>::shared_ptr t = other.load(sine_wav_file);
+    BOOST_REQUIRE( t );
+    CK( t != s );
+    CK( t->is_mapped() );
+    CK( t->get_sample_rate() == 48000 );
+    CK( t->get_filename() == sine_wav_file );
+    BOOST_REQUIRE( t->get_n_frames() == s->get_n_frames() );
+    for( unsigned k=0 ; k<s->get_n_frames() ; ++k ) {
+	CK( t->get_data_l()[k] == s->get_data_l()[k] );
+	CK( t->get_data_r()[k] == s->get_data_r()[k] );
+    }
+
+    old = dir.entryList(QDir::Files);
+    for( int k=0 ; k<old.size() ; ++k ) {
+	dir.remove(old[k]);
+    }
+    dir.rmdir( dir.absolutePath() );
+}
+
+TEST_CASE( 080_disk_cache_file_rate )
+{
+    QDir dir( QDir::tempPath() + "/t_SampleRateCache" );
+
+    // No conversion, but still decoded once and shared.
+    cache.set_disk_cache( dir.absolutePath() );
+    T<Sample>::shared_ptr s = cache.load(sine_wav_file);
+    BOOST_REQUIRE( s );
+    CK( s->is_mapped() );
+    CK( s->get_sample_rate() == file_rate );
+    CK( s->get_n_frames() == file_frames );
+    CK( sine_error(s, signal_frequency) < 1.0e-4 );
+    CK( cache.load(sine_wav_file) == s );
+
+    // Streaming samples are not cached.
+    SampleRateCache other;
+    other.set_disk_cache( dir.absolutePath() );
+    T<Sample>::shared_ptr t = other.load(sine_wav_file, 1024);
+    BOOST_REQUIRE( t );
+    CK( t->is_streaming() );
+    CK( ! t->is_mapped() );
+
+    QStringList old = dir.entryList(QDir::Files);
+    CK( old.size() == 1 );
+    for( int k=0 ; k<old.size() ; ++k ) {
+	dir.remove(old[k]);
+    }
+    dir.rmdir( dir.absolutePath() );
+}
+
+TEST_END()
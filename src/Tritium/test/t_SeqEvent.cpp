@@ -39,7 +39,7 @@ namespace THIS_NAMESPACE
 	SeqEvent& ev;  // This is the "normal" one.
 	T<SeqEvent>::auto_ptr xev_ptr;
 	SeqEvent& xev; // This is the odd one.
-	T<Instrument>::shared_ptr instr;  // Note() won't let us set a null instrument
+	T<Instrument>::shared_ptr instr;
 
 	Fixture() :
 	    ev_ptr( new SeqEvent ),
@@ -49,12 +49,12 @@ namespace THIS_NAMESPACE
 	    Logger::create_instance();
 	    instr = Instrument::create_empty();
 
-	    ev.note.set_instrument( instr );
+	    ev.instrument = instr->get_handle();
 
 	    xev.frame = 0xFEEEEEEE;
 	    xev.type = SeqEvent::ALL_OFF;
 	    xev.quantize = true;
-	    xev.note.set_instrument( instr );
+	    xev.instrument = instr->get_handle();
 	}
 
 	~Fixture() {
@@ -74,6 +74,11 @@ TEST_CASE( 001_defaults )
     CK( ev.frame == 0 );
     CK( ev.type == SeqEvent::UNDEFINED );
     CK( ev.quantize == false );
+
+    SeqEvent d;
+    CK( d.instrument == 0 );
+    CK( d.velocity == 1.0f );
+    CK( d.pitch == 0.0f );
 }
 
 TEST_CASE( 002_copy )
@@ -82,28 +87,29 @@ TEST_CASE( 002_copy )
     cp = ev;
     CK( cp.frame == ev.frame );
     CK( cp.type == ev.type );
-    // CK( cp.note == ev.note );  // TODO
+    CK( cp.instrument == ev.instrument );
     CK( cp.quantize == ev.quantize );
 
     cp = xev;
     CK( cp.frame == xev.frame );
     CK( cp.type == xev.type );
-    // CK( cp.note == xev.note ); // TODO
+    CK( cp.instrument == xev.instrument );
     CK( cp.quantize == xev.quantize );
 
     // Verify independence
     ++cp.frame;
     cp.type = SeqEvent::NOTE_OFF;
     cp.quantize = !cp.quantize;
+    cp.instrument = 0;
     CK( cp.frame != xev.frame );
     CK( cp.type != xev.type );
-    // CK( cp.note != xev.note ); // TODO
+    CK( cp.instrument != xev.instrument );
     CK( cp.quantize != xev.quantize );
 
     xev = ev;
     CK( ev.frame == xev.frame );
     CK( ev.type == xev.type );
-    // CK( ev.note == xev.note ); // TODO
+    CK( ev.instrument == xev.instrument );
     CK( ev.quantize == xev.quantize );
 
     // Confirm xev
@@ -129,7 +135,7 @@ TEST_CASE( 004_compare )
     SeqEvent a;
     SeqEvent b = xev;
 
-    a.note.set_instrument( instr );
+    a.instrument = instr->get_handle();
 
     CK( a == ev );
     CK( ev == a );
@@ -153,4 +159,28 @@ TEST_CASE( 004_compare )
     CK( ! (ev == a) );
 }
 
+TEST_CASE( 005_set_note )
+{
+    T<Instrument>::shared_ptr other = Instrument::create_empty();
+    CK( instr->get_handle() != 0 );
+    CK( other->get_handle() != 0 );
+    CK( other->get_handle() != instr->get_handle() );
+
+    NoteKey key;
+    key.m_key = NoteKey::E;
+    key.m_nOctave = 1;
+    Note note( other, 0.5f, 0.25f, 0.375f, -1, 0.5f, key );
+    SeqEvent a;
+    a.set_note( note );
+    CK( a.instrument == other->get_handle() );
+    CK( a.velocity == 0.5f );
+    CK( a.pan_l == 0.25f );
+    CK( a.pan_r == 0.375f );
+    CK( a.pitch == 16.5f );
+    CK( other.use_count() == 2 );  // 'other' and 'note'
+
+    a.set_note( Note() );
+    CK( a.instrument == 0 );
+}
+
 TEST_END()
@@ -111,8 +111,8 @@ namespace THIS_NAMESPACE
 		int p = k % x_pat_size;
 		tmp.frame = x_pat[p].frame + 96000 * (k/x_pat_size);
 		tmp.type = (x_pat[p].on_off) ? SeqEvent::NOTE_ON : SeqEvent::NOTE_OFF;
-		tmp.note.set_instrument( inst_refs[ x_pat[p].inst ] );
-		tmp.note.set_velocity(x_pat[p].vel);
+		tmp.instrument = inst_refs[ x_pat[p].inst ]->get_handle();
+		tmp.velocity = x_pat[p].vel;
 		x.insert(tmp);
 	    }
 
@@ -238,8 +238,8 @@ TEST_CASE( 040_check_contents )
 	    }
 	    CK( cur->frame == x_pat[k].frame + frame );
 	    CK( cur->type == ((x_pat[k].on_off) ? SeqEvent::NOTE_ON : SeqEvent::NOTE_OFF) );
-	    CK( cur->note.get_instrument() == inst_refs[ x_pat[k].inst ] );
-	    CK( cur->note.get_velocity() == x_pat[k].vel );
+	    CK( cur->instrument == inst_refs[ x_pat[k].inst ]->get_handle() );
+	    CK( cur->velocity == x_pat[k].vel );
 	    ++cur;
 	}
     }
@@ -26,6 +26,8 @@
 #include <vector>
 #include <memory>
 #include <map>
+#include <set>
+#include <cstdlib>
 #include <algorithm>
 
 // CHANGE THIS TO MATCH YOUR FILE:
@@ -112,8 +114,8 @@ namespace THIS_NAMESPACE
 		int p = k % x_pat_size;
 		tmp.frame = x_pat[p].frame + 96000 * (k/x_pat_size);
 		tmp.type = (x_pat[p].on_off) ? SeqEvent::NOTE_ON : SeqEvent::NOTE_OFF;
-		tmp.note.set_instrument( inst_refs[ x_pat[p].inst ] );
-		tmp.note.set_velocity(x_pat[p].vel);
+		tmp.instrument = inst_refs[ x_pat[p].inst ]->get_handle();
+		tmp.velocity = x_pat[p].vel;
 		x.insert(tmp);
 	    }
 
@@ -138,8 +140,8 @@ namespace THIS_NAMESPACE
 		tmp.frame = x_pat[p].frame;
 		tmp.frame += 96000 * ((*n)/x_pat_size);
 		tmp.type = (x_pat[p].on_off) ? SeqEvent::NOTE_ON : SeqEvent::NOTE_OFF;
-		tmp.note.set_instrument( inst_refs[ x_pat[p].inst ] );
-		tmp.note.set_velocity(x_pat[p].vel);
+		tmp.instrument = inst_refs[ x_pat[p].inst ]->get_handle();
+		tmp.velocity = x_pat[p].vel;
 		r.insert(tmp);
 	    }
 
@@ -379,4 +381,121 @@ TEST_CASE( 050_size_and_storage )
 
 }
 
+TEST_CASE( 060_remove )
+{
+    SeqScriptPrivate::iterator cur, prev;
+
+    // Remove every other event, including the first and last.
+    size_t k = 0;
+    cur = x.begin();
+    while( cur != x.end() ) {
+	prev = cur;
+	++cur;
+	if( (k % 2) == 0 ) x.remove(prev);
+	++k;
+    }
+    CK( x.size() == 16 );
+
+    k = 0;
+    for( cur = x.begin() ; cur != x.end() ; ++cur ) {
+	int p = (2*k + 1) % x_pat_size;
+	CK( cur->ev.frame == x_pat[p].frame + 96000 * ((2*k + 1) / x_pat_size) );
+	++k;
+    }
+    CK( k == 16 );
+
+    // Remove by value.
+    SeqEvent ev = x.begin()->ev;
+    x.remove(ev);
+    CK( x.size() == 15 );
+    CK( x.begin()->ev != ev );
+
+    // Freed storage gets reused.
+    for( k=0 ; k<17 ; ++k ) {
+	x.insert(ev);
+    }
+    CK( x.size() == 32 );
+    cur = prev = x.begin();
+    ++cur;
+    while( cur != x.end() ) {
+	CK( ! ((cur->ev) < (prev->ev)) );
+	++cur; ++prev;
+    }
+}
+
+TEST_CASE( 070_random_vs_multiset )
+{
+    // Random inserts, removes and consumes checked against a
+    // std::multiset of absolute frames.
+    std::multiset<uint64_t> ref;
+    std::multiset<uint64_t>::iterator ref_it;
+    uint64_t epoch = 0;
+    SeqScriptPrivate::iterator cur;
+    int k, j;
+
+    r.clear();
+    srand(12345);
+    for( k=0 ; k<200 ; ++k ) {
+	for( j = rand() % 8 ; j > 0 ; --j ) {
+	    if( r.size() == r.max_size() ) break;
+	    SeqEvent ev;
+	    ev.frame = rand() % 20000;
+	    r.insert(ev);
+	    ref.insert(epoch + ev.frame);
+	}
+	if( ! r.empty() && (rand() % 4 == 0) ) {
+	    cur = r.begin();
+	    for( j = rand() % r.size() ; j > 0 ; --j ) ++cur;
+	    ref.erase( ref.find(epoch + cur->ev.frame) );
+	    r.remove(cur);
+	}
+
+	BOOST_REQUIRE( r.size() == ref.size() );
+	for( cur = r.begin(), ref_it = ref.begin() ; cur != r.end() ; ++cur, ++ref_it ) {
+	    CK( epoch + cur->ev.frame == *ref_it );
+	}
+
+	SeqEvent::frame_type nframes = 256 + rand() % 1024;
+	cur = r.lower_bound(nframes);
+	CK( (cur == r.end()) || (cur->ev.frame >= nframes) );
+	r.consumed(nframes);
+	epoch += nframes;
+	ref.erase( ref.begin(), ref.lower_bound(epoch) );
+    }
+}
+
+TEST_CASE( 080_consumed_past_32_bits )
+{
+    // The frames stay relative after more than 2^32 frames have
+    // been consumed.
+    SeqEvent ev;
+    ev.frame = 1000;
+    x.clear();
+    x.insert(ev);
+    ev.frame = 0xF0000000;
+    x.insert(ev);
+
+    x.consumed(0xE0000000);
+    CK( x.size() == 1 );
+    CK( x.begin()->ev.frame == 0x10000000 );
+
+    x.consumed(0xE0000000);
+    CK( x.empty() );
+
+    ev.frame = 500;
+    x.insert(ev);
+    ev.frame = 100;
+    x.insert(ev);
+    x.consumed(0xE0000000);
+    x.consumed(0xE0000000);
+    CK( x.empty() );
+
+    ev.frame = 48000;
+    x.insert(ev);
+    x.consumed(1000);
+    CK( x.begin()->ev.frame == 47000 );
+    CK( x.lower_bound(47000) == x.begin() );
+    CK( x.lower_bound(47001) == x.end() );
+}
+
 TEST_END()
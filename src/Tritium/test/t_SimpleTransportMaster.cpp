@@ -150,4 +150,25 @@ TEST_CASE( 020_start_stop )
 
 }
 
+TEST_CASE( 030_published_timeline )
+{
+    // processed_frames() only sees the timeline it was given, not
+    // the Song.
+    TransportPosition pos;
+    x.start();
+    x.processed_frames(1024);
+    x.get_position(&pos);
+    CK( pos.beats_per_minute == 100.0 );
+
+    s->set_bpm(150.0f);
+    x.processed_frames(1024);
+    x.get_position(&pos);
+    CK( pos.beats_per_minute == 100.0 );
+
+    x.set_timeline( s->get_timeline() );
+    x.processed_frames(1024);
+    x.get_position(&pos);
+    CK( pos.beats_per_minute == 150.0 );
+}
+
 TEST_END()
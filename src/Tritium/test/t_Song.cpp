@@ -30,6 +30,9 @@
 #include <Tritium/Sampler.hpp>
 #include <Tritium/Instrument.hpp>
 #include <Tritium/InstrumentList.hpp>
+#include <cmath>
+
+#include "../src/SongTimeline.hpp"
 
 #define THIS_NAMESPACE t_Song
 #include "test_macros.hpp"
@@ -41,6 +44,11 @@ namespace THIS_NAMESPACE
 {
     const char song_file_name[] = TEST_DATA_DIR "/t_Song.h2song";
 
+    bool close(double a, double b)
+    {
+	return fabs(a - b) < 1e-6;
+    }
+
     struct Fixture
     {
 	T<Song>::shared_ptr s;
@@ -255,4 +263,80 @@ TEST_CASE( 050_ticks_in_bar )
     }
 }
 
+TEST_CASE( 060_timeline_edits )
+{
+    // Bars of 192, 96 (empty), 192 and 96 ticks.
+    T<Song>::shared_ptr z( new Song("Timeline", "Scripty", 120.0f, 1.0f) );
+    T<Pattern>::shared_ptr whole( new Pattern("whole", "test", 192) );
+    T<Pattern>::shared_ptr half( new Pattern("half", "test", 96) );
+    T<Song::pattern_group_t>::shared_ptr groups = z->get_pattern_group_vector();
+    T<PatternList>::shared_ptr list;
+
+    list.reset( new PatternList ); list->add(whole); list->add(half); groups->push_back(list);
+    list.reset( new PatternList ); groups->push_back(list);
+    list.reset( new PatternList ); list->add(half); list->add(whole); groups->push_back(list);
+    list.reset( new PatternList ); list->add(half); groups->push_back(list);
+
+    CK( z->song_bar_count() == 4 );
+    CK( z->song_tick_count() == 480 );
+    CK( z->ticks_in_bar(2) == 0 );
+    CK( z->bar_start_tick(3) == 192 );
+    CK( z->bar_start_tick(4) == 384 );
+    CK( z->bar_for_absolute_tick(191) == 1 );
+    CK( z->bar_for_absolute_tick(192) == 3 );  // Bar 2 is empty
+    CK( z->bar_for_absolute_tick(479) == 4 );
+    CK( z->bar_for_absolute_tick(480) == 5 );  // Past the end
+
+    // Changing a pattern's length needs an invalidate.
+    half->set_length(48);
+    z->invalidate_timeline();
+    CK( z->song_tick_count() == 192 + 192 + 48 );
+    CK( z->ticks_in_bar(4) == 48 );
+
+    // A new bar is picked up without one.
+    list.reset( new PatternList ); list->add(whole); groups->push_back(list);
+    CK( z->song_bar_count() == 5 );
+    CK( z->song_tick_count() == 192 + 192 + 48 + 192 );
+    CK( z->bar_start_tick(5) == 432 );
+    CK( z->bar_for_absolute_tick(432) == 5 );
+}
+
+TEST_CASE( 070_frame_tick_conversion )
+{
+    // 100 bpm, 48 ticks/beat: 600 frames per tick @ 48 kHz
+    CK( close(s->frame_for_tick(0, 48000), 0.0) );
+    CK( close(s->frame_for_tick(192, 48000), 115200.0) );
+    CK( close(s->frame_for_tick(0.5, 48000), 300.0) );
+    CK( close(s->tick_for_frame(115200.0, 48000), 192.0) );
+    CK( close(s->tick_for_frame(300.0, 48000), 0.5) );
+    CK( close(s->frame_for_tick(192, 44100), 105840.0) );
+
+    s->set_bpm(120.0f);
+    CK( close(s->frame_for_tick(192, 48000), 96000.0) );
+    CK( close(s->tick_for_frame(96000.0, 48000), 192.0) );
+}
+
+TEST_CASE( 080_published_timeline )
+{
+    // A timeline is never changed once it is published.  Edits
+    // build a new one and bump the revision.
+    T<SongTimeline>::shared_ptr before = s->get_timeline();
+    unsigned rev = s->get_revision();
+
+    s->set_bpm(150.0f);
+    CK( s->get_revision() != rev );
+    CK( s->get_timeline() != before );
+    CK( before->bpm() == 100.0f );
+    CK( close(before->frame_for_tick(192, 48000), 115200.0) );
+    CK( s->get_timeline()->bpm() == 150.0f );
+
+    before = s->get_timeline();
+    T<PatternList>::shared_ptr list( new PatternList );
+    list->add( T<Pattern>::shared_ptr( new Pattern("whole", "test", 192) ) );
+    s->get_pattern_group_vector()->push_back(list);
+    CK( before->bar_count() == 8 );
+    CK( s->get_timeline()->bar_count() == 9 );
+    CK( s->song_tick_count() == 9 * 192 );
+}
+
 TEST_END()
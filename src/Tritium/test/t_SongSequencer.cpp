@@ -0,0 +1,237 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * t_SongSequencer.cpp
+ *
+ * Tests the song sequencer (patterns --> SeqScript).
+ */
+
+#include "../src/SongSequencer.hpp"
+#include <Tritium/Song.hpp>
+#include <Tritium/Pattern.hpp>
+#include <Tritium/Note.hpp>
+#include <Tritium/Instrument.hpp>
+#include <Tritium/SeqScript.hpp>
+#include <Tritium/TransportPosition.hpp>
+#include <Tritium/Logger.hpp>
+#include <Tritium/memory.hpp>
+#include <vector>
+
+// CHANGE THIS TO MATCH YOUR FILE:
+#define THIS_NAMESPACE t_SongSequencer
+#include "test_macros.hpp"
+
+using namespace Tritium;
+
+namespace THIS_NAMESPACE
+{
+    struct played_t
+    {
+	uint32_t frame;  // Absolute
+	int type;
+	float vel;
+    };
+
+    struct Fixture
+    {
+	T<Song>::shared_ptr song;
+	T<Pattern>::shared_ptr a, b;
+	T<Instrument>::shared_ptr inst;
+	TransportPosition pos;
+	SongSequencer seq;
+	SeqScript script;
+
+	Fixture() {
+	    Logger::create_instance();
+	    inst = Instrument::create_empty();
+
+	    // Bar 1 plays 'a', bar 2 plays 'a' and 'b'.
+	    a.reset( new Pattern("a", "test", 192) );
+	    add_note( a, 0, 1.0 );
+	    add_note( a, 0, 0.9 );
+	    add_note( a, 96, 0.8, 10 );
+	    add_note( a, 191, 0.7 );
+	    add_note( a, -5, 0.1 );  // Never played
+	    a->compile_events();
+
+	    b.reset( new Pattern("b", "test", 192) );
+	    add_note( b, 48, 0.5 );
+	    add_note( b, 96, 0.4 );
+	    b->compile_events();
+
+	    song.reset( new Song("test", "t_SongSequencer", 120.0, 1.0) );
+	    T<PatternList>::shared_ptr bar1( new PatternList );
+	    bar1->add(a);
+	    T<PatternList>::shared_ptr bar2( new PatternList );
+	    bar2->add(a);
+	    bar2->add(b);
+	    song->get_pattern_group_vector()->push_back(bar1);
+	    song->get_pattern_group_vector()->push_back(bar2);
+	    seq.set_current_song(song);
+
+	    // 500 frames per tick, 96000 frames per bar.
+	    pos.state = TransportPosition::ROLLING;
+	    pos.frame_rate = 48000;
+	    pos.beats_per_minute = 120.0;
+	    pos.ticks_per_beat = 48;
+	    pos.beats_per_bar = 4;
+	}
+
+	~Fixture() {
+	    seq.set_current_song( T<Song>::shared_ptr() );
+	    song.reset();
+	    delete Logger::get_instance();
+	}
+
+	void add_note(T<Pattern>::shared_ptr p, int tick, float vel, int length = -1) {
+	    p->note_map.insert( std::make_pair(tick, new Note(inst, vel, 1.0, 1.0, length)) );
+	}
+
+	/// Runs the sequencer in blocks of 'ticks' ticks until 'until'.
+	void run(std::vector<played_t>& out, int ticks, uint32_t until, unsigned* changes = 0) {
+	    uint32_t nframes = ticks * 500;
+	    bool changed;
+	    SeqScript::const_iterator k;
+	    while( pos.frame < until ) {
+		seq.process(script, pos, nframes, changed);
+		if( changed && changes ) ++(*changes);
+		for( k = script.begin_const() ; k != script.end_const(nframes) ; ++k ) {
+		    played_t p;
+		    p.frame = pos.frame + k->frame;
+		    p.type = k->type;
+		    p.vel = k->velocity;
+		    out.push_back(p);
+		}
+		script.consumed(nframes);
+		pos += ticks;
+	    }
+	}
+    };
+
+} // namespace THIS_NAMESPACE
+
+TEST_BEGIN( Fixture );
+
+TEST_CASE( 010_compile_events )
+{
+    const Pattern::event_table_t& ev = a->get_events();
+    BOOST_REQUIRE( ev.size() == 4 );
+    CK( ev[0].tick == 0 );
+    CK( ev[0].note->get_velocity() == 1.0f );
+    CK( ev[1].tick == 0 );
+    CK( ev[1].note->get_velocity() == 0.9f );
+    CK( ev[2].tick == 96 );
+    CK( ev[3].tick == 191 );
+
+    T<Pattern>::shared_ptr c = a->copy();
+    CK( c->get_events().size() == 4 );
+    CK( c->get_events()[3].note != ev[3].note );
+    CK( c->get_events()[3].note->get_velocity() == 0.7f );
+}
+
+TEST_CASE( 020_song )
+{
+    std::vector<played_t> out;
+    unsigned changes = 0;
+    run( out, 192 * 2, 96000 * 2, &changes );
+    CK( changes == 1 );
+
+    const played_t expected[] = {
+	{      0, SeqEvent::NOTE_ON,  1.0 },
+	{      0, SeqEvent::NOTE_ON,  0.9 },
+	{  48000, SeqEvent::NOTE_ON,  0.8 },
+	{  53000, SeqEvent::NOTE_OFF, 0.0 },
+	{  95500, SeqEvent::NOTE_ON,  0.7 },
+	{  96000, SeqEvent::NOTE_ON,  1.0 },
+	{  96000, SeqEvent::NOTE_ON,  0.9 },
+	{ 120000, SeqEvent::NOTE_ON,  0.5 },
+	{ 144000, SeqEvent::NOTE_ON,  0.8 },
+	{ 144000, SeqEvent::NOTE_ON,  0.4 },
+	{ 149000, SeqEvent::NOTE_OFF, 0.0 },
+	{ 191500, SeqEvent::NOTE_ON,  0.7 }
+    };
+    const size_t n = sizeof(expected) / sizeof(played_t);
+    BOOST_REQUIRE( out.size() == n );
+    for( size_t k=0 ; k<n ; ++k ) {
+	CK( out[k].frame == expected[k].frame );
+	CK( out[k].type == expected[k].type );
+	CK( out[k].vel == expected[k].vel );
+    }
+}
+
+TEST_CASE( 030_block_sizes_agree )
+{
+    std::vector<played_t> big, small;
+    unsigned changes = 0;
+    run( big, 192 * 2, 96000 * 2 );
+
+    pos = TransportPosition();
+    pos.state = TransportPosition::ROLLING;
+    pos.beats_per_minute = 120.0;
+    script.clear();
+    run( small, 3, 96000 * 2, &changes );
+    CK( changes == 2 );
+
+    BOOST_REQUIRE( big.size() == small.size() );
+    for( size_t k=0 ; k<big.size() ; ++k ) {
+	CK( big[k].frame == small[k].frame );
+	CK( big[k].type == small[k].type );
+	CK( big[k].vel == small[k].vel );
+    }
+}
+
+TEST_CASE( 040_edits )
+{
+    std::vector<played_t> out;
+
+    // Stopped transport: nothing.
+    pos.state = TransportPosition::STOPPED;
+    run( out, 192, 96000 );
+    CK( out.empty() );
+
+    // Edits show up once the pattern is compiled and the
+    // song's snapshot is updated.
+    pos = TransportPosition();
+    pos.state = TransportPosition::ROLLING;
+    pos.beats_per_minute = 120.0;
+    add_note( a, 12, 0.25 );
+    a->compile_events();
+    CK( ! seq.stale() );
+    song->set_modified( true );
+    CK( seq.stale() );
+    run( out, 192, 96000 );
+    CK( out.size() == 5 );
+
+    out.clear();
+    pos = TransportPosition();
+    pos.state = TransportPosition::ROLLING;
+    pos.beats_per_minute = 120.0;
+    CK( seq.update() );
+    CK( ! seq.stale() );
+    CK( ! seq.update() );
+    run( out, 192, 96000 );
+    BOOST_REQUIRE( out.size() == 6 );
+    CK( out[2].frame == 6000 );
+    CK( out[2].vel == 0.25f );
+}
+
+TEST_END()
@@ -0,0 +1,132 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * t_TailDetector.cpp
+ *
+ * Tests the silence detection that lets the mixer skip effects.
+ */
+
+#include <Tritium/fx/TailDetector.hpp>
+
+// CHANGE THIS TO MATCH YOUR FILE:
+#define THIS_NAMESPACE t_TailDetector
+#include "test_macros.hpp"
+
+using namespace Tritium;
+
+namespace THIS_NAMESPACE
+{
+    const uint32_t N = 64;   // Frames per cycle
+
+    struct Fixture
+    {
+	TailDetector tail;
+
+	Fixture() : tail( 1.0e-5f, 4 * N ) {}
+
+	/// One cycle without input.  Returns false if skipped.
+	bool cycle(float peak) {
+	    if( ! tail.wantProcess(false) ) return false;
+	    tail.processed(peak, N);
+	    return true;
+	}
+    };
+
+} // namespace THIS_NAMESPACE
+
+TEST_BEGIN( Fixture );
+
+TEST_CASE( 010_defaults )
+{
+    CK( tail.getState() == TailDetector::RUNNING );
+    CK( tail.getHold() == 4 * N );
+    CK( tail.getLongestTail() == 0 );
+    CK( tail.getIdleCount() == 0 );
+    CK( TailDetector::peak(0, 0) == 0.0f );
+
+    float buf[4] = { 0.1f, -0.5f, 0.25f, 0.0f };
+    CK( TailDetector::peak(buf, 4) == 0.5f );
+}
+
+TEST_CASE( 020_decay_then_idle )
+{
+    CK( tail.wantProcess(true) );
+    tail.processed(0.5f, N);
+    CK( tail.getState() == TailDetector::RUNNING );
+
+    // The tail decays...
+    CK( cycle(0.1f) );
+    CK( tail.getState() == TailDetector::TAIL );
+    CK( cycle(0.01f) );
+
+    // ...and is silent for hold() frames.
+    for( int k=0 ; k<3 ; ++k ) {
+	CK( cycle(1.0e-6f) );
+	CK( tail.getState() == TailDetector::TAIL );
+    }
+    CK( cycle(0.0f) );
+    CK( tail.getState() == TailDetector::IDLE );
+    CK( tail.getIdleCount() == 1 );
+    CK( tail.getLongestTail() == 2 * N );
+
+    // Skipped until there is input.
+    CK( ! cycle(0.0f) );
+    CK( tail.wantProcess(true) );
+    CK( tail.getState() == TailDetector::RUNNING );
+}
+
+TEST_CASE( 030_echo_extends_hold )
+{
+    CK( tail.wantProcess(true) );
+    tail.processed(0.5f, N);
+
+    // A gap of 3 cycles, then an echo: hold() is twice the gap.
+    for( int k=0 ; k<3 ; ++k ) {
+	CK( cycle(0.0f) );
+    }
+    CK( cycle(0.2f) );
+    CK( tail.getHold() == 6 * N );
+
+    // So 4 silent cycles are no longer enough.
+    for( int k=0 ; k<5 ; ++k ) {
+	CK( cycle(0.0f) );
+	CK( tail.getState() == TailDetector::TAIL );
+    }
+    CK( cycle(0.0f) );
+    CK( tail.getState() == TailDetector::IDLE );
+    CK( tail.getLongestTail() == 4 * N );
+}
+
+TEST_CASE( 040_reset )
+{
+    CK( cycle(0.0f) );
+    for( int k=0 ; k<4 ; ++k ) {
+	cycle(0.0f);
+    }
+    CK( tail.getState() == TailDetector::IDLE );
+    tail.reset();
+    CK( tail.getState() == TailDetector::RUNNING );
+    CK( cycle(0.0f) );
+    CK( tail.getState() == TailDetector::TAIL );
+}
+
+TEST_END()
@@ -0,0 +1,296 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * t_VoiceKernels.cpp
+ *
+ * Tests the Sampler's voice kernels and the Mixer's pan_mix() and
+ * clip_peak().  The SIMD versions must give the same result as the
+ * scalar reference.
+ */
+
+#include "../src/VoiceKernels.hpp"
+#include <vector>
+#include <cstdlib>
+
+// CHANGE THIS TO MATCH YOUR FILE:
+#define THIS_NAMESPACE t_VoiceKernels
+#include "test_macros.hpp"
+#include "test_config.hpp"
+
+using namespace Tritium;
+
+namespace THIS_NAMESPACE
+{
+    struct Fixture
+    {
+	// Odd size so that the SIMD tails are exercised.
+	static const uint32_t N = 1003;
+	std::vector<float> src_L, src_R, env;
+
+	Fixture() : src_L(N), src_R(N), env(N) {
+	    srand(1234);
+	    for( uint32_t k=0 ; k<N ; ++k ) {
+		src_L[k] = float(rand()) / RAND_MAX * 2.0f - 1.0f;
+		src_R[k] = float(rand()) / RAND_MAX * 2.0f - 1.0f;
+		env[k] = float(k) / N;
+	    }
+	}
+	~Fixture() {
+	    VoiceKernels::set_isa( VoiceKernels::detected_isa() );
+	}
+
+	void check_isa(VoiceKernels::isa_t i, bool use_env) {
+	    const float *e = (use_env) ? &env[0] : 0;
+	    std::vector<float> ref_L(N, 0.25f), ref_R(N, -0.25f);
+	    std::vector<float> out_L(N, 0.25f), out_R(N, -0.25f);
+	    float ref_pk_L = 0.0f, ref_pk_R = 0.0f;
+	    float pk_L = 0.0f, pk_R = 0.0f;
+
+	    VoiceKernels::mix_scalar( &src_L[0], &src_R[0], e, 0.7f, 0.3f,
+				      &ref_L[0], &ref_R[0], N,
+				      ref_pk_L, ref_pk_R );
+	    VoiceKernels::set_isa(i);
+	    VoiceKernels::mix( &src_L[0], &src_R[0], e, 0.7f, 0.3f,
+			       &out_L[0], &out_R[0], N,
+			       pk_L, pk_R );
+
+	    bool same = true;
+	    for( uint32_t k=0 ; k<N ; ++k ) {
+		if( out_L[k] != ref_L[k] ) same = false;
+		if( out_R[k] != ref_R[k] ) same = false;
+	    }
+	    CK( same );
+	    CK( pk_L == ref_pk_L );
+	    CK( pk_R == ref_pk_R );
+	}
+
+	// Compare pan_mix() on ISA 'i' with the scalar version.
+	void check_pan_mix(VoiceKernels::isa_t i, bool stereo, bool overwrite, bool ramp) {
+	    const float *s_R = (stereo) ? &src_R[0] : 0;
+	    const float from[4] = { 0.5f, 0.25f, 0.125f, 1.0f };
+	    const float to_ramp[4] = { 1.0f, 0.0f, 0.75f, 0.5f };
+	    const float *to = (ramp) ? to_ramp : from;
+	    std::vector<float> ref_L(N, 0.25f), ref_R(N, -0.25f);
+	    std::vector<float> out_L(N, 0.25f), out_R(N, -0.25f);
+
+	    VoiceKernels::set_isa(VoiceKernels::Scalar);
+	    VoiceKernels::pan_mix( &src_L[0], s_R, from, to,
+				   &ref_L[0], &ref_R[0], N, overwrite );
+	    VoiceKernels::set_isa(i);
+	    VoiceKernels::pan_mix( &src_L[0], s_R, from, to,
+				   &out_L[0], &out_R[0], N, overwrite );
+
+	    bool same = true;
+	    for( uint32_t k=0 ; k<N ; ++k ) {
+		if( out_L[k] != ref_L[k] ) same = false;
+		if( out_R[k] != ref_R[k] ) same = false;
+	    }
+	    CK( same );
+	}
+    };
+
+} // namespace THIS_NAMESPACE
+
+TEST_BEGIN( Fixture );
+
+TEST_CASE( 010_set_isa )
+{
+    CK( VoiceKernels::isa() == VoiceKernels::detected_isa() );
+    CK( VoiceKernels::set_isa(VoiceKernels::Scalar) == VoiceKernels::Scalar );
+    CK( VoiceKernels::isa() == VoiceKernels::Scalar );
+    CK( VoiceKernels::set_isa(VoiceKernels::AVX2) == VoiceKernels::detected_isa() );
+}
+
+TEST_CASE( 020_mix_matches_reference )
+{
+    check_isa( VoiceKernels::Scalar, true );
+    check_isa( VoiceKernels::SSE2, true );
+    check_isa( VoiceKernels::AVX2, true );
+    check_isa( VoiceKernels::SSE2, false );
+    check_isa( VoiceKernels::AVX2, false );
+}
+
+TEST_CASE( 030_mix_short_blocks )
+{
+    // Shorter than any SIMD width: only the tails run.
+    float out_L[3] = { 0.0f, 0.0f, 0.0f };
+    float out_R[3] = { 0.0f, 0.0f, 0.0f };
+    float pk_L = 0.0f, pk_R = 0.0f;
+    VoiceKernels::mix( &src_L[0], &src_R[0], &env[0], 1.0f, 1.0f,
+		       out_L, out_R, 3, pk_L, pk_R );
+    for( int k=0 ; k<3 ; ++k ) {
+	CK( out_L[k] == src_L[k] * env[k] * 1.0f );
+	CK( out_R[k] == src_R[k] * env[k] * 1.0f );
+    }
+    VoiceKernels::mix( &src_L[0], &src_R[0], &env[0], 1.0f, 1.0f,
+		       out_L, out_R, 0, pk_L, pk_R );
+}
+
+TEST_CASE( 040_interpolate )
+{
+    const float data_L[4] = { 0.0f, 1.0f, 2.0f, 3.0f };
+    const float data_R[4] = { 0.0f, -1.0f, -2.0f, -3.0f };
+    float out_L[6], out_R[6];
+    float pos;
+
+    pos = VoiceKernels::interpolate( data_L, data_R, 4, 0.0f, 0.5f,
+				     out_L, out_R, 6 );
+    CK( pos == 3.0f );
+    CK( out_L[0] == 0.0f );
+    CK( out_L[1] == 0.5f );
+    CK( out_L[2] == 1.0f );
+    CK( out_L[3] == 1.5f );
+    CK( out_L[4] == 2.0f );
+    CK( out_L[5] == 2.5f );
+    CK( out_R[5] == -2.5f );
+
+    // Past the end interpolates towards zero.
+    pos = VoiceKernels::interpolate( data_L, data_R, 4, 3.5f, 1.0f,
+				     out_L, out_R, 1 );
+    CK( out_L[0] == 1.5f );
+    CK( out_R[0] == -1.5f );
+}
+
+TEST_CASE( 050_pan_mix_matches_reference )
+{
+    int i, stereo, overwrite, ramp;
+    for( i = VoiceKernels::SSE2 ; i <= VoiceKernels::AVX2 ; ++i ) {
+	for( stereo=0 ; stereo<2 ; ++stereo ) {
+	    for( overwrite=0 ; overwrite<2 ; ++overwrite ) {
+		for( ramp=0 ; ramp<2 ; ++ramp ) {
+		    check_pan_mix( VoiceKernels::isa_t(i), stereo, overwrite, ramp );
+		}
+	    }
+	}
+    }
+}
+
+TEST_CASE( 060_pan_mix_gains )
+{
+    const uint32_t n = 16;
+    const float ones[n] = { 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
+			    1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f };
+    const float from[4] = { 0.0f, 1.0f, 0.5f, 0.5f };
+    const float to[4] = { 1.0f, 0.0f, 0.5f, 0.5f };
+    float out_L[n], out_R[n];
+
+    // Constant gains; stereo input, overwriting the output.
+    VoiceKernels::pan_mix( ones, ones, to, to, out_L, out_R, n, true );
+    for( uint32_t k=0 ; k<n ; ++k ) {
+	CK( out_L[k] == 1.5f );
+	CK( out_R[k] == 0.5f );
+    }
+
+    // Ramped gains on a mono input (PAN_RL/PAN_RR are ignored).
+    VoiceKernels::pan_mix( ones, 0, from, to, out_L, out_R, n, true );
+    for( uint32_t k=0 ; k<n ; ++k ) {
+	CK( out_L[k] == float(k+1) / n );
+	CK( out_R[k] == 1.0f - float(k+1) / n );
+    }
+}
+
+TEST_CASE( 070_clip_peak )
+{
+    int i;
+    for( i = VoiceKernels::Scalar ; i <= VoiceKernels::AVX2 ; ++i ) {
+	std::vector<float> buf(src_L);
+	float ref = 0.0f;
+	buf[17] = -0.95f;
+	for( uint32_t k=0 ; k<N ; ++k ) {
+	    buf[k] *= 0.9f;
+	    float a = (buf[k] < 0.0f) ? -buf[k] : buf[k];
+	    if( a > ref ) ref = a;
+	}
+	VoiceKernels::set_isa( VoiceKernels::isa_t(i) );
+	CK( VoiceKernels::clip_peak(&buf[0], N) == ref );
+
+	buf[3] = 2.0f;
+	buf[N-1] = -3.0f;
+	CK( VoiceKernels::clip_peak(&buf[0], N) == 1.0f );
+	CK( buf[3] == 1.0f );
+	CK( buf[N-1] == -1.0f );
+    }
+    CK( VoiceKernels::clip_peak(0, 0) == 0.0f );
+}
+
+TEST_CASE( 080_low_pass )
+{
+    const int L = VoiceKernels::FILTER_LANES;
+    const uint32_t n = 200;
+    float cut[L], res[L], cut2[L];
+    std::vector<float> x(n * L);
+    int i, j;
+
+    for( j=0 ; j<L ; ++j ) {
+	cut[j] = 0.1f + 0.1f * j;
+	res[j] = 0.8f - 0.05f * j;
+	cut2[j] = 1.0f - 0.1f * j;
+    }
+    for( uint32_t k=0 ; k<n ; ++k ) {
+	for( j=0 ; j<L ; ++j ) {
+	    x[k*L + j] = src_L[k + j];
+	}
+    }
+
+    // Each lane is the Sampler's old per-voice filter.
+    std::vector<float> ref(x);
+    for( j=0 ; j<L ; ++j ) {
+	float bp = 0.0f, lp = 0.0f;
+	for( uint32_t k=0 ; k<n ; ++k ) {
+	    bp = res[j] * bp + cut[j] * ( ref[k*L + j] - lp );
+	    lp += cut[j] * bp;
+	    ref[k*L + j] = lp;
+	}
+    }
+
+    for( i = VoiceKernels::Scalar ; i <= VoiceKernels::AVX2 ; ++i ) {
+	VoiceKernels::set_isa( VoiceKernels::isa_t(i) );
+	float bp[L], lp[L];
+	for( j=0 ; j<L ; ++j ) bp[j] = lp[j] = 0.0f;
+
+	// In two blocks: the state carries over.
+	std::vector<float> out(x);
+	VoiceKernels::low_pass( &out[0], 77, bp, lp, cut, cut, res, res );
+	VoiceKernels::low_pass( &out[77 * L], n - 77, bp, lp, cut, cut, res, res );
+	CK( out == ref );
+	for( j=0 ; j<L ; ++j ) {
+	    CK( lp[j] == ref[(n-1)*L + j] );
+	}
+    }
+
+    // Gliding coefficients are the same on every ISA.
+    std::vector<float> glide_ref(x);
+    float bp[L], lp[L];
+    for( j=0 ; j<L ; ++j ) bp[j] = lp[j] = 0.0f;
+    VoiceKernels::set_isa( VoiceKernels::Scalar );
+    VoiceKernels::low_pass( &glide_ref[0], n, bp, lp, cut, cut2, res, cut );
+    for( i = VoiceKernels::SSE2 ; i <= VoiceKernels::AVX2 ; ++i ) {
+	VoiceKernels::set_isa( VoiceKernels::isa_t(i) );
+	for( j=0 ; j<L ; ++j ) bp[j] = lp[j] = 0.0f;
+	std::vector<float> out(x);
+	VoiceKernels::low_pass( &out[0], n, bp, lp, cut, cut2, res, cut );
+	CK( out == glide_ref );
+    }
+    CK( glide_ref != ref );
+}
+
+TEST_END()
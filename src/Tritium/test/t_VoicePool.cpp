@@ -0,0 +1,161 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Tritium
+ *
+ * Tritium is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Tritium is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * t_VoicePool.cpp
+ *
+ * Tests the Sampler's preallocated voice pool.
+ */
+
+#include "../src/VoicePool.hpp"
+#include <Tritium/Instrument.hpp>
+#include <Tritium/Logger.hpp>
+#include <Tritium/memory.hpp>
+#include <set>
+
+// CHANGE THIS TO MATCH YOUR FILE:
+#define THIS_NAMESPACE t_VoicePool
+#include "test_macros.hpp"
+#include "test_config.hpp"
+
+using namespace Tritium;
+
+namespace THIS_NAMESPACE
+{
+    struct Fixture
+    {
+	VoicePool pool;
+
+	Fixture() : pool(8) {}
+	~Fixture() {}
+
+	size_t count_active() {
+	    size_t n = 0;
+	    for( int v = pool.first() ; v != -1 ; v = pool.next(v) ) ++n;
+	    return n;
+	}
+    };
+
+} // namespace THIS_NAMESPACE
+
+TEST_BEGIN( Fixture );
+
+TEST_CASE( 010_defaults )
+{
+    CK( pool.capacity() == 8 );
+    CK( pool.size() == 0 );
+    CK( pool.limit() == 8 );
+    CK( ! pool.full() );
+    CK( pool.first() == -1 );
+}
+
+TEST_CASE( 020_allocate_release )
+{
+    std::set<int> seen;
+    int v[8];
+    int k;
+
+    for( k=0 ; k<8 ; ++k ) {
+	v[k] = pool.allocate();
+	CK( v[k] >= 0 );
+	CK( v[k] < 8 );
+	seen.insert(v[k]);
+    }
+    CK( seen.size() == 8 );
+    CK( pool.size() == 8 );
+    CK( pool.full() );
+    CK( pool.allocate() == -1 );
+
+    // Active list is in start order.
+    CK( pool.first() == v[0] );
+    for( k=0 ; k<7 ; ++k ) {
+	CK( pool.next(v[k]) == v[k+1] );
+	CK( pool.serial(v[k]) < pool.serial(v[k+1]) );
+    }
+    CK( pool.next(v[7]) == -1 );
+
+    // Release from the middle, head, and tail
+    pool.release(v[3]);
+    pool.release(v[0]);
+    pool.release(v[7]);
+    CK( pool.size() == 5 );
+    CK( count_active() == 5 );
+    CK( pool.first() == v[1] );
+    CK( pool.next(v[2]) == v[4] );
+    CK( pool.next(v[6]) == -1 );
+
+    // Reused voices go to the end of the list.
+    int w = pool.allocate();
+    CK( w == v[7] || w == v[0] || w == v[3] );
+    CK( pool.next(v[6]) == w );
+    CK( pool.next(w) == -1 );
+    CK( count_active() == 6 );
+}
+
+TEST_CASE( 030_limit )
+{
+    pool.set_limit(2);
+    CK( pool.limit() == 2 );
+    CK( pool.allocate() != -1 );
+    CK( pool.allocate() != -1 );
+    CK( pool.full() );
+    CK( pool.allocate() == -1 );
+
+    pool.set_limit(1000);
+    CK( pool.limit() == 8 );
+    CK( ! pool.full() );
+}
+
+TEST_CASE( 040_voices_are_stable )
+{
+    Logger::create_instance();
+    T<Instrument>::shared_ptr inst = Instrument::create_empty();
+    int a = pool.allocate();
+    int b = pool.allocate();
+    pool.voice(a).instrument = inst.get();
+    pool.voice(a).velocity = 0.25f;
+    pool.voice(b).velocity = 0.75f;
+    pool.release( pool.allocate() );
+    CK( pool.voice(a).instrument == inst.get() );
+    CK( pool.voice(a).velocity == 0.25f );
+    CK( pool.voice(b).velocity == 0.75f );
+}
+
+TEST_CASE( 050_voice_state )
+{
+    int a = pool.allocate();
+    CK( &pool.voice(a).stream == &pool.stream(a) );
+    CK( pool.voice(a).instrument == 0 );
+
+    pool.voice(a).port = 3;
+    pool.voice(a).sample_position = 100.0f;
+    pool.stream(a) = 5;
+    pool.release(a);
+
+    // A reused voice is not reset, except for its stream.
+    int b = pool.allocate();
+    CK( b == a );
+    CK( pool.stream(b) == -1 );
+    CK( pool.voice(b).port == 3 );
+    CK( pool.voice(b).sample_position == 100.0f );
+}
+
+TEST_END()
@@ -32,8 +32,14 @@
 #include <Tritium/IO/MidiInput.hpp>
 #include <Tritium/IO/AudioOutput.hpp>
 #include <Tritium/Sampler.hpp>
+#include <Tritium/ProcessProfile.hpp>
+#include <Tritium/Instrument.hpp>
+#include <Tritium/InstrumentList.hpp>
 using namespace Tritium;
 
+#include <algorithm>
+#include <vector>
+
 #include "Skin.hpp"
 
 AudioEngineInfoForm::AudioEngineInfoForm(QWidget* parent)
@@ -73,6 +79,8 @@ AudioEngineInfoForm::~AudioEngineInfoForm()
  */
 void AudioEngineInfoForm::showEvent ( QShowEvent* )
 {
+	g_engine->set_instrument_profiling( true );
+	g_engine->reset_process_profile();
 	updateInfo();
 	timer->start(200);
 }
@@ -86,6 +94,7 @@ void AudioEngineInfoForm::showEvent ( QShowEvent* )
 void AudioEngineInfoForm::hideEvent ( QHideEvent* )
 {
 	timer->stop();
+	g_engine->set_instrument_profiling( false );
 }
 
 
@@ -202,6 +211,71 @@ void AudioEngineInfoForm::updateInfo()
 	T<Sampler>::shared_ptr pSampler = g_engine->get_sampler();
 	sampler_playingNotesLbl->setText(QString( "%1 / %2" ).arg(pSampler->get_playing_notes_number()).arg(g_engine->get_preferences()->m_nMaxNotes));
 
+	updateProfile();
+}
+
+
+
+namespace
+{
+	/// Orders instrument indexes by their longest render time.
+	struct SlowerInstrument
+	{
+		const ProcessProfile& p;
+		SlowerInstrument( const ProcessProfile& prof ) : p( prof ) {}
+		bool operator()( unsigned a, unsigned b ) const {
+			return p.instruments[a].max > p.instruments[b].max;
+		}
+	};
+
+	QString ms( float t )
+	{
+		return QString( "%1" ).arg( t, 7, 'f', 3 );
+	}
+}
+
+/**
+ * Update profileLbl with the stage timing and the slowest instruments.
+ */
+void AudioEngineInfoForm::updateProfile()
+{
+	ProcessProfile p;
+	g_engine->get_process_profile( p );
+
+	QString txt = QString( "%1   last    mean     p50     p99   p99.9     max\n" )
+		.arg( "", -10 );
+	for ( int k = 0; k < ProcessProfile::STAGE_COUNT; ++k ) {
+		const ProcessProfile::Stage& s = p.stages[k];
+		txt += QString( "%1" ).arg( ProcessProfile::stage_name( ProcessProfile::stage_t(k) ), -10 )
+			+ ms( s.last ) + " " + ms( s.mean ) + " " + ms( s.p50 ) + " "
+			+ ms( s.p99 ) + " " + ms( s.p999 ) + " " + ms( s.max ) + "\n";
+	}
+	txt += QString( "\nPeriod %1  cycles %2  overruns %3  xruns %4\n" )
+		.arg( p.period, 0, 'f', 3 )
+		.arg( (qulonglong)p.cycles )
+		.arg( p.overruns )
+		.arg( p.xruns );
+
+	// The instruments that took longest.
+	std::vector<unsigned> order;
+	for ( unsigned k = 0; k < p.instruments.size(); ++k ) {
+		if ( p.instruments[k].max > 0.0f ) order.push_back( k );
+	}
+	unsigned nTop = std::min( (unsigned)order.size(), 5u );
+	std::partial_sort( order.begin(), order.begin() + nTop, order.end(), SlowerInstrument( p ) );
+
+	T<InstrumentList>::shared_ptr pList = g_engine->get_sampler()->get_instrument_list();
+	txt += QString( "\n%1 voices    last     max\n" ).arg( "Instrument", -20 );
+	for ( unsigned k = 0; k < nTop; ++k ) {
+		unsigned n = order[k];
+		QString name = ( n < pList->get_size() ) ? pList->get( n )->get_name() : QString::number( n );
+		const ProcessProfile::Instrument& I = p.instruments[n];
+		txt += QString( "%1" ).arg( name.left( 20 ), -20 )
+			+ QString( "%1" ).arg( I.voices, 7 ) + " "
+			+ ms( I.render ) + " " + ms( I.max ) + "\n";
+	}
+
+	profileLbl->setText( txt );
 }
 
 
@@ -40,6 +40,7 @@ class AudioEngineInfoForm : public QWidget, public Ui_AudioEngineInfoForm_UI, pu
 		QTimer *timer;
 
 		virtual void updateAudioEngineState();
+		void updateProfile();
 
 		// EventListener implementation
 		virtual void stateChangedEvent(int nState);
@@ -94,6 +94,7 @@ CompositeApp::CompositeApp( MainForm *pMainForm, T<Song>::shared_ptr pFirstSong
  , m_pFirstTimeInfo( NULL )
  , m_pPlayerControl( NULL )
  , m_pPlaylistDialog( NULL )
+ , m_nDroppedEvents( 0 )
 
 {
 	m_pInstance = this;
@@ -473,6 +474,13 @@ void CompositeApp::onEventQueueTimer()
 
 		}
 	}
+
+	unsigned nDropped = pQueue->get_dropped();
+	if ( nDropped != m_nDroppedEvents ) {
+		WARNINGLOG( QString("[onEventQueueTimer] %1 events were dropped (queue full)")
+			    .arg( nDropped - m_nDroppedEvents ) );
+		m_nDroppedEvents = nDropped;
+	}
 }
 
 
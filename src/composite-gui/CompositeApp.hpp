@@ -126,6 +126,7 @@ class CompositeApp : public QObject
 //		AudioFileBrowser *m_pAudioFileBrowser;
 
 		QTimer *m_pEventQueueTimer;
+		unsigned m_nDroppedEvents;	///< EventQueue::get_dropped() at the last check
 		std::vector<EventListener*> m_eventListeners;
 
 		// implement EngineListener interface
@@ -31,6 +31,7 @@
 #include <Tritium/ADSR.hpp>
 #include <Tritium/Sample.hpp>
 #include <Tritium/Sampler.hpp>
+#include <Tritium/Reaper.hpp>
 #include <Tritium/Instrument.hpp>
 #include <Tritium/InstrumentLayer.hpp>
 #include <Tritium/InstrumentList.hpp>
@@ -547,14 +548,19 @@ void InstrumentEditor::buttonClicked( Button* pButton )
 		//Engine *pEngine = g_engine;
 		g_engine->lock( RIGHT_HERE );
 
+		Tritium::InstrumentLayer *pLayer = NULL;
 		if ( m_pInstrument ) {
-			Tritium::InstrumentLayer *pLayer = m_pInstrument->get_layer( m_nSelectedLayer );
+			pLayer = m_pInstrument->get_layer( m_nSelectedLayer );
 			if ( pLayer ) {
 				m_pInstrument->set_layer( NULL, m_nSelectedLayer );
-				delete pLayer;
 			}
 		}
 		g_engine->unlock();
+
+		// The layer may still be playing.
+		if ( pLayer ) {
+			g_engine->get_sampler()->get_reaper()->defer( pLayer, pLayer->get_sample_bytes() );
+		}
 		selectedInstrumentChangedEvent();    // update all
 		m_pLayerPreview->updateAll();
 	}
@@ -604,6 +610,7 @@ void InstrumentEditor::loadLayer()
 			T<Sample>::shared_ptr newSample = Sample::load( filename[i] );
 	
 			T<Instrument>::shared_ptr pInstr;
+			Tritium::InstrumentLayer *pOldLayer = NULL;
 	
 			g_engine->lock( RIGHT_HERE );
 			T<Song>::shared_ptr song = g_engine->getSong();
@@ -618,15 +625,16 @@ void InstrumentEditor::loadLayer()
 			selectedLayer = m_nSelectedLayer + i - 2;
 
 			
-			Tritium::InstrumentLayer *pLayer = pInstr->get_layer( selectedLayer );
-			if (pLayer != NULL) {
-				// overwrite sample from newInstrument
-				pLayer->set_sample( newSample );
-			}
-			else {
-				pLayer = new Tritium::InstrumentLayer(newSample);
-				pInstr->set_layer( pLayer, selectedLayer );
+			// A playing layer is not changed: a new one with the
+			// old settings takes its place.
+			Tritium::InstrumentLayer *pLayer = new Tritium::InstrumentLayer(newSample);
+			pOldLayer = pInstr->get_layer( selectedLayer );
+			if (pOldLayer != NULL) {
+				pLayer->set_velocity_range( pOldLayer->get_velocity_range() );
+				pLayer->set_pitch( pOldLayer->get_pitch() );
+				pLayer->set_gain( pOldLayer->get_gain() );
 			}
+			pInstr->set_layer( pLayer, selectedLayer );
 	
 			if ( fnc ){
 				QString newfilename = filename[i].section( '/', -1 );
@@ -643,6 +651,11 @@ void InstrumentEditor::loadLayer()
 	
 			g_engine->unlock();
 
+			// The old layer may still be playing.
+			if ( pOldLayer ) {
+				g_engine->get_sampler()->get_reaper()->defer( pOldLayer, pOldLayer->get_sample_bytes() );
+			}
+
 		}
 	}
 
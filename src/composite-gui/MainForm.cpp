@@ -22,6 +22,7 @@
 
 #include <Tritium/Engine.hpp>
 #include <Tritium/Sampler.hpp>
+#include <Tritium/Reaper.hpp>
 #include <Tritium/Transport.hpp>
 #include <Tritium/Playlist.hpp>
 #include <Tritium/ADSR.hpp>
@@ -66,6 +67,7 @@ using namespace Tritium;
 #endif
 
 #include <memory>
+#include <vector>
 #include <cassert>
 
 using namespace std;
@@ -685,6 +687,7 @@ void MainForm::action_instruments_clearAll()
 	}
 
 	// Remove all layers
+	std::vector<InstrumentLayer*> oldLayers;
 	g_engine->lock( RIGHT_HERE );
 	T<Song>::shared_ptr pSong = g_engine->getSong();
 	T<InstrumentList>::shared_ptr pList = g_engine->get_sampler()->get_instrument_list();
@@ -694,11 +697,19 @@ void MainForm::action_instruments_clearAll()
 		// remove all layers
 		for ( int nLayer = 0; nLayer < MAX_LAYERS; nLayer++ ) {
 			InstrumentLayer* pLayer = pInstr->get_layer( nLayer );
-			delete pLayer;
-			pInstr->set_layer( NULL, nLayer );
+			if ( pLayer ) {
+				pInstr->set_layer( NULL, nLayer );
+				oldLayers.push_back( pLayer );
+			}
 		}
 	}
 	g_engine->unlock();
+
+	// The old layers may still be playing.
+	T<Reaper>::shared_ptr reaper = g_engine->get_sampler()->get_reaper();
+	for ( size_t k = 0; k < oldLayers.size(); ++k ) {
+		reaper->defer( oldLayers[k], oldLayers[k]->get_sample_bytes() );
+	}
 	g_engine->get_event_queue()->push_event( EVENT_SELECTED_INSTRUMENT_CHANGED, -1 );
 }
 
@@ -198,6 +198,7 @@ void DrumPatternEditor::mousePressEvent(QMouseEvent *ev)
 				g_engine->midi_noteOn(pNote2);
 			}
 		}
+		m_pPattern->compile_events();
 		pSong->set_modified( true );
 		g_engine->unlock(); // unlock the audio engine
 	}
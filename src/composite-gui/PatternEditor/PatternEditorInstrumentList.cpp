@@ -297,6 +297,7 @@ void InstrumentLine::functionFillNotes()
 					pCurrentPattern->note_map.insert( std::make_pair( i, pNote ) );
 				}
 			}
+			pCurrentPattern->compile_events();
 		}
 	}
 	g_engine->unlock();	// unlock the audio engine
@@ -447,29 +448,14 @@ void PatternEditorInstrumentList::moveInstrumentLine( int nSourceInstrument , in
 		T<Song>::shared_ptr pSong = engine->getSong();
 		T<InstrumentList>::shared_ptr pInstrumentList = g_engine->get_sampler()->get_instrument_list();
 
-		if ( ( nTargetInstrument > (int)pInstrumentList->get_size() ) || ( nTargetInstrument < 0) ) {
+		if ( ( nTargetInstrument >= (int)pInstrumentList->get_size() ) || ( nTargetInstrument < 0) ) {
 			g_engine->unlock();
 			return;
 		}
 
 
 		// move instruments...
-
-		T<Instrument>::shared_ptr pSourceInstr = pInstrumentList->get(nSourceInstrument);
-		if ( nSourceInstrument < nTargetInstrument) {
-			for (int nInstr = nSourceInstrument; nInstr < nTargetInstrument; nInstr++) {
-				T<Instrument>::shared_ptr pInstr = pInstrumentList->get(nInstr + 1);
-				pInstrumentList->replace( pInstr, nInstr );
-			}
-			pInstrumentList->replace( pSourceInstr, nTargetInstrument );
-		}
-		else {
-			for (int nInstr = nSourceInstrument; nInstr >= nTargetInstrument; nInstr--) {
-				T<Instrument>::shared_ptr pInstr = pInstrumentList->get(nInstr - 1);
-				pInstrumentList->replace( pInstr, nInstr );
-			}
-			pInstrumentList->replace( pSourceInstr, nTargetInstrument );
-		}
+		g_engine->get_sampler()->move_instrument( nSourceInstrument, nTargetInstrument );
 
 		#ifdef JACK_SUPPORT
 		engine->renameJackPorts();
@@ -843,6 +843,7 @@ void PatternEditorPanel::patternSizeChanged( QString str )
 
 	if ( nSelected > 0 && nSelected <= 32 ) {
 		m_pPattern->set_length( nEighth * nSelected );
+		g_engine->getSong()->set_modified( true );
 		//m_pPatternSizeLCD->setText( QString( "%1" ).arg( nSelected ) );
 	}
 	else {
@@ -872,9 +873,7 @@ void PatternEditorPanel::moveUpBtnClicked(Button *)
 	T<InstrumentList>::shared_ptr pInstrumentList = g_engine->get_sampler()->get_instrument_list();
 
 	if ( ( nSelectedInstrument - 1 ) >= 0 ) {
-		T<Instrument>::shared_ptr pTemp = pInstrumentList->get( nSelectedInstrument - 1 );
-		pInstrumentList->replace( pInstrumentList->get( nSelectedInstrument ), nSelectedInstrument - 1 );
-		pInstrumentList->replace( pTemp, nSelectedInstrument );
+		g_engine->get_sampler()->move_instrument( nSelectedInstrument, nSelectedInstrument - 1 );
 
 /*
 		// devo spostare tutte le note...
@@ -913,9 +912,7 @@ void PatternEditorPanel::moveDownBtnClicked(Button *)
 	T<InstrumentList>::shared_ptr pInstrumentList = g_engine->get_sampler()->get_instrument_list();
 
 	if ( ( nSelectedInstrument + 1 ) < (int)pInstrumentList->get_size() ) {
-		T<Instrument>::shared_ptr pTemp = pInstrumentList->get( nSelectedInstrument + 1 );
-		pInstrumentList->replace( pInstrumentList->get( nSelectedInstrument ), nSelectedInstrument + 1 );
-		pInstrumentList->replace( pTemp, nSelectedInstrument );
+		g_engine->get_sampler()->move_instrument( nSelectedInstrument, nSelectedInstrument + 1 );
 
 /*
 		// devo spostare tutte le note...
@@ -114,6 +114,7 @@ void SongEditor::keyPressEvent ( QKeyEvent * ev )
 				T<PatternList>::shared_ptr pColumn = (*pColumns)[ cell.x() ];
 				pColumn->del(pPatternList->get( cell.y() ) );
 			}
+			pEngine->getSong()->set_modified( true );
 			g_engine->unlock();
 
 			m_selectedCells.clear();
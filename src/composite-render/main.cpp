@@ -0,0 +1,523 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Composite
+ *
+ * Composite is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Composite is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/**
+ * composite-render: render songs to audio files without the GUI.
+ *
+ * The songs are rendered with the offline export driver and the
+ * "Fake" audio driver, so neither a JACK server nor an X server is
+ * needed.  With -j N, N songs are rendered at once, each in its own
+ * process.  A JSON report with the timing and peak levels of every
+ * song is written at the end.
+ */
+
+#include <Tritium/Engine.hpp>
+#include <Tritium/EventQueue.hpp>
+#include <Tritium/ExportSettings.hpp>
+#include <Tritium/Logger.hpp>
+#include <Tritium/Preferences.hpp>
+#include <Tritium/Song.hpp>
+#include <Tritium/memory.hpp>
+
+#include <QString>
+#include <QFileInfo>
+#include <QDir>
+#include <QFile>
+
+#include <getopt.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <vector>
+
+using namespace Tritium;
+
+namespace
+{
+    struct Options
+    {
+	ExportSettings settings;
+	QString out_dir;
+	QString report;
+	QString format;
+	unsigned jobs;
+	const char* log_level;
+
+	Options() :
+	    jobs(1),
+	    log_level("Error")
+	    {
+		settings.sample_rate = 48000;
+	    }
+    };
+
+    struct Result
+    {
+	QString song;
+	QString output;
+	QString error;
+	unsigned sample_rate;
+	uint32_t frames;
+	uint32_t song_frames;
+	double load_seconds;
+	double render_seconds;
+	float peak_L;
+	float peak_R;
+
+	Result() :
+	    sample_rate(0),
+	    frames(0),
+	    song_frames(0),
+	    load_seconds(0),
+	    render_seconds(0),
+	    peak_L(0),
+	    peak_R(0)
+	    {}
+    };
+
+    /// A process rendering songs[index] (see render_forked()).
+    struct Child
+    {
+	size_t index;
+	int fd;         // Read end of its pipe
+    };
+
+    static struct option long_opts[] = {
+	{"output-dir", required_argument, NULL, 'o'},
+	{"format", required_argument, NULL, 'f'},
+	{"bits", required_argument, NULL, 'b'},
+	{"rate", required_argument, NULL, 'r'},
+	{"block", required_argument, NULL, 'B'},
+	{"tail", required_argument, NULL, 't'},
+	{"threads", required_argument, NULL, 'T'},
+	{"jobs", required_argument, NULL, 'j'},
+	{"report", required_argument, NULL, 'R'},
+	{"verbose", optional_argument, NULL, 'V'},
+	{"help", 0, NULL, 'h'},
+	{0, 0, 0, 0},
+    };
+
+#define NELEM(a) ( sizeof(a)/sizeof((a)[0]) )
+
+    void show_usage()
+    {
+	std::cout << "Usage: composite-render [options] song.h2song ..." << std::endl;
+	std::cout << "   -o, --output-dir DIR - Write the files to DIR (default: next to each song)" << std::endl;
+	std::cout << "   -f, --format FORMAT - wav or flac (default: wav)" << std::endl;
+	std::cout << "   -b, --bits BITS - 16, 24 or float (default: 16)" << std::endl;
+	std::cout << "   -r, --rate HZ - Sample rate (default: 48000)" << std::endl;
+	std::cout << "   -B, --block FRAMES - Frames per process cycle (default: 4096)" << std::endl;
+	std::cout << "   -t, --tail SECONDS - Longest tail after the last bar (default: 10)" << std::endl;
+	std::cout << "   -T, --threads N - Sampler render threads per song (default: one per extra CPU)" << std::endl;
+	std::cout << "   -j, --jobs N - Render N songs at once, in separate processes (default: 1)" << std::endl;
+	std::cout << "   -R, --report FILE - Write the JSON report to FILE (default: standard output)" << std::endl;
+	std::cout << "   -V[Level], --verbose[=Level] - Print a lot of debugging info" << std::endl;
+	std::cout << "                 Level, if present, may be None, Error, Warning, Info, Debug or 0xHHHH" << std::endl;
+	std::cout << "   -h, --help - Show this help message" << std::endl;
+    }
+
+    double now()
+    {
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec + tv.tv_usec / 1000000.0;
+    }
+
+    QString json_string(const QString& s)
+    {
+	QByteArray in = s.toUtf8();
+	QByteArray out("\"");
+	char esc[8];
+	for( int k=0 ; k<in.size() ; ++k ) {
+	    unsigned char c = in[k];
+	    if( c == '"' || c == '\\' ) {
+		out += '\\';
+		out += char(c);
+	    } else if( c < 0x20 ) {
+		snprintf(esc, sizeof(esc), "\\u%04x", c);
+		out += esc;
+	    } else {
+		out += char(c);
+	    }
+	}
+	out += '"';
+	return QString::fromUtf8(out.constData(), out.size());
+    }
+
+    QString json_number(double x, int precision)
+    {
+	return QString::number(x, 'f', precision);
+    }
+
+    /// Peak in dBFS, or null if silent.
+    QString json_dbfs(float peak)
+    {
+	if( peak <= 0.0f ) return "null";
+	return json_number(20.0 * log10(peak), 2);
+    }
+
+    QString to_json(const Result& r)
+    {
+	QString s("    {\n");
+	s += "      \"song\": " + json_string(r.song) + ",\n";
+	s += "      \"output\": " + json_string(r.output) + ",\n";
+	if( r.error.isEmpty() ) {
+	    s += "      \"status\": \"ok\",\n";
+	} else {
+	    s += "      \"status\": \"failed\",\n";
+	    s += "      \"error\": " + json_string(r.error) + ",\n";
+	}
+	double seconds = r.sample_rate ? double(r.frames) / r.sample_rate : 0.0;
+	s += "      \"sample_rate\": " + QString::number(r.sample_rate) + ",\n";
+	s += "      \"frames\": " + QString::number(r.frames) + ",\n";
+	s += "      \"song_frames\": " + QString::number(r.song_frames) + ",\n";
+	s += "      \"seconds\": " + json_number(seconds, 3) + ",\n";
+	s += "      \"load_seconds\": " + json_number(r.load_seconds, 3) + ",\n";
+	s += "      \"render_seconds\": " + json_number(r.render_seconds, 3) + ",\n";
+	s += "      \"realtime_factor\": "
+	    + ( r.render_seconds > 0 ? json_number(seconds / r.render_seconds, 2) : QString("null") )
+	    + ",\n";
+	s += "      \"peak_left\": " + json_number(r.peak_L, 6) + ",\n";
+	s += "      \"peak_right\": " + json_number(r.peak_R, 6) + ",\n";
+	s += "      \"peak_left_dbfs\": " + json_dbfs(r.peak_L) + ",\n";
+	s += "      \"peak_right_dbfs\": " + json_dbfs(r.peak_R) + "\n";
+	s += "    }";
+	return s;
+    }
+
+    QString output_name(const Options& opt, const QString& song)
+    {
+	QFileInfo info(song);
+	QString dir = opt.out_dir.isEmpty() ? info.absolutePath() : opt.out_dir;
+	QString ext = (opt.settings.format == ExportSettings::FLAC) ? "flac" : "wav";
+	return QString("%1/%2.%3").arg(dir).arg(info.completeBaseName()).arg(ext);
+    }
+
+    Result render_song(const Options& opt, const QString& song)
+    {
+	Result r;
+	r.song = song;
+	r.output = output_name(opt, song);
+	r.sample_rate = opt.settings.sample_rate;
+
+	T<Preferences>::shared_ptr prefs( new Preferences );
+	prefs->m_sAudioDriver = "Fake";
+	// The samples are converted to the driver's rate as they are
+	// loaded.  Make it the export rate.
+	prefs->m_nSampleRate = opt.settings.sample_rate;
+	prefs->m_sMidiDriver = "None";
+	T<Engine>::auto_ptr engine( new Engine(prefs) );
+
+	double start = now();
+	T<Song>::shared_ptr pSong = Song::load( engine.get(), song );
+	if( ! pSong ) {
+	    r.error = "Could not load the song";
+	    return r;
+	}
+	engine->setSong( pSong );
+	r.load_seconds = now() - start;
+
+	ExportSettings settings = opt.settings;
+	settings.filename = r.output;
+
+	start = now();
+	engine->startExportSong( settings );
+	ExportStatus status;
+	if( ! engine->getExportStatus(status) ) {
+	    r.error = "Could not start the export";
+	    return r;
+	}
+	while( ! status.finished ) {
+	    // Nobody else reads the events.
+	    while( engine->get_event_queue()->pop_event().type != EVENT_NONE ) {}
+	    usleep(10000);
+	    engine->getExportStatus(status);
+	}
+	r.render_seconds = now() - start;
+	engine->stopExportSong();
+
+	r.frames = status.frames;
+	r.song_frames = status.song_frames;
+	r.peak_L = status.peak_L;
+	r.peak_R = status.peak_R;
+	if( status.failed ) {
+	    r.error = "Could not write " + r.output;
+	}
+	return r;
+    }
+
+    /// Render in this process.
+    QString render_here(const Options& opt, const QString& song, bool& ok)
+    {
+	Result r = render_song(opt, song);
+	ok = r.error.isEmpty();
+	return to_json(r);
+    }
+
+    /**
+     * Render the songs in up to opt.jobs child processes.  Each
+     * child renders one song and sends its report through a pipe.
+     */
+    void render_forked(const Options& opt,
+		       const std::vector<QString>& songs,
+		       std::vector<QString>& reports,
+		       bool& all_ok)
+    {
+	std::map<pid_t, Child> running;
+	size_t next = 0;
+
+	while( next < songs.size() || ! running.empty() ) {
+	    while( next < songs.size() && running.size() < opt.jobs ) {
+		int fds[2];
+		if( pipe(fds) != 0 ) {
+		    perror("pipe");
+		    exit(1);
+		}
+		pid_t pid = fork();
+		if( pid < 0 ) {
+		    perror("fork");
+		    exit(1);
+		}
+		if( pid == 0 ) {
+		    close(fds[0]);
+		    Logger::create_instance();
+		    Logger::set_logging_level(opt.log_level);
+		    bool ok;
+		    QByteArray json = render_here(opt, songs[next], ok).toUtf8();
+		    delete Logger::get_instance();
+		    ssize_t done = 0;
+		    while( done < json.size() ) {
+			ssize_t n = ::write(fds[1], json.constData() + done, json.size() - done);
+			if( n <= 0 ) break;
+			done += n;
+		    }
+		    close(fds[1]);
+		    _exit(ok ? 0 : 1);
+		}
+		close(fds[1]);
+		Child c = { next, fds[0] };
+		running[pid] = c;
+		++next;
+	    }
+
+	    int status;
+	    pid_t pid = waitpid(-1, &status, 0);
+	    if( pid < 0 ) {
+		perror("waitpid");
+		exit(1);
+	    }
+	    std::map<pid_t, Child>::iterator it = running.find(pid);
+	    if( it == running.end() ) continue;
+
+	    QByteArray json;
+	    char buf[4096];
+	    ssize_t n;
+	    while( (n = ::read(it->second.fd, buf, sizeof(buf))) > 0 ) {
+		json.append(buf, n);
+	    }
+	    close(it->second.fd);
+
+	    size_t k = it->second.index;
+	    if( json.isEmpty() ) {
+		Result r;
+		r.song = songs[k];
+		r.output = output_name(opt, songs[k]);
+		if( WIFSIGNALED(status) ) {
+		    r.error = QString("Renderer killed by signal %1").arg(WTERMSIG(status));
+		} else {
+		    r.error = QString("Renderer exited with status %1").arg(WEXITSTATUS(status));
+		}
+		reports[k] = to_json(r);
+		all_ok = false;
+	    } else {
+		reports[k] = QString::fromUtf8(json.constData(), json.size());
+		if( ! WIFEXITED(status) || WEXITSTATUS(status) != 0 ) {
+		    all_ok = false;
+		}
+	    }
+	    running.erase(it);
+	}
+    }
+
+    bool parse_options(int argc, char* argv[], Options& opt, std::vector<QString>& songs)
+    {
+	char *cp;
+	struct option *op;
+	char opts[NELEM(long_opts) * 3 + 1];
+
+	// Build up the short option string
+	cp = opts;
+	for (op = long_opts; op < &long_opts[NELEM(long_opts)]; op++) {
+	    *cp++ = op->val;
+	    if (op->has_arg)
+		*cp++ = ':';
+	    if (op->has_arg == optional_argument )
+		*cp++ = ':';  // gets another one
+	}
+
+	int c;
+	QString arg;
+	for (;;) {
+	    c = getopt_long(argc, argv, opts, long_opts, NULL);
+	    if (c == -1)
+		break;
+
+	    arg = optarg ? QString::fromLocal8Bit(optarg) : QString();
+	    switch(c) {
+	    case 'o':
+		opt.out_dir = arg;
+		break;
+	    case 'f':
+		if( arg == "wav" ) {
+		    opt.settings.format = ExportSettings::WAV;
+		} else if( arg == "flac" ) {
+		    opt.settings.format = ExportSettings::FLAC;
+		} else {
+		    std::cerr << "Unknown format: " << optarg << std::endl;
+		    return false;
+		}
+		break;
+	    case 'b':
+		if( arg == "16" ) {
+		    opt.settings.sample_format = ExportSettings::PCM_16;
+		} else if( arg == "24" ) {
+		    opt.settings.sample_format = ExportSettings::PCM_24;
+		} else if( arg == "float" || arg == "32" ) {
+		    opt.settings.sample_format = ExportSettings::FLOAT;
+		} else {
+		    std::cerr << "Unknown sample format: " << optarg << std::endl;
+		    return false;
+		}
+		break;
+	    case 'r':
+		opt.settings.sample_rate = arg.toUInt();
+		if( opt.settings.sample_rate == 0 ) {
+		    std::cerr << "Bad sample rate: " << optarg << std::endl;
+		    return false;
+		}
+		break;
+	    case 'B':
+		opt.settings.block_size = arg.toUInt();
+		if( opt.settings.block_size == 0 ) {
+		    std::cerr << "Bad block size: " << optarg << std::endl;
+		    return false;
+		}
+		break;
+	    case 't':
+		opt.settings.tail_seconds = arg.toFloat();
+		break;
+	    case 'T':
+		opt.settings.render_threads = arg.toInt();
+		break;
+	    case 'j':
+		opt.jobs = arg.toUInt();
+		if( opt.jobs == 0 ) opt.jobs = 1;
+		break;
+	    case 'R':
+		opt.report = arg;
+		break;
+	    case 'V':
+		opt.log_level = optarg ? optarg : "Warning";
+		break;
+	    case 'h':
+	    default:
+		return false;
+	    }
+	}
+
+	for( int k=optind ; k<argc ; ++k ) {
+	    songs.push_back( QString::fromLocal8Bit(argv[k]) );
+	}
+	return ! songs.empty();
+    }
+
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+    Options opt;
+    std::vector<QString> songs;
+
+    if( ! parse_options(argc, argv, opt, songs) ) {
+	show_usage();
+	return 2;
+    }
+
+    if( ! opt.out_dir.isEmpty() && ! QDir(opt.out_dir).exists() ) {
+	std::cerr << "No such directory: " << opt.out_dir.toLocal8Bit().constData() << std::endl;
+	return 2;
+    }
+
+    // The Logger prints to stdout, so keep the real stdout for
+    // the report and send everything else to stderr.
+    FILE* report_out = fdopen(dup(STDOUT_FILENO), "w");
+    fflush(stdout);
+    dup2(STDERR_FILENO, STDOUT_FILENO);
+
+    double start = now();
+    std::vector<QString> reports(songs.size());
+    bool all_ok = true;
+
+    if( opt.jobs > 1 && songs.size() > 1 ) {
+	render_forked(opt, songs, reports, all_ok);
+    } else {
+	Logger::create_instance();
+	Logger::set_logging_level(opt.log_level);
+	for( size_t k=0 ; k<songs.size() ; ++k ) {
+	    bool ok;
+	    reports[k] = render_here(opt, songs[k], ok);
+	    all_ok = all_ok && ok;
+	}
+	delete Logger::get_instance();
+    }
+
+    QString json("{\n");
+    json += "  \"jobs\": " + QString::number(opt.jobs) + ",\n";
+    json += "  \"total_seconds\": " + json_number(now() - start, 3) + ",\n";
+    json += "  \"songs\": [\n";
+    for( size_t k=0 ; k<reports.size() ; ++k ) {
+	json += reports[k];
+	json += (k + 1 < reports.size()) ? ",\n" : "\n";
+    }
+    json += "  ]\n}\n";
+
+    QByteArray out = json.toUtf8();
+    if( opt.report.isEmpty() ) {
+	fwrite(out.constData(), 1, out.size(), report_out);
+	fflush(report_out);
+    } else {
+	QFile f(opt.report);
+	if( ! f.open(QIODevice::WriteOnly | QIODevice::Truncate) ) {
+	    std::cerr << "Could not write " << opt.report.toLocal8Bit().constData() << std::endl;
+	    return 1;
+	}
+	f.write(out);
+	f.close();
+    }
+
+    return all_ok ? 0 : 1;
+}
@@ -0,0 +1,389 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Composite
+ *
+ * Composite is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Composite is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "DrumkitCache.hpp"
+
+#include <Tritium/globals.hpp>
+#include <Tritium/EngineInterface.hpp>
+#include <Tritium/Serialization.hpp>
+#include <Tritium/ObjectBundle.hpp>
+#include <Tritium/Presets.hpp>
+#include <Tritium/Instrument.hpp>
+#include <Tritium/InstrumentList.hpp>
+#include <Tritium/InstrumentLayer.hpp>
+#include <Tritium/Sample.hpp>
+#include <Tritium/SoundLibrary.hpp>
+#include <Tritium/Logger.hpp>
+
+#include <QThread>
+#include <cassert>
+#include <unistd.h> // usleep()
+
+using namespace Tritium;
+
+namespace Composite
+{
+namespace Plugin
+{
+
+namespace
+{
+    // Loads synchronously with the asynchronous Serializer.
+    class SyncBundle : public Tritium::ObjectBundle
+    {
+    public:
+	QAtomicInt done;
+
+	SyncBundle() : done(0) {}
+	void operator()() { done.fetchAndStoreRelease(1); }
+    };
+
+    uint32_t program_key(uint16_t bank, uint8_t prog)
+    {
+	return (uint32_t(bank & 0x3FFF) << 7) | (prog & 0x7F);
+    }
+} // anonymous namespace
+
+class DrumkitCache::Worker : public QThread
+{
+public:
+    Worker(DrumkitCache* parent) : _parent(parent) {}
+
+    void run() {
+	_parent->run_worker();
+    }
+
+    static void nap() {
+	QThread::msleep(10);
+    }
+
+private:
+    DrumkitCache* _parent;
+};
+
+DrumkitCache::DrumkitCache(EngineInterface* engine) :
+    _engine(engine),
+    _limit(256 * 1024 * 1024),
+    _used(0),
+    _preload_full(false),
+    _epoch(0),
+    _wanted(-1),
+    _current(0),
+    _orphan(0),
+    _worker(0),
+    _kill(false)
+{
+    _serializer.reset( Serialization::Serializer::create_standalone(engine) );
+}
+
+DrumkitCache::~DrumkitCache()
+{
+    stop();
+    for( size_t k=0 ; k<_slots.size() ; ++k ) {
+	delete (Kit*)_slots[k]->kit;
+	delete _slots[k];
+    }
+    delete (Kit*)_orphan;
+    free_retired(true);
+}
+
+/**
+ * Build the slots and the program lookup table.  The audio thread
+ * only reads them, so they can't change after start().
+ */
+void DrumkitCache::set_presets(const Presets& presets)
+{
+    assert( _worker == 0 );
+    Presets::const_iterator p;
+    Bank::const_iterator b;
+    std::map<QString, int> by_uri;
+    std::map<QString, int>::iterator it;
+
+    for( p = presets.begin() ; p != presets.end() ; ++p ) {
+	uint16_t bank = (uint16_t(p->first.coarse) << 7) | p->first.fine;
+	for( b = p->second.begin() ; b != p->second.end() ; ++b ) {
+	    int slot;
+	    it = by_uri.find(b->second);
+	    if( it != by_uri.end() ) {
+		slot = it->second;
+	    } else {
+		slot = slot_for_uri(b->second);
+		if( slot < 0 ) {
+		    slot = _slots.size();
+		    _slots.push_back( new Slot );
+		    _slots[slot]->uri = b->second;
+		}
+		by_uri[b->second] = slot;
+	    }
+	    _programs[ program_key(bank, b->first) ] = slot;
+	}
+    }
+}
+
+void DrumkitCache::set_memory_limit(size_t bytes)
+{
+    _limit = bytes;
+}
+
+size_t DrumkitCache::memory_used()
+{
+    return _used;
+}
+
+int DrumkitCache::slot_for_uri(const QString& uri)
+{
+    for( size_t k=0 ; k<_slots.size() ; ++k ) {
+	if( _slots[k]->uri == uri ) return k;
+    }
+    return -1;
+}
+
+/**
+ * Load the kit at 'uri' and make it the current kit.  Blocks
+ * until it is loaded.  Returns 0 on failure.
+ */
+DrumkitCache::Kit* DrumkitCache::load_now(const QString& uri)
+{
+    assert( _worker == 0 );
+    Kit* kit;
+    int slot = slot_for_uri(uri);
+    if( slot >= 0 ) {
+	if( ! _slots[slot]->kit ) load_slot(slot);
+	_slots[slot]->preloaded = true;
+	kit = _slots[slot]->kit;
+    } else {
+	kit = load_kit(uri);
+	delete (Kit*)_orphan.fetchAndStoreOrdered(kit);
+    }
+    if( kit ) _current.fetchAndStoreOrdered(kit);
+    return kit;
+}
+
+DrumkitCache::Kit* DrumkitCache::load_kit(const QString& uri)
+{
+    SyncBundle bdl;
+    _serializer->load_uri(uri, bdl, _engine);
+    while( ! bdl.done.fetchAndAddAcquire(0) ) {
+	usleep(10000);
+    }
+
+    if( bdl.error ) {
+	ERRORLOG( QString("Could not load drumkit %1: %2")
+		  .arg(uri)
+		  .arg(bdl.error_message) );
+	return 0;
+    }
+
+    T<Kit>::auto_ptr kit( new Kit );
+    kit->uri = uri;
+    kit->instruments.reset( new InstrumentList );
+    kit->bytes = 0;
+
+    while( ! bdl.empty() ) {
+	switch(bdl.peek_type()) {
+	case ObjectItem::Instrument_t:
+	    kit->instruments->add( bdl.pop<Instrument>() );
+	    break;
+	case ObjectItem::Channel_t:
+	    kit->channels.push_back( bdl.pop<Mixer::Channel>() );
+	    break;
+	default:
+	    bdl.pop();
+	}
+    }
+
+    unsigned k, j;
+    for( k=0 ; k<kit->instruments->get_size() ; ++k ) {
+	T<Instrument>::shared_ptr I = kit->instruments->get(k);
+	for( j=0 ; j<MAX_LAYERS ; ++j ) {
+	    InstrumentLayer *L = I->get_layer(j);
+	    if( L && L->get_sample() ) {
+		kit->bytes += L->get_sample()->get_size();
+	    }
+	}
+    }
+
+    INFOLOG( QString("Loaded drumkit %1 (%2 instruments, %3 kB)")
+	     .arg(uri)
+	     .arg(kit->instruments->get_size())
+	     .arg(kit->bytes / 1024) );
+    return kit.release();
+}
+
+void DrumkitCache::start()
+{
+    if( _worker ) return;
+    _kill = false;
+    _worker = new Worker(this);
+    _worker->start();
+}
+
+void DrumkitCache::stop()
+{
+    if( ! _worker ) return;
+    _kill = true;
+    _worker->wait();
+    delete _worker;
+    _worker = 0;
+}
+
+void DrumkitCache::cycle()
+{
+    _epoch.fetchAndAddOrdered(1);
+}
+
+void DrumkitCache::request(uint16_t bank, uint8_t prog)
+{
+    std::map<uint32_t, int>::const_iterator it;
+    it = _programs.find( program_key(bank, prog) );
+    if( it == _programs.end() ) return;
+
+    _slots[it->second]->last_used.fetchAndStoreRelaxed( _epoch.fetchAndAddAcquire(0) );
+    _wanted.fetchAndStoreOrdered( it->second );
+}
+
+DrumkitCache::Kit* DrumkitCache::take_pending()
+{
+    int w = _wanted.fetchAndAddAcquire(0);
+    if( w < 0 ) return 0;
+
+    Slot& slot = *_slots[w];
+    Kit* kit = slot.kit.fetchAndAddOrdered(0);
+    if( ! kit ) return 0; // The worker is loading it.
+
+    _wanted.testAndSetOrdered(w, -1);
+    if( kit == (Kit*)_current ) return 0;
+    _current.fetchAndStoreOrdered(kit);
+    slot.last_used.fetchAndStoreRelaxed( _epoch.fetchAndAddAcquire(0) );
+    return kit;
+}
+
+bool DrumkitCache::is_loaded(uint16_t bank, uint8_t prog)
+{
+    std::map<uint32_t, int>::const_iterator it;
+    it = _programs.find( program_key(bank, prog) );
+    if( it == _programs.end() ) return false;
+    return _slots[it->second]->kit.fetchAndAddAcquire(0) != 0;
+}
+
+bool DrumkitCache::load_slot(int slot)
+{
+    Slot& s = *_slots[slot];
+    Kit* kit = load_kit(s.uri);
+    if( ! kit ) return false;
+    _used += kit->bytes;
+    s.kit.fetchAndStoreOrdered(kit);
+    return true;
+}
+
+/**
+ * Evict least-recently used kits until the memory used is under
+ * the limit.  Never evicts the current kit, the requested kit, or
+ * 'keep'.
+ */
+void DrumkitCache::evict_to_limit(int keep)
+{
+    while( _used > _limit ) {
+	Kit* current = _current;
+	int wanted = _wanted.fetchAndAddAcquire(0);
+	int victim = -1;
+	int oldest = 0;
+	for( int k=0 ; k<int(_slots.size()) ; ++k ) {
+	    Kit* kit = _slots[k]->kit;
+	    if( !kit || kit == current || k == wanted || k == keep ) continue;
+	    int used = _slots[k]->last_used.fetchAndAddAcquire(0);
+	    if( victim == -1 || used < oldest ) {
+		victim = k;
+		oldest = used;
+	    }
+	}
+	if( victim == -1 ) break;
+
+	retire(victim);
+    }
+}
+
+void DrumkitCache::retire(int slot)
+{
+    Retired r;
+    r.kit = _slots[slot]->kit.fetchAndStoreOrdered(0);
+    r.epoch = _epoch.fetchAndAddAcquire(0);
+    _used -= r.kit->bytes;
+    _retired.push_back(r);
+    DEBUGLOG( QString("Evicted drumkit %1").arg(r.kit->uri) );
+}
+
+/**
+ * Delete retired kits that the audio thread can no longer reach.
+ * If the audio thread read a slot just before it was cleared, it
+ * has stored the kit in _current before its next cycle().
+ */
+void DrumkitCache::free_retired(bool all)
+{
+    std::deque<Retired>::iterator it = _retired.begin();
+    while( it != _retired.end() ) {
+	if( all
+	    || ( _epoch.fetchAndAddAcquire(0) - it->epoch >= 2
+		 && it->kit != (Kit*)_current ) ) {
+	    delete it->kit;
+	    it = _retired.erase(it);
+	} else {
+	    ++it;
+	}
+    }
+}
+
+void DrumkitCache::run_worker()
+{
+    while( ! _kill ) {
+	free_retired(false);
+
+	// A program change for a kit that isn't loaded.
+	int w = _wanted.fetchAndAddAcquire(0);
+	if( w >= 0 && ! _slots[w]->kit ) {
+	    if( ! load_slot(w) ) {
+		_wanted.testAndSetOrdered(w, -1);
+	    }
+	    _slots[w]->preloaded = true;
+	    evict_to_limit(w);
+	    continue;
+	}
+
+	// Preload until the first kit that doesn't fit.
+	bool busy = false;
+	for( size_t k=0 ; k<_slots.size() && ! _preload_full && ! _kill ; ++k ) {
+	    Slot& s = *_slots[k];
+	    if( s.preloaded || s.kit ) continue;
+	    s.preloaded = true;
+	    if( load_slot(k) && _used > _limit ) {
+		retire(k);
+		_preload_full = true;
+	    }
+	    busy = true;
+	    break;
+	}
+
+	if( ! busy ) Worker::nap();
+    }
+}
+
+} // namespace Plugin
+} // namespace Composite
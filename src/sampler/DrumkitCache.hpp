@@ -0,0 +1,146 @@
+/*
+ * Copyright(c) 2009 by Gabriel M. Beddingfield <gabriel@teuton.org>
+ *
+ * This file is part of Composite
+ *
+ * Composite is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Composite is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+#ifndef COMPOSITE_PLUGIN_DRUMKITCACHE_HPP
+#define COMPOSITE_PLUGIN_DRUMKITCACHE_HPP
+
+#include <Tritium/memory.hpp>
+#include <Tritium/Mixer.hpp>
+#include <QString>
+#include <QAtomicInt>
+#include <QAtomicPointer>
+#include <deque>
+#include <map>
+#include <vector>
+#include <stdint.h>
+
+namespace Tritium
+{
+    class EngineInterface;
+    class InstrumentList;
+    class Presets;
+    namespace Serialization {
+	class Serializer;
+    }
+} // namespace Tritium
+
+namespace Composite
+{
+    namespace Plugin
+    {
+	/**
+	 * \brief Keeps the drumkits of the presets loaded for program changes.
+	 *
+	 * Each URI in the Presets gets a slot.  A worker thread
+	 * preloads the slots (in bank/program order) until the
+	 * memory limit is reached.  A program change for a kit that
+	 * is not loaded makes the worker load it next, evicting the
+	 * least recently used kits if the limit is exceeded.
+	 *
+	 * The audio thread calls request() when it gets a program
+	 * change and take_pending() at the start of each cycle.
+	 * Both only read atomics and the lookup table, so a program
+	 * change for a loaded kit is just a pointer swap.
+	 *
+	 * Evicted kits are not deleted until the audio thread has
+	 * finished at least one more cycle() and is not using them.
+	 */
+	class DrumkitCache
+	{
+	public:
+	    struct Kit
+	    {
+		QString uri;
+		Tritium::T<Tritium::InstrumentList>::shared_ptr instruments;
+		std::deque< Tritium::T<Tritium::Mixer::Channel>::shared_ptr > channels;
+		size_t bytes;   // Sample memory
+	    };
+
+	    DrumkitCache(Tritium::EngineInterface* engine);
+	    ~DrumkitCache();
+
+	    // Setup (call before start())
+	    void set_presets(const Tritium::Presets& presets);
+	    void set_memory_limit(size_t bytes);
+	    /// Load a kit synchronously and make it the current kit.
+	    Kit* load_now(const QString& uri);
+
+	    void start();
+	    void stop();
+
+	    // Audio thread
+	    void cycle();
+	    void request(uint16_t bank, uint8_t prog);
+	    /// Returns the requested kit if it is ready (once), else 0.
+	    Kit* take_pending();
+	    /// The kit of this program is loaded (a request would be
+	    /// a hit).
+	    bool is_loaded(uint16_t bank, uint8_t prog);
+
+	    /// Sample memory of the loaded kits (approx.)
+	    size_t memory_used();
+
+	private:
+	    class Worker;
+	    friend class Worker;
+
+	    struct Slot
+	    {
+		QString uri;
+		QAtomicPointer<Kit> kit;
+		QAtomicInt last_used;   // cycle() count of the last request
+		bool preloaded;         // Worker: tried to preload it once
+		Slot() : kit(0), last_used(0), preloaded(false) {}
+	    };
+
+	    struct Retired
+	    {
+		Kit* kit;
+		int epoch;
+	    };
+
+	    int slot_for_uri(const QString& uri);
+	    Kit* load_kit(const QString& uri);
+	    void run_worker();
+	    bool load_slot(int slot);
+	    void evict_to_limit(int keep);
+	    void retire(int slot);
+	    void free_retired(bool all);
+
+	    Tritium::EngineInterface* _engine;
+	    Tritium::T<Tritium::Serialization::Serializer>::auto_ptr _serializer;
+	    std::vector<Slot*> _slots;
+	    std::map<uint32_t, int> _programs;   // (bank << 7 | prog) --> slot
+	    std::deque<Retired> _retired;        // Worker only
+	    size_t _limit;
+	    size_t _used;              // Worker: bytes in loaded kits
+	    bool _preload_full;        // Worker: a preload didn't fit
+	    QAtomicInt _epoch;         // Number of cycle()'s
+	    QAtomicInt _wanted;        // Slot requested by the audio thread, or -1
+	    QAtomicPointer<Kit> _current;  // Kit installed by the audio thread
+	    QAtomicPointer<Kit> _orphan;   // load_now() kit that has no slot
+	    Worker* _worker;
+	    bool _kill;
+	};
+
+    } // namespace Plugin
+} // namespace Composite
+
+#endif // COMPOSITE_PLUGIN_DRUMKITCACHE_HPP
@@ -24,6 +24,7 @@
 #include <Tritium/globals.hpp> // MAX_BUFFER_SIZE
 #include <Tritium/MixerImpl.hpp>
 #include <Tritium/Sampler.hpp>
+#include <Tritium/SampleRateCache.hpp>
 #include <Tritium/AudioPort.hpp>
 #include <Tritium/SeqScript.hpp>
 #include <Tritium/TransportPosition.hpp>
@@ -49,6 +50,9 @@
 #define LV2_MIDI_EVENT_URI "http://lv2plug.in/ns/ext/midi#MidiEvent"
 // Sanity check
 #define MAX_URI_LEN 128
+// Instrument ports reserved up front, so that installing a kit
+// from the cache does not allocate in run().
+#define RESERVED_INSTRUMENT_PORTS 64
 
 static LV2_Descriptor *pluginDescriptor = NULL;
 
@@ -161,6 +165,11 @@ void EngineLv2::_activate()
     _prefs.reset( new Preferences );
     _mixer.reset( new MixerImpl(MAX_BUFFER_SIZE) );
     _sampler.reset( new Sampler(_mixer) );
+    // Convert the kits to the host's rate as they are loaded.
+    _sampler->get_sample_rate_cache()->set_sample_rate( unsigned(_sample_rate) );
+    if( _prefs->m_bSampleDiskCache ) {
+	_sampler->get_sample_rate_cache()->set_disk_cache( _prefs->getDataDirectory() + "cache/samples" );
+    }
     _seq.reset( new SeqScript );
     _midi_imp.reset( new DefaultMidiImplementation );
     _midi_imp->sampler( _sampler );
@@ -201,20 +210,17 @@ void EngineLv2::_activate()
 	if( ! uri.isEmpty() ) break;
     }
 
-    load_drumkit(uri);
-}
-
-void EngineLv2::load_drumkit(const QString& drumkit_uri)
-{
-    bool loading = _obj_bdl->loading();
-    if(!loading) {
-	ERRORLOG( QString("Unable to acquire loading object to load drumkit %1")
-		  .arg(drumkit_uri)
-	    );
-	return;
+    // Program changes are served from the cache.  The first kit
+    // is loaded now and the rest are preloaded in the background.
+    _sampler->reserve_instrument_ports( RESERVED_INSTRUMENT_PORTS );
+    _cache.reset( new DrumkitCache(this) );
+    _cache->set_memory_limit( size_t(_prefs->m_nPresetCacheMegabytes) * 1024 * 1024 );
+    _cache->set_presets( *_presets );
+    DrumkitCache::Kit* kit = _cache->load_now(uri);
+    if( kit ) {
+	install_kit(kit);
     }
-
-    _serializer->load_uri(drumkit_uri, *_obj_bdl, this);
+    _cache->start();
 }
 
 void EngineLv2::install_drumkit_bundle()
@@ -278,6 +284,31 @@ void EngineLv2::install_drumkit_bundle()
     _obj_bdl->reset();
 }
 
+/**
+ * Install a kit from the cache.
+ *
+ * This is RT-safe as long as the kit does not have more than
+ * RESERVED_INSTRUMENT_PORTS instruments.  The kit's instruments
+ * stay owned by the cache.
+ */
+void EngineLv2::install_kit(DrumkitCache::Kit* kit)
+{
+    _sampler->swap_instrument_list( kit->instruments );
+
+    uint32_t k, j, count = kit->channels.size();
+    if( count > _mixer->count() ) count = _mixer->count();
+    for( k=0 ; k<count ; ++k ) {
+	T<Mixer::Channel>::shared_ptr dest = _mixer->channel(k);
+	const Mixer::Channel& src = *kit->channels[k];
+	dest->gain( src.gain() );
+	dest->pan_L( src.pan_L() );
+	dest->pan_R( src.pan_R() );
+	for( j=0 ; j<src.send_count() && j<dest->send_count() ; ++j ) {
+	    dest->send_gain( j, src.send_gain(j) );
+	}
+    }
+}
+
 /**
  * Negotiate user control of the master volume.
  *
@@ -339,10 +370,9 @@ void EngineLv2::handle_control_events(
 	    {
 		uint16_t bank = (ev->idata >> 16) & 0x3FFF;
 		uint8_t prog = ev->idata & 0x7F;
-		const QString& uri = _presets->program(bank, prog);
-		if( ! uri.isEmpty() ) {
-		    load_drumkit(uri);
-		}
+		// Installed at the start of the next cycle (or
+		// as soon as the cache has loaded it).
+		_cache->request(bank, prog);
 	    }
 	    break;
 	}
@@ -357,8 +387,10 @@ void EngineLv2::_run(uint32_t nframes)
     if( ! _out_R ) return;
 
     // Check if we need to install a new drumkit.
-    if( _obj_bdl->state() == ObjectBundle::Ready ) {
-	install_drumkit_bundle();
+    _cache->cycle();
+    DrumkitCache::Kit* kit = _cache->take_pending();
+    if( kit ) {
+	install_kit(kit);
     }
 
     // Sanity checks
@@ -393,11 +425,13 @@ void EngineLv2::_deactivate()
 {
     _out_L = 0;
     _out_R = 0;
+    if(_cache.get()) _cache->stop();
     _serializer.reset();
     _obj_bdl.reset(); // The serializer might be working on an _obj_bdl
     _midi_imp.reset();
     _seq.reset();
     _sampler.reset();
+    _cache.reset(); // After the sampler, which uses the current kit
     _mixer.reset();
     _prefs.reset();
     _presets.reset();
@@ -30,6 +30,7 @@
 #include <Tritium/ObjectBundle.hpp>
 #include <Tritium/SeqScriptIterator.hpp>
 #include <Tritium/Presets.hpp>
+#include "DrumkitCache.hpp"
 
 #include <QString>
 #include <QMutex>
@@ -98,9 +99,6 @@ namespace Composite
 		return _sample_rate;
 	    }
 
-	    void load_drumkit_by_name(const QString& name);
-	    void load_drumkit(const QString& drumkit_xml);
-
 	protected:
 	    void process_events(uint32_t sample_count);
 
@@ -109,6 +107,7 @@ namespace Composite
 					const Tritium::TransportPosition& pos,
 					uint32_t nframes );
 	    void install_drumkit_bundle();
+	    void install_kit(DrumkitCache::Kit* kit);
 	    void update_master_volume();
 
 	private:
@@ -131,6 +130,7 @@ namespace Composite
 	    Tritium::T<ObjectBundle>::shared_ptr _obj_bdl;
 	    Tritium::T<Tritium::DefaultMidiImplementation>::shared_ptr _midi_imp;
 	    Tritium::T<Tritium::Presets>::shared_ptr _presets;
+	    Tritium::T<DrumkitCache>::auto_ptr _cache;
 	};
 
 	class ObjectBundle : public Tritium::ObjectBundle